@@ -0,0 +1,75 @@
+# Copyright (c) 2024 The STE||AR-Group
+#
+# SPDX-License-Identifier: BSL-1.0
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+if(NOT TARGET Liburing::liburing)
+  # compatibility with older CMake versions
+  if(LIBURING_ROOT AND NOT Liburing_ROOT)
+    set(Liburing_ROOT
+        ${LIBURING_ROOT}
+        CACHE PATH "Liburing base directory"
+    )
+    unset(LIBURING_ROOT CACHE)
+  endif()
+
+  find_package(PkgConfig QUIET)
+  pkg_check_modules(PC_Liburing QUIET liburing)
+
+  find_path(
+    Liburing_INCLUDE_DIR liburing.h
+    HINTS ${Liburing_ROOT}
+          ENV
+          LIBURING_ROOT
+          ${HPX_LIBURING_ROOT}
+          ${PC_Liburing_MINIMAL_INCLUDEDIR}
+          ${PC_Liburing_MINIMAL_INCLUDE_DIRS}
+          ${PC_Liburing_INCLUDEDIR}
+          ${PC_Liburing_INCLUDE_DIRS}
+    PATH_SUFFIXES include
+  )
+
+  find_library(
+    Liburing_LIBRARY
+    NAMES uring liburing
+    HINTS ${Liburing_ROOT}
+          ENV
+          LIBURING_ROOT
+          ${HPX_LIBURING_ROOT}
+          ${PC_Liburing_MINIMAL_LIBDIR}
+          ${PC_Liburing_MINIMAL_LIBRARY_DIRS}
+          ${PC_Liburing_LIBDIR}
+          ${PC_Liburing_LIBRARY_DIRS}
+    PATH_SUFFIXES lib lib64
+  )
+
+  set(Liburing_LIBRARIES ${Liburing_LIBRARY})
+  set(Liburing_INCLUDE_DIRS ${Liburing_INCLUDE_DIR})
+
+  find_package_handle_standard_args(
+    Liburing DEFAULT_MSG Liburing_LIBRARY Liburing_INCLUDE_DIR
+  )
+
+  get_property(
+    _type
+    CACHE Liburing_ROOT
+    PROPERTY TYPE
+  )
+  if(_type)
+    set_property(CACHE Liburing_ROOT PROPERTY ADVANCED 1)
+    if("x${_type}" STREQUAL "xUNINITIALIZED")
+      set_property(CACHE Liburing_ROOT PROPERTY TYPE PATH)
+    endif()
+  endif()
+
+  if(Liburing_FOUND)
+    add_library(Liburing::liburing INTERFACE IMPORTED)
+    target_include_directories(
+      Liburing::liburing SYSTEM INTERFACE ${Liburing_INCLUDE_DIR}
+    )
+    target_link_libraries(Liburing::liburing INTERFACE ${Liburing_LIBRARIES})
+  endif()
+
+  mark_as_advanced(Liburing_ROOT Liburing_LIBRARY Liburing_INCLUDE_DIR)
+endif()
@@ -0,0 +1,15 @@
+# Copyright (c) 2024 The STE||AR-Group
+#
+# SPDX-License-Identifier: BSL-1.0
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+if(HPX_WITH_ASYNC_IO_URING)
+  find_package(Liburing)
+  if(NOT Liburing_FOUND)
+    hpx_error("liburing could not be found and HPX_WITH_ASYNC_IO_URING=On, \
+    please specify Liburing_ROOT to point to the root of your liburing \
+    installation"
+    )
+  endif()
+endif()
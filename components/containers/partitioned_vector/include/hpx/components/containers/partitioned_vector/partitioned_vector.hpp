@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_algorithms.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_copy.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_halo.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_impl.hpp>
 
@@ -0,0 +1,829 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/partitioned_vector/partitioned_vector_algorithms.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_local/dataflow.hpp>
+#include <hpx/components/get_ptr.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/serialization/optional.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/parallel/algorithms/copy.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/unique.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_copy.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_segmented_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// \cond NOINTERNAL
+namespace hpx::segmented {
+
+    // The algorithms in this file operate on whole segments of a
+    // partitioned_vector at once. Each segment is processed by a single task
+    // running on the locality the segment lives on, the positions of the
+    // results are computed from the per-segment counts using an exclusive
+    // scan, and the elements are moved using one bulk transfer for each pair
+    // of overlapping segments. All segments are processed concurrently, the
+    // execution policy only decides whether the result is returned
+    // synchronously or as a future.
+    //
+    // Predicates and comparison functions have to be serializable as they
+    // are sent to the localities holding the segments. The predicate passed
+    // to copy_if is invoked twice for each element.
+
+    namespace detail {
+
+        using range_pieces =
+            std::vector<server::partitioned_vector_range_piece>;
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T, typename Data>
+        std::shared_ptr<server::partitioned_vector<T, Data>> get_segment(
+            hpx::id_type const& part)
+        {
+            return hpx::get_ptr<server::partitioned_vector<T, Data>>(
+                hpx::launch::sync, part);
+        }
+
+        template <typename Future>
+        void wait_all_segments(std::vector<Future>& futures)
+        {
+            hpx::wait_all_nothrow(futures);
+            for (auto& f : futures)
+                f.get();    // propagate exceptions
+        }
+
+        // Write the given values to the destination pieces, the offsets of
+        // the pieces are relative to the beginning of the values.
+        template <typename T, typename Data>
+        void put_pieces(std::vector<T>& values, range_pieces const& dest)
+        {
+            using put_range_action =
+                typename server::partitioned_vector<T, Data>::put_range_action;
+            using buffer_type = serialization::serialize_buffer<T>;
+
+            // the buffers refer to the values, thus we wait for all of the
+            // transfers to finish
+            std::vector<hpx::future<void>> puts;
+            puts.reserve(dest.size());
+            for (auto const& p : dest)
+            {
+                HPX_ASSERT(p.offset_ + p.size_ <= values.size());
+                puts.push_back(hpx::async<put_range_action>(p.partition_,
+                    p.local_first_,
+                    buffer_type(values.data() + p.offset_, p.size_,
+                        buffer_type::reference)));
+            }
+            wait_all_segments(puts);
+        }
+
+        // Fetch the values of the given source pieces into a single vector
+        template <typename T, typename Data>
+        std::vector<T> get_pieces(range_pieces const& src)
+        {
+            using get_range_action =
+                typename server::partitioned_vector<T, Data>::get_range_action;
+
+            std::size_t size = 0;
+            for (auto const& p : src)
+                size += p.size_;
+
+            std::vector<T> values(size);
+
+            using buffer_type = serialization::serialize_buffer<T>;
+
+            std::vector<hpx::future<void>> gets;
+            gets.reserve(src.size());
+            for (auto const& p : src)
+            {
+                gets.push_back(
+                    hpx::async<get_range_action>(p.partition_, p.local_first_,
+                        p.local_first_ + p.size_)
+                        .then(hpx::launch::sync,
+                            [&values, offset = p.offset_](
+                                hpx::future<buffer_type>&& f) {
+                                auto&& buffer = f.get();
+                                std::copy(buffer.begin(), buffer.end(),
+                                    values.begin() + offset);
+                            }));
+            }
+            wait_all_segments(gets);
+
+            return values;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The functions below are executed on the locality of the segment
+        // they operate on.
+        template <typename T, typename Data, typename Pred>
+        std::size_t count_if_segment(hpx::id_type const& part,
+            std::size_t first, std::size_t count, Pred const& pred)
+        {
+            auto const segment = get_segment<T, Data>(part);
+            Data& data = segment->get_data();
+
+            auto const begin = data.begin() + first;
+            return static_cast<std::size_t>(
+                std::count_if(begin, begin + count, pred));
+        }
+
+        template <typename T, typename Data, typename Pred>
+        struct count_if_segment_action
+          : hpx::actions::make_action<
+                decltype(&count_if_segment<T, Data, Pred>),
+                &count_if_segment<T, Data, Pred>,
+                count_if_segment_action<T, Data, Pred>>::type
+        {
+        };
+
+        template <typename T, typename Data, typename Pred>
+        void copy_if_segment(hpx::id_type const& part, std::size_t first,
+            std::size_t count, Pred const& pred, range_pieces const& dest)
+        {
+            std::vector<T> values;
+            {
+                auto const segment = get_segment<T, Data>(part);
+                Data& data = segment->get_data();
+
+                auto const begin = data.begin() + first;
+                std::copy_if(
+                    begin, begin + count, std::back_inserter(values), pred);
+            }
+            put_pieces<T, Data>(values, dest);
+        }
+
+        template <typename T, typename Data, typename Pred>
+        struct copy_if_segment_action
+          : hpx::actions::make_action<decltype(&copy_if_segment<T, Data, Pred>),
+                &copy_if_segment<T, Data, Pred>,
+                copy_if_segment_action<T, Data, Pred>>::type
+        {
+        };
+
+        // Remove the consecutive duplicates from the segment, the remaining
+        // elements are moved to its beginning. Elements equal to the last
+        // element of the preceding segment (if any) are removed as well.
+        template <typename T, typename Data, typename Pred>
+        std::size_t unique_segment(hpx::id_type const& part, std::size_t first,
+            std::size_t count, hpx::optional<T> const& prev, Pred const& pred)
+        {
+            auto const segment = get_segment<T, Data>(part);
+            Data& data = segment->get_data();
+
+            auto const begin = data.begin() + first;
+            auto const end = begin + count;
+
+            auto it = begin;
+            if (prev)
+            {
+                while (it != end && pred(*prev, *it))
+                    ++it;
+            }
+
+            auto const last = std::move(it, std::unique(it, end, pred), begin);
+            return static_cast<std::size_t>(std::distance(begin, last));
+        }
+
+        template <typename T, typename Data, typename Pred>
+        struct unique_segment_action
+          : hpx::actions::make_action<decltype(&unique_segment<T, Data, Pred>),
+                &unique_segment<T, Data, Pred>,
+                unique_segment_action<T, Data, Pred>>::type
+        {
+        };
+
+        template <typename T, typename Data>
+        void move_segment(hpx::id_type const& part, std::size_t first,
+            std::size_t count, range_pieces const& dest)
+        {
+            // the destination may overlap with the source, thus the values
+            // are read before any of them are written
+            std::vector<T> values;
+            values.reserve(count);
+            {
+                auto const segment = get_segment<T, Data>(part);
+                Data& data = segment->get_data();
+
+                auto const begin = data.begin() + first;
+                std::move(begin, begin + count, std::back_inserter(values));
+            }
+            put_pieces<T, Data>(values, dest);
+        }
+
+        template <typename T, typename Data>
+        struct move_segment_action
+          : hpx::actions::make_action<decltype(&move_segment<T, Data>),
+                &move_segment<T, Data>, move_segment_action<T, Data>>::type
+        {
+        };
+
+        template <typename T, typename Data, typename Pred>
+        std::size_t partition_segment(hpx::id_type const& part,
+            std::size_t first, std::size_t count, Pred const& pred)
+        {
+            auto const segment = get_segment<T, Data>(part);
+            Data& data = segment->get_data();
+
+            auto const begin = data.begin() + first;
+            auto const middle = std::partition(begin, begin + count, pred);
+            return static_cast<std::size_t>(std::distance(begin, middle));
+        }
+
+        template <typename T, typename Data, typename Pred>
+        struct partition_segment_action
+          : hpx::actions::make_action<
+                decltype(&partition_segment<T, Data, Pred>),
+                &partition_segment<T, Data, Pred>,
+                partition_segment_action<T, Data, Pred>>::type
+        {
+        };
+
+        // Exchange the elements [first, first + count) of this segment with
+        // the elements starting at other_first of the other segment
+        template <typename T, typename Data>
+        void swap_segments(hpx::id_type const& part, std::size_t first,
+            std::size_t count, hpx::id_type const& other,
+            std::size_t other_first)
+        {
+            using server_type = server::partitioned_vector<T, Data>;
+
+            auto const segment = get_segment<T, Data>(part);
+            Data& data = segment->get_data();
+
+            auto other_values =
+                hpx::async<typename server_type::get_range_action>(
+                    other, other_first, other_first + count)
+                    .get();
+
+            hpx::async<typename server_type::put_range_action>(other,
+                other_first,
+                server::detail::make_range_buffer<T>(
+                    data, first, first + count))
+                .get();
+
+            std::copy(
+                other_values.begin(), other_values.end(), data.begin() + first);
+        }
+
+        template <typename T, typename Data>
+        struct swap_segments_action
+          : hpx::actions::make_action<decltype(&swap_segments<T, Data>),
+                &swap_segments<T, Data>, swap_segments_action<T, Data>>::type
+        {
+        };
+
+        // Merge the given pieces of both input sequences into the elements
+        // [first, first + count) of this segment
+        template <typename T, typename Data, typename Comp>
+        void merge_segment(hpx::id_type const& part, std::size_t first,
+            std::size_t count, range_pieces const& src1,
+            range_pieces const& src2, Comp const& comp)
+        {
+            std::vector<T> const values1 = get_pieces<T, Data>(src1);
+            std::vector<T> const values2 = get_pieces<T, Data>(src2);
+            HPX_ASSERT(values1.size() + values2.size() == count);
+            HPX_UNUSED(count);
+
+            auto const segment = get_segment<T, Data>(part);
+            Data& data = segment->get_data();
+
+            std::merge(values1.begin(), values1.end(), values2.begin(),
+                values2.end(), data.begin() + first, comp);
+        }
+
+        template <typename T, typename Data, typename Comp>
+        struct merge_segment_action
+          : hpx::actions::make_action<decltype(&merge_segment<T, Data, Comp>),
+                &merge_segment<T, Data, Comp>,
+                merge_segment_action<T, Data, Comp>>::type
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Action, typename... Ts>
+        auto async_segment(hpx::id_type const& part, Ts&&... ts)
+        {
+            return hpx::async(
+                Action(), hpx::colocated(part), part, HPX_FORWARD(Ts, ts)...);
+        }
+
+        template <typename T, typename Data>
+        void check_destination(char const* name,
+            partitioned_vector<T, Data> const* dest, std::size_t dest_first,
+            std::size_t count)
+        {
+            if (dest == nullptr || count > dest->size() - dest_first)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter, name,
+                    "the destination range is too small to hold {} elements",
+                    count);
+            }
+        }
+
+        // Return the (exclusive) output offsets for the given counts
+        inline std::vector<std::size_t> get_offsets(
+            std::vector<std::size_t> const& counts)
+        {
+            std::vector<std::size_t> offsets(counts.size() + 1, 0);
+            std::inclusive_scan(
+                counts.begin(), counts.end(), offsets.begin() + 1);
+            return offsets;
+        }
+
+        template <typename T>
+        std::vector<T> get_all(std::vector<hpx::future<T>>& futures)
+        {
+            hpx::wait_all_nothrow(futures);
+
+            std::vector<T> values;
+            values.reserve(futures.size());
+            for (auto& f : futures)
+                values.push_back(f.get());
+            return values;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename SrcIter, typename T, typename Data, typename Pred>
+        vector_iterator<T, Data> copy_if(SrcIter first, SrcIter last,
+            vector_iterator<T, Data> dest, Pred const& pred)
+        {
+            std::size_t const first_index = first.get_global_index();
+            std::size_t const last_index = last.get_global_index();
+            if (first_index == last_index)
+                return dest;
+
+            range_pieces const pieces =
+                first.get_data()->get_range_pieces(first_index, last_index);
+
+            // count the elements to copy from each of the segments
+            std::vector<hpx::future<std::size_t>> count_futures;
+            count_futures.reserve(pieces.size());
+            for (auto const& p : pieces)
+            {
+                count_futures.push_back(
+                    async_segment<count_if_segment_action<T, Data, Pred>>(
+                        p.partition_, p.local_first_, p.size_, pred));
+            }
+
+            std::vector<std::size_t> const counts = get_all(count_futures);
+            std::vector<std::size_t> const offsets = get_offsets(counts);
+
+            partitioned_vector<T, Data>* dest_data = dest.get_data();
+            std::size_t const dest_first = dest.get_global_index();
+            check_destination(
+                "hpx::copy_if", dest_data, dest_first, offsets.back());
+
+            // each segment sends its elements directly to the destination
+            std::vector<hpx::future<void>> copies;
+            copies.reserve(pieces.size());
+            for (std::size_t i = 0; i != pieces.size(); ++i)
+            {
+                if (counts[i] == 0)
+                    continue;
+
+                std::size_t const pos = dest_first + offsets[i];
+                copies.push_back(
+                    async_segment<copy_if_segment_action<T, Data, Pred>>(
+                        pieces[i].partition_, pieces[i].local_first_,
+                        pieces[i].size_, pred,
+                        dest_data->get_range_pieces(pos, pos + counts[i])));
+            }
+            wait_all_segments(copies);
+
+            return dest + offsets.back();
+        }
+
+        template <typename T, typename Data, typename Pred>
+        vector_iterator<T, Data> unique(vector_iterator<T, Data> first,
+            vector_iterator<T, Data> last, Pred const& pred)
+        {
+            std::size_t const first_index = first.get_global_index();
+            std::size_t const last_index = last.get_global_index();
+            if (first_index == last_index)
+                return first;
+
+            partitioned_vector<T, Data>* data = first.get_data();
+            range_pieces const pieces =
+                data->get_range_pieces(first_index, last_index);
+
+            // the elements preceding each of the segments have to be read
+            // before any of the segments are modified
+            std::vector<hpx::future<T>> prev_futures;
+            prev_futures.reserve(pieces.size());
+            for (std::size_t i = 1; i < pieces.size(); ++i)
+            {
+                prev_futures.push_back(
+                    data->get_value(first_index + pieces[i].offset_ - 1));
+            }
+            std::vector<T> prev = get_all(prev_futures);
+
+            // remove the duplicates inside each of the segments
+            std::vector<hpx::future<std::size_t>> count_futures;
+            count_futures.reserve(pieces.size());
+            for (std::size_t i = 0; i != pieces.size(); ++i)
+            {
+                hpx::optional<T> prev_value;
+                if (i != 0)
+                    prev_value = HPX_MOVE(prev[i - 1]);
+
+                count_futures.push_back(
+                    async_segment<unique_segment_action<T, Data, Pred>>(
+                        pieces[i].partition_, pieces[i].local_first_,
+                        pieces[i].size_, prev_value, pred));
+            }
+
+            std::vector<std::size_t> const counts = get_all(count_futures);
+            std::vector<std::size_t> const offsets = get_offsets(counts);
+
+            // Close the gaps between the segments. The destination of a
+            // segment may overlap with the remaining elements of preceding
+            // segments, in which case those have to be moved first.
+            std::vector<hpx::shared_future<void>> moves(pieces.size());
+            for (std::size_t i = 0; i != pieces.size(); ++i)
+            {
+                std::size_t const dest = offsets[i];
+                std::size_t const count = counts[i];
+                if (count == 0 || dest == pieces[i].offset_)
+                {
+                    moves[i] = hpx::make_ready_future();
+                    continue;
+                }
+
+                std::vector<hpx::shared_future<void>> predecessors;
+                for (std::size_t j = 0; j != i; ++j)
+                {
+                    if (counts[j] != 0 && pieces[j].offset_ < dest + count &&
+                        dest < pieces[j].offset_ + counts[j])
+                    {
+                        predecessors.push_back(moves[j]);
+                    }
+                }
+
+                moves[i] = hpx::dataflow(
+                    [=, p = pieces[i], pos = first_index + dest](
+                        std::vector<hpx::shared_future<void>>&& preds) {
+                        for (auto& f : preds)
+                            f.get();    // propagate exceptions
+
+                        async_segment<move_segment_action<T, Data>>(
+                            p.partition_, p.local_first_, count,
+                            data->get_range_pieces(pos, pos + count))
+                            .get();
+                    },
+                    HPX_MOVE(predecessors));
+            }
+            wait_all_segments(moves);
+
+            return first + offsets.back();
+        }
+
+        template <typename T, typename Data, typename Pred>
+        vector_iterator<T, Data> partition(vector_iterator<T, Data> first,
+            vector_iterator<T, Data> last, Pred const& pred)
+        {
+            std::size_t const first_index = first.get_global_index();
+            std::size_t const last_index = last.get_global_index();
+            if (first_index == last_index)
+                return first;
+
+            partitioned_vector<T, Data>* data = first.get_data();
+            range_pieces const pieces =
+                data->get_range_pieces(first_index, last_index);
+
+            // partition each of the segments
+            std::vector<hpx::future<std::size_t>> count_futures;
+            count_futures.reserve(pieces.size());
+            for (auto const& p : pieces)
+            {
+                count_futures.push_back(
+                    async_segment<partition_segment_action<T, Data, Pred>>(
+                        p.partition_, p.local_first_, p.size_, pred));
+            }
+
+            std::vector<std::size_t> const counts = get_all(count_futures);
+            std::size_t const total =
+                std::accumulate(counts.begin(), counts.end(), std::size_t(0));
+
+            // Collect the elements not satisfying the predicate which are
+            // located before the partition point and the ones satisfying it
+            // which are located after it. Each of those ranges is part of a
+            // single segment.
+            struct misplaced
+            {
+                std::size_t piece;
+                std::size_t first;
+                std::size_t last;
+            };
+
+            std::vector<misplaced> left, right;
+            for (std::size_t i = 0; i != pieces.size(); ++i)
+            {
+                std::size_t const begin = pieces[i].offset_;
+                std::size_t const middle = begin + counts[i];
+                std::size_t const end = begin + pieces[i].size_;
+
+                if (middle < (std::min)(end, total))
+                    left.push_back({i, middle, (std::min)(end, total)});
+                if ((std::max)(begin, total) < middle)
+                    right.push_back({i, (std::max)(begin, total), middle});
+            }
+
+            // exchange the misplaced elements, all of the exchanged ranges
+            // are disjoint
+            std::vector<hpx::future<void>> swaps;
+            auto r = right.begin();
+            for (auto l = left.begin(); l != left.end();)
+            {
+                HPX_ASSERT(r != right.end());
+
+                std::size_t const count =
+                    (std::min)(l->last - l->first, r->last - r->first);
+
+                auto const& lp = pieces[l->piece];
+                auto const& rp = pieces[r->piece];
+                swaps.push_back(async_segment<swap_segments_action<T, Data>>(
+                    lp.partition_, lp.local_first_ + (l->first - lp.offset_),
+                    count, rp.partition_,
+                    rp.local_first_ + (r->first - rp.offset_)));
+
+                if ((l->first += count) == l->last)
+                    ++l;
+                if ((r->first += count) == r->last)
+                    ++r;
+            }
+            wait_all_segments(swaps);
+
+            return first + total;
+        }
+
+        // Return the number of elements taken from the first sequence when
+        // merging the first diag elements of both sequences
+        template <typename T, typename Data, typename Comp>
+        std::size_t merge_path(partitioned_vector<T, Data> const* data1,
+            std::size_t first1, std::size_t size1,
+            partitioned_vector<T, Data> const* data2, std::size_t first2,
+            std::size_t size2, std::size_t diag, Comp const& comp)
+        {
+            std::size_t lo = diag > size2 ? diag - size2 : 0;
+            std::size_t hi = (std::min)(diag, size1);
+            while (lo < hi)
+            {
+                std::size_t const i = lo + (hi - lo) / 2;
+                std::size_t const j = diag - i;
+
+                auto value1 = data1->get_value(first1 + i);
+                auto value2 = data2->get_value(first2 + j - 1);
+
+                // elements of the first sequence go first for equal keys
+                if (!comp(value2.get(), value1.get()))
+                    lo = i + 1;
+                else
+                    hi = i;
+            }
+            return lo;
+        }
+
+        template <typename SrcIter1, typename SrcIter2, typename T,
+            typename Data, typename Comp>
+        vector_iterator<T, Data> merge(SrcIter1 first1, SrcIter1 last1,
+            SrcIter2 first2, SrcIter2 last2, vector_iterator<T, Data> dest,
+            Comp const& comp)
+        {
+            std::size_t const first_index1 = first1.get_global_index();
+            std::size_t const size1 = last1.get_global_index() - first_index1;
+            std::size_t const first_index2 = first2.get_global_index();
+            std::size_t const size2 = last2.get_global_index() - first_index2;
+            if (size1 + size2 == 0)
+                return dest;
+
+            partitioned_vector<T, Data> const* data1 = first1.get_data();
+            partitioned_vector<T, Data> const* data2 = first2.get_data();
+
+            partitioned_vector<T, Data>* dest_data = dest.get_data();
+            std::size_t const dest_first = dest.get_global_index();
+            check_destination(
+                "hpx::merge", dest_data, dest_first, size1 + size2);
+
+            range_pieces const pieces = dest_data->get_range_pieces(
+                dest_first, dest_first + size1 + size2);
+
+            // find the split points of both inputs for each of the
+            // destination segments
+            std::vector<hpx::future<std::size_t>> split_futures;
+            split_futures.reserve(pieces.size());
+            split_futures.push_back(hpx::make_ready_future(std::size_t(0)));
+            for (std::size_t i = 1; i < pieces.size(); ++i)
+            {
+                split_futures.push_back(
+                    hpx::async([=, diag = pieces[i].offset_, &comp]() {
+                        return merge_path(data1, first_index1, size1, data2,
+                            first_index2, size2, diag, comp);
+                    }));
+            }
+
+            std::vector<std::size_t> splits = get_all(split_futures);
+            splits.push_back(size1);
+
+            // each destination segment pulls its inputs and merges them
+            std::vector<hpx::future<void>> merges;
+            merges.reserve(pieces.size());
+            for (std::size_t i = 0; i != pieces.size(); ++i)
+            {
+                std::size_t const begin1 = splits[i];
+                std::size_t const end1 = splits[i + 1];
+                std::size_t const begin2 = pieces[i].offset_ - begin1;
+                std::size_t const end2 =
+                    pieces[i].offset_ + pieces[i].size_ - end1;
+
+                range_pieces src1, src2;
+                if (begin1 != end1)
+                {
+                    src1 = data1->get_range_pieces(
+                        first_index1 + begin1, first_index1 + end1);
+                }
+                if (begin2 != end2)
+                {
+                    src2 = data2->get_range_pieces(
+                        first_index2 + begin2, first_index2 + end2);
+                }
+
+                merges.push_back(
+                    async_segment<merge_segment_action<T, Data, Comp>>(
+                        pieces[i].partition_, pieces[i].local_first_,
+                        pieces[i].size_, src1, src2, comp));
+            }
+            wait_all_segments(merges);
+
+            return dest + (size1 + size2);
+        }
+
+        // Run the given algorithm asynchronously for task policies
+        template <typename ExPolicy, typename R, typename F>
+        decltype(auto) invoke_with_policy(F&& f)
+        {
+            using result = hpx::parallel::util::detail::algorithm_result<
+                ExPolicy, R>;
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return result::get(hpx::async(HPX_FORWARD(F, f)));
+            }
+            else
+            {
+                return result::get(f());
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // clang-format off
+    template <typename SrcIter, typename T, typename Data, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            detail::is_vector_iterator_of<SrcIter, T, Data>::value
+        )>
+    // clang-format on
+    vector_iterator<T, Data> tag_invoke(hpx::copy_if_t, SrcIter first,
+        SrcIter last, vector_iterator<T, Data> dest, Pred pred)
+    {
+        return detail::copy_if(first, last, HPX_MOVE(dest), pred);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SrcIter, typename T, typename Data,
+        typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            detail::is_vector_iterator_of<SrcIter, T, Data>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+        vector_iterator<T, Data>>::type
+    tag_invoke(hpx::copy_if_t, ExPolicy&&, SrcIter first, SrcIter last,
+        vector_iterator<T, Data> dest, Pred pred)
+    {
+        return detail::invoke_with_policy<ExPolicy, vector_iterator<T, Data>>(
+            [=]() { return detail::copy_if(first, last, dest, pred); });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Data,
+        typename Pred = hpx::parallel::detail::equal_to>
+    vector_iterator<T, Data> tag_invoke(hpx::unique_t,
+        vector_iterator<T, Data> first, vector_iterator<T, Data> last,
+        Pred pred = Pred())
+    {
+        return detail::unique(HPX_MOVE(first), HPX_MOVE(last), pred);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename T, typename Data,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy>
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+        vector_iterator<T, Data>>::type
+    tag_invoke(hpx::unique_t, ExPolicy&&, vector_iterator<T, Data> first,
+        vector_iterator<T, Data> last, Pred pred = Pred())
+    {
+        return detail::invoke_with_policy<ExPolicy, vector_iterator<T, Data>>(
+            [=]() { return detail::unique(first, last, pred); });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The relative order of the elements is not preserved
+    template <typename T, typename Data, typename Pred>
+    vector_iterator<T, Data> tag_invoke(hpx::partition_t,
+        vector_iterator<T, Data> first, vector_iterator<T, Data> last,
+        Pred pred)
+    {
+        return detail::partition(HPX_MOVE(first), HPX_MOVE(last), pred);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename T, typename Data, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy>
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+        vector_iterator<T, Data>>::type
+    tag_invoke(hpx::partition_t, ExPolicy&&, vector_iterator<T, Data> first,
+        vector_iterator<T, Data> last, Pred pred)
+    {
+        return detail::invoke_with_policy<ExPolicy, vector_iterator<T, Data>>(
+            [=]() { return detail::partition(first, last, pred); });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // clang-format off
+    template <typename SrcIter1, typename SrcIter2, typename T, typename Data,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            detail::is_vector_iterator_of<SrcIter1, T, Data>::value &&
+            detail::is_vector_iterator_of<SrcIter2, T, Data>::value
+        )>
+    // clang-format on
+    vector_iterator<T, Data> tag_invoke(hpx::merge_t, SrcIter1 first1,
+        SrcIter1 last1, SrcIter2 first2, SrcIter2 last2,
+        vector_iterator<T, Data> dest, Comp comp = Comp())
+    {
+        return detail::merge(
+            first1, last1, first2, last2, HPX_MOVE(dest), comp);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SrcIter1, typename SrcIter2,
+        typename T, typename Data,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            detail::is_vector_iterator_of<SrcIter1, T, Data>::value &&
+            detail::is_vector_iterator_of<SrcIter2, T, Data>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+        vector_iterator<T, Data>>::type
+    tag_invoke(hpx::merge_t, ExPolicy&&, SrcIter1 first1, SrcIter1 last1,
+        SrcIter2 first2, SrcIter2 last2, vector_iterator<T, Data> dest,
+        Comp comp = Comp())
+    {
+        return detail::invoke_with_policy<ExPolicy, vector_iterator<T, Data>>(
+            [=]() {
+                return detail::merge(first1, last1, first2, last2, dest, comp);
+            });
+    }
+}    // namespace hpx::segmented
+/// \endcond
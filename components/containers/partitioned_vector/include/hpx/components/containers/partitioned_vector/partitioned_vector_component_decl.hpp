@@ -26,19 +26,63 @@
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_fwd.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
 namespace hpx { namespace server {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        template <typename T, typename Data>
+        struct is_contiguous_vector : std::false_type
+        {
+        };
+
+        template <typename T, typename Allocator>
+        struct is_contiguous_vector<T, std::vector<T, Allocator>>
+          : std::integral_constant<bool, !std::is_same_v<T, bool>>
+        {
+        };
+
+        // Create a buffer holding the elements [first, last) of the given
+        // data. If the data is a std::vector, the buffer refers to the
+        // elements directly (the data must be kept alive and unmodified as
+        // long as the buffer is in use), otherwise the elements are copied.
+        template <typename T, typename Data>
+        serialization::serialize_buffer<T> make_range_buffer(
+            Data const& data, std::size_t first, std::size_t last)
+        {
+            using buffer_type = serialization::serialize_buffer<T>;
+
+            if constexpr (is_contiguous_vector<T, Data>::value)
+            {
+                return buffer_type(
+                    data.data() + first, last - first, buffer_type::reference);
+            }
+            else
+            {
+                buffer_type buffer(last - first);
+                std::copy(data.begin() + first, data.begin() + last,
+                    buffer.data());
+                return buffer;
+            }
+        }
+    }    // namespace detail
+    /// \endcond
+
     /// \brief This is the basic wrapper class for stl vector.
     ///
     /// This contain the implementation of the partitioned_vector_partition's
@@ -177,6 +221,17 @@ namespace hpx { namespace server {
         ///
         std::vector<T> get_values(std::vector<size_type> const& pos) const;
 
+        /// Return the elements in the range [\a first, \a last) of the
+        /// partitioned_vector_partition container.
+        ///
+        /// \param first Position of the first element to return
+        /// \param last  Position one past the last element to return
+        ///
+        /// \return Return the values of the elements in the given range.
+        ///
+        serialization::serialize_buffer<T> get_range(
+            size_type first, size_type last) const;
+
         /// Access the value of first element in the partitioned_vector_partition.
         ///
         /// Calling the function on empty container cause undefined behavior.
@@ -243,6 +298,29 @@ namespace hpx { namespace server {
         void set_values(
             std::vector<size_type> const& pos, std::vector<T> const& val);
 
+        /// Copy the given values to the elements starting at position
+        /// \a first of the partitioned_vector_partition container.
+        ///
+        /// \param first Position of the first element to overwrite
+        /// \param val   The values to be copied
+        ///
+        void put_range(size_type first,
+            serialization::serialize_buffer<T> const& val);
+
+        /// Copy the elements in the range [\a first, \a last) of this
+        /// partitioned_vector_partition to the elements starting at position
+        /// \a dest_first of the partitioned_vector_partition \a dest. The
+        /// elements are sent directly to the destination using one message.
+        ///
+        /// \param first      Position of the first element to copy
+        /// \param last       Position one past the last element to copy
+        /// \param dest       The destination partitioned_vector_partition
+        /// \param dest_first Position of the first element to overwrite in
+        ///                   the destination
+        ///
+        void copy_range(size_type first, size_type last, id_type const& dest,
+            size_type dest_first) const;
+
         /// Remove all elements from the vector leaving the
         /// partitioned_vector_partition with size 0.
         ///
@@ -261,6 +339,7 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_range)
 
         // HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, front)
         // HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, back)
@@ -270,6 +349,8 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, put_range)
+        HPX_DEFINE_COMPONENT_ACTION(partitioned_vector, copy_range)
 
         // HPX_DEFINE_COMPONENT_ACTION(partitioned_vector_partition, clear)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_copied_data)
@@ -291,10 +372,16 @@ namespace hpx { namespace server {
         type::get_value_action, HPX_PP_CAT(__vector_get_value_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(type::get_values_action,                   \
         HPX_PP_CAT(__vector_get_values_action_, name))                         \
+    HPX_REGISTER_ACTION_DECLARATION(type::get_range_action,                    \
+        HPX_PP_CAT(__vector_get_range_action_, name))                          \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(type::set_values_action,                   \
         HPX_PP_CAT(__vector_set_values_action_, name))                         \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        type::put_range_action, HPX_PP_CAT(__vector_put_range_action_, name))  \
+    HPX_REGISTER_ACTION_DECLARATION(type::copy_range_action,                   \
+        HPX_PP_CAT(__vector_copy_range_action_, name))                         \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         type::size_action, HPX_PP_CAT(__vector_size_action_, name))            \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
@@ -457,6 +544,28 @@ namespace hpx {
         future<std::vector<T>> get_values(
             std::vector<std::size_t> const& pos) const;
 
+        /// Return the elements in the range [\a first, \a last) of the
+        /// partitioned_vector_partition component using a single message.
+        ///
+        /// \param first Position of the first element to return
+        /// \param last  Position one past the last element to return
+        ///
+        /// \return Returns the values of the elements in the given range
+        ///
+        serialization::serialize_buffer<T> get_range(
+            launch::sync_policy, std::size_t first, std::size_t last) const;
+
+        /// Return the elements in the range [\a first, \a last) of the
+        /// partitioned_vector_partition component using a single message.
+        ///
+        /// \param first Position of the first element to return
+        /// \param last  Position one past the last element to return
+        ///
+        /// \return This returns the values as an hpx::future
+        ///
+        future<serialization::serialize_buffer<T>> get_range(
+            std::size_t first, std::size_t last) const;
+
         // future<T> front_async() const
         // {
         //     HPX_ASSERT(this->get_id());
@@ -539,6 +648,41 @@ namespace hpx {
         future<void> set_values(
             std::vector<std::size_t> const& pos, std::vector<T> const& val);
 
+        /// Copy the given values to the elements starting at position
+        /// \a first of the partitioned_vector_partition component using a
+        /// single message.
+        ///
+        /// \param first Position of the first element to overwrite
+        /// \param val   The values to be copied
+        ///
+        void put_range(launch::sync_policy, std::size_t first,
+            serialization::serialize_buffer<T> const& val);
+
+        /// Copy the given values to the elements starting at position
+        /// \a first of the partitioned_vector_partition component using a
+        /// single message.
+        ///
+        /// \param first Position of the first element to overwrite
+        /// \param val   The values to be copied, a buffer referring to
+        ///              external data must be kept alive until the returned
+        ///              future becomes ready
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        future<void> put_range(
+            std::size_t first, serialization::serialize_buffer<T> const& val);
+
+        /// Copy the elements in the range [\a first, \a last) of this
+        /// partitioned_vector_partition component to the elements starting
+        /// at position \a dest_first of the partitioned_vector_partition
+        /// \a dest. The elements are sent directly from this component to
+        /// the destination.
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        future<void> copy_range(std::size_t first, std::size_t last,
+            id_type const& dest, std::size_t dest_first) const;
+
         //         void clear()
         //         {
         //             HPX_ASSERT(this->get_id());
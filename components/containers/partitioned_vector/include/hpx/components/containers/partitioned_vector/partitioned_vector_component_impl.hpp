@@ -23,6 +23,7 @@
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string>
@@ -209,6 +210,23 @@ namespace hpx { namespace server {
         return result;
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        serialization::serialize_buffer<T>
+        partitioned_vector<T, Data>::get_range(
+            size_type first, size_type last) const
+    {
+        HPX_ASSERT(first <= last);
+        HPX_ASSERT(last <= partitioned_vector_partition_.size());
+
+        // the elements are copied as the data may change before the result
+        // has been sent
+        serialization::serialize_buffer<T> result(last - first);
+        std::copy(partitioned_vector_partition_.begin() + first,
+            partitioned_vector_partition_.begin() + last, result.data());
+        return result;
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT T
     partitioned_vector<T, Data>::front() const
@@ -264,6 +282,33 @@ namespace hpx { namespace server {
             partitioned_vector_partition_[pos[i]] = val[i];
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::put_range(
+        size_type first, serialization::serialize_buffer<T> const& val)
+    {
+        HPX_ASSERT(first + val.size() <= partitioned_vector_partition_.size());
+
+        std::copy(val.begin(), val.end(),
+            partitioned_vector_partition_.begin() + first);
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::copy_range(size_type first, size_type last,
+        id_type const& dest, size_type dest_first) const
+    {
+        HPX_ASSERT(first <= last);
+        HPX_ASSERT(last <= partitioned_vector_partition_.size());
+
+        // the buffer may refer to the data of this partition, thus we wait
+        // for the operation to finish
+        hpx::async<put_range_action>(dest, dest_first,
+            detail::make_range_buffer<T>(
+                partitioned_vector_partition_, first, last))
+            .get();
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::clear()
@@ -286,10 +331,16 @@ namespace hpx { namespace server {
         type::get_value_action, HPX_PP_CAT(__vector_get_value_action_, name))  \
     HPX_REGISTER_ACTION(type::get_values_action,                               \
         HPX_PP_CAT(__vector_get_values_action_, name))                         \
+    HPX_REGISTER_ACTION(                                                       \
+        type::get_range_action, HPX_PP_CAT(__vector_get_range_action_, name))  \
     HPX_REGISTER_ACTION(                                                       \
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name))  \
     HPX_REGISTER_ACTION(type::set_values_action,                               \
         HPX_PP_CAT(__vector_set_values_action_, name))                         \
+    HPX_REGISTER_ACTION(                                                       \
+        type::put_range_action, HPX_PP_CAT(__vector_put_range_action_, name))  \
+    HPX_REGISTER_ACTION(type::copy_range_action,                               \
+        HPX_PP_CAT(__vector_copy_range_action_, name))                         \
     HPX_REGISTER_ACTION(                                                       \
         type::size_action, HPX_PP_CAT(__vector_size_action_, name))            \
     HPX_REGISTER_ACTION(                                                       \
@@ -435,6 +486,33 @@ namespace hpx {
 #endif
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        serialization::serialize_buffer<T>
+        partitioned_vector_partition<T, Data>::get_range(
+            launch::sync_policy, std::size_t first, std::size_t last) const
+    {
+        return get_range(first, last).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        hpx::future<serialization::serialize_buffer<T>>
+        partitioned_vector_partition<T, Data>::get_range(
+            std::size_t first, std::size_t last) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::get_range_action>(
+            this->get_id(), first, last);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(last);
+        return hpx::make_ready_future(serialization::serialize_buffer<T>{});
+#endif
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector_partition<T, Data>::set_value(
@@ -509,6 +587,50 @@ namespace hpx {
 #endif
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector_partition<T, Data>::put_range(launch::sync_policy,
+        std::size_t first, serialization::serialize_buffer<T> const& val)
+    {
+        put_range(first, val).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::put_range(
+        std::size_t first, serialization::serialize_buffer<T> const& val)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::put_range_action>(
+            this->get_id(), first, val);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(val);
+        return hpx::make_ready_future();
+#endif
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::copy_range(std::size_t first,
+        std::size_t last, id_type const& dest, std::size_t dest_first) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::copy_range_action>(
+            this->get_id(), first, last, dest, dest_first);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(last);
+        HPX_UNUSED(dest);
+        HPX_UNUSED(dest_first);
+        return hpx::make_ready_future();
+#endif
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
         typename partitioned_vector_partition<T, Data>::server_type::data_type
@@ -0,0 +1,108 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/partitioned_vector/partitioned_vector_copy.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/parallel/algorithms/copy.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_segmented_iterator.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/// \cond NOINTERNAL
+namespace hpx::segmented {
+
+    namespace detail {
+
+        template <typename Iter, typename T, typename Data>
+        struct is_vector_iterator_of : std::false_type
+        {
+        };
+
+        template <typename T, typename Data>
+        struct is_vector_iterator_of<vector_iterator<T, Data>, T, Data>
+          : std::true_type
+        {
+        };
+
+        template <typename T, typename Data>
+        struct is_vector_iterator_of<const_vector_iterator<T, Data>, T, Data>
+          : std::true_type
+        {
+        };
+
+        // Copy the elements of the range [first, last) into the destination
+        // using one bulk transfer for each pair of overlapping source and
+        // destination segments. Both vectors may have different
+        // distributions.
+        template <typename SrcIter, typename T, typename Data>
+        hpx::future<vector_iterator<T, Data>> copy_range(
+            SrcIter first, SrcIter last, vector_iterator<T, Data> dest)
+        {
+            std::size_t const first_index = first.get_global_index();
+            std::size_t const count = last.get_global_index() - first_index;
+
+            if (count == 0)
+                return hpx::make_ready_future(HPX_MOVE(dest));
+
+            return first.get_data()
+                ->copy_range(first_index, first_index + count,
+                    *dest.get_data(), dest.get_global_index())
+                .then(hpx::launch::sync,
+                    [dest, count](hpx::future<void>&& f) mutable
+                    -> vector_iterator<T, Data> {
+                        f.get();    // propagate exceptions
+                        return dest + count;
+                    });
+        }
+    }    // namespace detail
+
+    // Copying between two partitioned_vectors does not have to go through
+    // the calling locality, the elements are directly sent from the source
+    // to the destination segments.
+
+    // clang-format off
+    template <typename SrcIter, typename T, typename Data,
+        HPX_CONCEPT_REQUIRES_(
+            detail::is_vector_iterator_of<SrcIter, T, Data>::value
+        )>
+    // clang-format on
+    vector_iterator<T, Data> tag_invoke(hpx::copy_t, SrcIter first,
+        SrcIter last, vector_iterator<T, Data> dest)
+    {
+        return detail::copy_range(first, last, HPX_MOVE(dest)).get();
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SrcIter, typename T, typename Data,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            detail::is_vector_iterator_of<SrcIter, T, Data>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+        vector_iterator<T, Data>>::type
+    tag_invoke(hpx::copy_t, ExPolicy&&, SrcIter first, SrcIter last,
+        vector_iterator<T, Data> dest)
+    {
+        using result = hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            vector_iterator<T, Data>>;
+
+        return result::get(
+            detail::copy_range(first, last, HPX_MOVE(dest)));
+    }
+}    // namespace hpx::segmented
+/// \endcond
@@ -23,6 +23,7 @@
 #include <hpx/runtime_components/distributed_metadata_base.hpp>
 #include <hpx/runtime_components/new.hpp>
 #include <hpx/runtime_distributed/copy_component.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
 
 #include <hpx/components/containers/partitioned_vector/export_definitions.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
@@ -108,6 +109,27 @@ namespace hpx::server {
             ar& size_& partitions_;
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The part of a global index range which is located in a single partition
+    struct partitioned_vector_range_piece
+    {
+        hpx::id_type partition_;
+        std::size_t local_first_ = 0;    // local index of the first element
+        std::size_t offset_ = 0;         // position inside the global range
+        std::size_t size_ = 0;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & partition_ & local_first_ & offset_ & size_;
+            // clang-format on
+        }
+    };
 }    // namespace hpx::server
 
 HPX_DISTRIBUTED_METADATA_DECLARATION(
@@ -217,6 +239,11 @@ namespace hpx {
         size_type size_;              // overall size of the vector
         size_type partition_size_;    // cached partition size
 
+        // The global index of the first element of each partition (and the
+        // overall size as the last entry). This is empty if all partitions
+        // (except the last one) hold partition_size_ elements.
+        std::vector<size_type> partition_offsets_;
+
         // This is the vector representing the base_index and corresponding
         // global ID's of the underlying partitioned_vector_partitions.
         partitions_vector_type partitions_;
@@ -254,10 +281,16 @@ namespace hpx {
         friend class segmented::const_segment_vector_iterator<T, Data,
             typename partitions_vector_type::const_iterator>;
 
+        friend class partitioned_vector_halo<T, Data>;
+
         std::size_t get_partition_size() const;
         std::size_t get_global_index(std::size_t segment, std::size_t part_size,
             size_type local_index) const;
 
+        // Update the cached partition size and partition offsets from the
+        // sizes of the partitions
+        void update_partition_layout();
+
         ///////////////////////////////////////////////////////////////////////
         // Connect this vector to the existing vector using the given symbolic
         // name.
@@ -349,7 +382,7 @@ namespace hpx {
         // This function is called when we are creating the vector. It
         // initializes the partitions based on the give parameters.
         template <typename DistPolicy, typename Create>
-        void create(DistPolicy const& policy, Create&& creator);
+        void create(DistPolicy const& policy, Create&& creator, T const& val);
 
         template <typename DistPolicy>
         void create(DistPolicy const& policy);
@@ -357,6 +390,16 @@ namespace hpx {
         template <typename DistPolicy>
         void create(T const& val, DistPolicy const& policy);
 
+        // Initialize the partitions from the given (empty) components, using
+        // the given partition sizes
+        void create_sized(hpx::future<std::vector<bulk_locality_result>>&& f,
+            std::vector<std::size_t> const& sizes, T const& val);
+
+        // Move the elements of this vector to the given new partitions
+        hpx::future<void> redistribute_helper(
+            hpx::future<std::vector<bulk_locality_result>>&& f,
+            std::vector<std::size_t>&& sizes);
+
         // Perform a deep copy from the given vector
         void copy_from(partitioned_vector const& rhs);
 
@@ -429,6 +472,7 @@ namespace hpx {
           : base_type(HPX_MOVE(rhs))
           , size_(rhs.size_)
           , partition_size_(rhs.partition_size_)
+          , partition_offsets_(HPX_MOVE(rhs.partition_offsets_))
           , partitions_(HPX_MOVE(rhs.partitions_))
         {
             rhs.size_ = 0;
@@ -487,6 +531,7 @@ namespace hpx {
 
                 size_ = rhs.size_;
                 partition_size_ = rhs.partition_size_;
+                partition_offsets_ = HPX_MOVE(rhs.partition_offsets_);
                 partitions_ = HPX_MOVE(rhs.partitions_);
 
                 rhs.size_ = 0;
@@ -1046,6 +1091,374 @@ namespace hpx {
             return set_values(pos, val).get();
         }
 
+    private:
+        // Invoke f(part, local_index, offset, count) for each piece of the
+        // global range [first, first + count) located in a single segment
+        template <typename F>
+        void for_each_piece(size_type first, size_type count, F&& f) const
+        {
+            size_type offset = 0;
+            while (offset != count)
+            {
+                size_type const part = get_partition(first + offset);
+                size_type const local = get_local_index(first + offset);
+                size_type const n = (std::min)(
+                    count - offset, partitions_[part].size_ - local);
+
+                HPX_ASSERT(n != 0);
+                f(part, local, offset, n);
+                offset += n;
+            }
+        }
+
+        void check_range(char const* name, size_type first,
+            size_type last) const
+        {
+            if (first > last || last > size_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter, name,
+                    "invalid range [{}, {}) for a partitioned_vector of "
+                    "size {}",
+                    first, last, size_);
+            }
+        }
+
+    public:
+        /// Asynchronously returns the values of the elements in the range
+        /// [\a first, \a last) of the vector container. The elements are
+        /// fetched using one bulk transfer for each of the segments
+        /// overlapping with the given range.
+        ///
+        /// \param first Global position of the first element
+        /// \param last  Global position one past the last element
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the given range.
+        ///
+        future<std::vector<T>> get_range(size_type first, size_type last) const
+        {
+            check_range("partitioned_vector::get_range", first, last);
+
+            auto result = std::make_shared<std::vector<T>>(last - first);
+
+            std::vector<future<void>> part_futures;
+            for_each_piece(first, last - first,
+                [&](size_type part, size_type local, size_type offset,
+                    size_type n) {
+                    partition_data const& part_data = partitions_[part];
+                    if (part_data.local_data_)
+                    {
+                        auto const it =
+                            part_data.local_data_->get_data().begin() + local;
+                        std::copy(it, it + n, result->begin() + offset);
+                        return;
+                    }
+
+                    part_futures.push_back(
+                        partitioned_vector_partition_client(
+                            part_data.partition_)
+                            .get_range(local, local + n)
+                            .then(hpx::launch::sync,
+                                [result, offset](
+                                    future<serialization::serialize_buffer<T>>&&
+                                        f) -> void {
+                                    auto&& values = f.get();
+                                    std::copy(values.begin(), values.end(),
+                                        result->begin() + offset);
+                                }));
+                });
+
+            return hpx::when_all(part_futures)
+                .then(hpx::launch::sync,
+                    [result](future<std::vector<future<void>>>&& f)
+                        -> std::vector<T> {
+                        for (auto&& part_future : f.get())
+                            part_future.get();    // propagate exceptions
+                        return HPX_MOVE(*result);
+                    });
+        }
+
+        /// Returns the values of the elements in the range
+        /// [\a first, \a last) of the vector container.
+        ///
+        /// \param first Global position of the first element
+        /// \param last  Global position one past the last element
+        ///
+        /// \return Returns the values of the elements in the given range.
+        ///
+        std::vector<T> get_range(
+            launch::sync_policy, size_type first, size_type last) const
+        {
+            return get_range(first, last).get();
+        }
+
+        /// Asynchronously copy the values of \a val to the elements starting
+        /// at the global position \a first of the vector container. The
+        /// elements are sent using one bulk transfer for each of the segments
+        /// overlapping with the given range.
+        ///
+        /// \param first Global position of the first element to overwrite
+        /// \param val   The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> put_range(size_type first, std::vector<T> val)
+        {
+            check_range("partitioned_vector::put_range", first,
+                first + val.size());
+
+            // the buffers sent to remote segments refer to the values
+            auto values = std::make_shared<std::vector<T>>(HPX_MOVE(val));
+
+            std::vector<future<void>> part_futures;
+            for_each_piece(first, values->size(),
+                [&](size_type part, size_type local, size_type offset,
+                    size_type n) {
+                    partition_data const& part_data = partitions_[part];
+                    if (part_data.local_data_)
+                    {
+                        auto const it = values->begin() + offset;
+                        std::copy(it, it + n,
+                            part_data.local_data_->get_data().begin() + local);
+                        return;
+                    }
+
+                    using buffer_type = serialization::serialize_buffer<T>;
+                    part_futures.push_back(
+                        partitioned_vector_partition_client(
+                            part_data.partition_)
+                            .put_range(local,
+                                buffer_type(values->data() + offset, n,
+                                    buffer_type::reference))
+                            .then(hpx::launch::sync,
+                                [values](future<void>&& f) -> void {
+                                    f.get();
+                                }));
+                });
+
+            return hpx::when_all(part_futures);
+        }
+
+        /// Copy the values of \a val to the elements starting at the global
+        /// position \a first of the vector container.
+        ///
+        /// \param first Global position of the first element to overwrite
+        /// \param val   The values to be copied
+        ///
+        void put_range(
+            launch::sync_policy, size_type first, std::vector<T> const& val)
+        {
+            put_range(first, val).get();
+        }
+
+        /// Asynchronously copy the elements in the range [\a first, \a last)
+        /// of this vector container to the elements starting at the global
+        /// position \a dest_first of the vector container \a dest. Both
+        /// vectors may have different distributions. The elements of each
+        /// pair of overlapping source and destination segments are
+        /// transferred directly between the localities holding the segments
+        /// using a single message.
+        ///
+        /// \param first      Global position of the first element to copy
+        /// \param last       Global position one past the last element to
+        ///                   copy
+        /// \param dest       The destination vector container
+        /// \param dest_first Global position of the first element to
+        ///                   overwrite in the destination
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        /// \note The source elements must not be modified and both vectors
+        ///       must be kept alive until the returned future becomes ready.
+        ///
+        future<void> copy_range(size_type first, size_type last,
+            partitioned_vector& dest, size_type dest_first) const
+        {
+            check_range("partitioned_vector::copy_range", first, last);
+            dest.check_range("partitioned_vector::copy_range", dest_first,
+                dest_first + (last - first));
+
+            std::vector<future<void>> part_futures;
+            for_each_piece(first, last - first,
+                [&](size_type part, size_type local, size_type offset,
+                    size_type count) {
+                    partition_data const& src = partitions_[part];
+                    dest.for_each_piece(dest_first + offset, count,
+                        [&](size_type dest_part, size_type dest_local,
+                            size_type dest_offset, size_type n) {
+                            partition_data const& dst =
+                                dest.partitions_[dest_part];
+                            size_type const src_local = local + dest_offset;
+
+                            if (src.local_data_ && dst.local_data_)
+                            {
+                                auto const it =
+                                    src.local_data_->get_data().begin() +
+                                    src_local;
+                                std::copy(it, it + n,
+                                    dst.local_data_->get_data().begin() +
+                                        dest_local);
+                            }
+                            else if (src.local_data_)
+                            {
+                                part_futures.push_back(
+                                    partitioned_vector_partition_client(
+                                        dst.partition_)
+                                        .put_range(dest_local,
+                                            server::detail::make_range_buffer<
+                                                T>(
+                                                src.local_data_->get_data(),
+                                                src_local, src_local + n)));
+                            }
+                            else if (dst.local_data_)
+                            {
+                                part_futures.push_back(
+                                    partitioned_vector_partition_client(
+                                        src.partition_)
+                                        .get_range(src_local, src_local + n)
+                                        .then(hpx::launch::sync,
+                                            [data = dst.local_data_,
+                                                dest_local](
+                                                future<serialization::
+                                                        serialize_buffer<T>>&&
+                                                    f) -> void {
+                                                auto&& values = f.get();
+                                                std::copy(values.begin(),
+                                                    values.end(),
+                                                    data->get_data().begin() +
+                                                        dest_local);
+                                            }));
+                            }
+                            else
+                            {
+                                part_futures.push_back(
+                                    partitioned_vector_partition_client(
+                                        src.partition_)
+                                        .copy_range(src_local, src_local + n,
+                                            dst.partition_, dest_local));
+                            }
+                        });
+                });
+
+            return hpx::when_all(part_futures);
+        }
+
+        /// \cond NOINTERNAL
+        // Return the partitions and local indices covered by the global range
+        // [first, last), one entry for each partition.
+        std::vector<server::partitioned_vector_range_piece> get_range_pieces(
+            size_type first, size_type last) const
+        {
+            check_range("partitioned_vector::get_range_pieces", first, last);
+
+            std::vector<server::partitioned_vector_range_piece> pieces;
+            for_each_piece(first, last - first,
+                [&](size_type part, size_type local, size_type offset,
+                    size_type n) {
+                    pieces.push_back(server::partitioned_vector_range_piece{
+                        partitions_[part].partition_, local, offset, n});
+                });
+            return pieces;
+        }
+        /// \endcond
+
+        /// Copy the elements in the range [\a first, \a last) of this
+        /// vector container to the elements starting at the global position
+        /// \a dest_first of the vector container \a dest.
+        ///
+        void copy_range(launch::sync_policy, size_type first, size_type last,
+            partitioned_vector& dest, size_type dest_first) const
+        {
+            copy_range(first, last, dest, dest_first).get();
+        }
+
+        /// Asynchronously redistribute the elements of this vector according
+        /// to the given distribution policy. This allows to rebalance the
+        /// vector without rebuilding it, for instance using a
+        /// hpx::throughput_distribution_policy once the throughput of the
+        /// localities has been measured.
+        ///
+        /// New partitions are created as specified by the policy, and the
+        /// elements are moved from the old to the new partitions in
+        /// parallel, using one bulk transfer (directly between the involved
+        /// localities) for each pair of overlapping old and new partitions.
+        ///
+        /// \param policy The distribution policy describing the new number,
+        ///               placement, and sizes of the partitions
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once all elements have been moved.
+        ///
+        /// \note The vector must not be accessed before the returned future
+        ///       has become ready. All iterators and views referring to this
+        ///       vector are invalidated. Vectors which have been registered
+        ///       (see register_as()) or connected to a registered vector (see
+        ///       connect_to()) can't be redistributed, as the other instances
+        ///       sharing the same partitions could not be updated.
+        ///
+        template <typename DistPolicy>
+        future<void> redistribute(DistPolicy const& policy)
+        {
+            static_assert(traits::is_distribution_policy_v<DistPolicy>,
+                "redistribute requires a distribution policy");
+
+            if (this->base_type::valid())
+            {
+                return hpx::make_exceptional_future<void>(HPX_GET_EXCEPTION(
+                    hpx::error::invalid_status,
+                    "partitioned_vector::redistribute",
+                    "a registered partitioned_vector can't be redistributed"));
+            }
+
+            if (size_ == 0)
+                return make_ready_future();
+
+            std::size_t const num_parts =
+                traits::num_container_partitions<DistPolicy>::call(policy);
+
+            std::vector<std::size_t> sizes =
+                traits::container_partition_sizes<DistPolicy>::call(
+                    policy, size_);
+            if (sizes.empty())
+            {
+                // distribute the elements evenly
+                std::size_t const part_size =
+                    (size_ + num_parts - 1) / num_parts;
+
+                sizes.reserve(num_parts);
+                for (std::size_t allocated = 0, i = 0; i != num_parts; ++i)
+                {
+                    sizes.push_back(
+                        (std::min)(part_size, size_ - allocated));
+                    allocated += sizes.back();
+                }
+            }
+
+            // create the new partitions, those are resized once created
+            using component_type =
+                typename partitioned_vector_partition_client::
+                    server_component_type;
+
+            return redistribute_helper(
+                policy.template bulk_create<component_type>(
+                    num_parts, std::size_t(0)),
+                HPX_MOVE(sizes));
+        }
+
+        /// Redistribute the elements of this vector according to the given
+        /// distribution policy.
+        ///
+        /// \param policy The distribution policy describing the new number,
+        ///               placement, and sizes of the partitions
+        ///
+        template <typename DistPolicy>
+        void redistribute(launch::sync_policy, DistPolicy const& policy)
+        {
+            redistribute(policy).get();
+        }
+
         // //CLEAR
         // //TODO if number of partitions is kept constant every time then
         // // clear should modified (clear each partitioned_vector_partition
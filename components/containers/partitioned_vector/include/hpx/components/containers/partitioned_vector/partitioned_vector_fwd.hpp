@@ -18,6 +18,9 @@ namespace hpx
     template <typename T, typename Data = std::vector<T>>
     class partitioned_vector;
 
+    template <typename T, typename Data = std::vector<T>>
+    class partitioned_vector_halo;
+
     namespace segmented {
 
         template <typename T, typename Data> class local_vector_iterator;
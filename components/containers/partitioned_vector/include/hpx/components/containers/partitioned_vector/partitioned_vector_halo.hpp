@@ -0,0 +1,290 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/partitioned_vector/partitioned_vector_halo.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    /// hpx::partitioned_vector_halo maintains ghost regions (halos) for the
+    /// segments of a hpx::partitioned_vector which are located on the calling
+    /// locality.
+    ///
+    /// For each local segment, the left ghost region holds a copy of the last
+    /// \a width elements of the preceding segment and the right ghost region
+    /// holds a copy of the first \a width elements of the following segment.
+    /// If the halo is not periodic, the first segment has no left and the
+    /// last segment has no right ghost region (the corresponding ghost
+    /// regions are empty).
+    ///
+    /// The ghost regions are refreshed asynchronously using exactly one bulk
+    /// transfer per pair of neighboring segments, which allows to overlap the
+    /// exchange with computations on the interior of the local segments. For
+    /// multidimensional data stored in row-major order (e.g. one or more rows
+    /// of a 2D grid per segment), the ghost width is given by the number of
+    /// elements in the boundary rows.
+    ///
+    /// \note The data of the neighboring segments must not be modified while
+    ///       the ghost regions are being refreshed, and the ghost regions must
+    ///       not be accessed before the refresh has finished.
+    ///
+    /// \tparam T     The type of the elements of the partitioned_vector
+    /// \tparam Data  The type of the data of each of the segments
+    ///
+    template <typename T, typename Data>
+    class partitioned_vector_halo
+    {
+    public:
+        using vector_type = hpx::partitioned_vector<T, Data>;
+        using data_type = Data;
+        using ghost_type = std::vector<T>;
+
+    private:
+        using partition_server = hpx::server::partitioned_vector<T, Data>;
+        using partition_client = hpx::partitioned_vector_partition<T, Data>;
+
+        // the range of elements of a neighboring segment to copy
+        struct source
+        {
+            hpx::id_type partition_;
+            std::shared_ptr<partition_server> local_data_;
+            std::size_t first_ = 0;
+        };
+
+        struct segment
+        {
+            std::size_t partition_ = 0;    // global segment number
+            std::shared_ptr<partition_server> local_data_;
+
+            source left_source_;
+            source right_source_;
+
+            ghost_type left_;
+            ghost_type right_;
+        };
+
+    public:
+        /// Create the ghost regions of the given \a width for all segments
+        /// of the given partitioned_vector located on this locality.
+        ///
+        /// \param v        The partitioned_vector to create the halo for
+        /// \param width    The number of elements in each ghost region, this
+        ///                 must not be larger than the size of any neighboring
+        ///                 segment.
+        /// \param periodic Whether the first and last segments are neighbors
+        ///
+        /// \note The partitioned_vector must not be resized while the halo
+        ///       is in use.
+        ///
+        partitioned_vector_halo(
+            vector_type const& v, std::size_t width, bool periodic = false)
+          : width_(width)
+          , periodic_(periodic)
+        {
+            auto const& partitions = v.partitions_;
+            std::size_t const num_partitions = partitions.size();
+
+            auto const make_source = [&](std::size_t part, bool last_elements) {
+                auto const& p = partitions[part];
+                if (p.size_ < width_)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "partitioned_vector_halo::partitioned_vector_halo",
+                        "the ghost region width ({}) exceeds the size of "
+                        "segment {} ({})",
+                        width_, part, p.size_);
+                }
+                return source{p.partition_, p.local_data_,
+                    last_elements ? p.size_ - width_ : 0};
+            };
+
+            std::uint32_t const this_locality = hpx::get_locality_id();
+            for (std::size_t i = 0; i != num_partitions; ++i)
+            {
+                auto const& p = partitions[i];
+                if (p.locality_id_ != this_locality)
+                    continue;
+
+                HPX_ASSERT(p.local_data_);
+
+                segment s;
+                s.partition_ = i;
+                s.local_data_ = p.local_data_;
+
+                if (i != 0 || (periodic_ && num_partitions != 0))
+                {
+                    s.left_source_ = make_source(
+                        i != 0 ? i - 1 : num_partitions - 1, true);
+                    s.left_.resize(width_);
+                }
+                if (i + 1 != num_partitions || periodic_)
+                {
+                    s.right_source_ = make_source(
+                        i + 1 != num_partitions ? i + 1 : 0, false);
+                    s.right_.resize(width_);
+                }
+
+                segments_.push_back(HPX_MOVE(s));
+            }
+        }
+
+        partitioned_vector_halo(partitioned_vector_halo const&) = delete;
+        partitioned_vector_halo(partitioned_vector_halo&&) = default;
+        partitioned_vector_halo& operator=(
+            partitioned_vector_halo const&) = delete;
+        partitioned_vector_halo& operator=(partitioned_vector_halo&&) = default;
+
+        /// Return the number of elements in each ghost region
+        std::size_t width() const noexcept
+        {
+            return width_;
+        }
+
+        /// Return whether the first and last segments are neighbors
+        bool periodic() const noexcept
+        {
+            return periodic_;
+        }
+
+        /// Return the number of segments located on this locality
+        std::size_t size() const noexcept
+        {
+            return segments_.size();
+        }
+
+        /// Return the (global) sequence number of the i-th local segment
+        std::size_t get_partition(std::size_t i) const
+        {
+            HPX_ASSERT(i < segments_.size());
+            return segments_[i].partition_;
+        }
+
+        /// Return the data of the i-th local segment
+        data_type& data(std::size_t i)
+        {
+            HPX_ASSERT(i < segments_.size());
+            return segments_[i].local_data_->get_data();
+        }
+
+        data_type const& data(std::size_t i) const
+        {
+            HPX_ASSERT(i < segments_.size());
+            return segments_[i].local_data_->get_data();
+        }
+
+        /// Return the left ghost region of the i-th local segment (a copy of
+        /// the last elements of the preceding segment)
+        ghost_type const& left(std::size_t i) const
+        {
+            HPX_ASSERT(i < segments_.size());
+            return segments_[i].left_;
+        }
+
+        /// Return the right ghost region of the i-th local segment (a copy of
+        /// the first elements of the following segment)
+        ghost_type const& right(std::size_t i) const
+        {
+            HPX_ASSERT(i < segments_.size());
+            return segments_[i].right_;
+        }
+
+        /// Asynchronously refresh the ghost regions of the i-th local segment
+        ///
+        /// \returns A future which becomes ready once both ghost regions of
+        ///          the segment have been updated. The halo object must be
+        ///          kept alive until then.
+        ///
+        hpx::future<void> refresh(std::size_t i)
+        {
+            HPX_ASSERT(i < segments_.size());
+
+            segment& s = segments_[i];
+
+            std::vector<hpx::future<void>> transfers;
+            transfers.reserve(2);
+
+            if (!s.left_.empty())
+                transfers.push_back(fetch(s.left_source_, s.left_));
+            if (!s.right_.empty())
+                transfers.push_back(fetch(s.right_source_, s.right_));
+
+            return hpx::when_all(transfers);
+        }
+
+        /// Asynchronously refresh the ghost regions of all local segments
+        ///
+        /// \returns A future which becomes ready once all ghost regions have
+        ///          been updated. The halo object must be kept alive until
+        ///          then.
+        ///
+        hpx::future<void> refresh()
+        {
+            std::vector<hpx::future<void>> transfers;
+            transfers.reserve(segments_.size());
+
+            for (std::size_t i = 0; i != segments_.size(); ++i)
+            {
+                transfers.push_back(refresh(i));
+            }
+
+            return hpx::when_all(transfers);
+        }
+
+        /// Refresh the ghost regions of all local segments
+        void refresh(launch::sync_policy)
+        {
+            refresh().get();
+        }
+
+    private:
+        hpx::future<void> fetch(source const& src, ghost_type& ghost)
+        {
+            // copy directly if the neighboring segment is local
+            if (src.local_data_)
+            {
+                auto const& data = src.local_data_->get_data();
+
+                auto const first = data.begin() + src.first_;
+                std::copy(first, first + ghost.size(), ghost.begin());
+
+                return hpx::make_ready_future();
+            }
+
+            return partition_client(src.partition_)
+                .get_range(src.first_, src.first_ + ghost.size())
+                .then(hpx::launch::sync,
+                    [&ghost](hpx::future<serialization::serialize_buffer<T>>&&
+                                 f) -> void {
+                        auto&& values = f.get();
+                        HPX_ASSERT(values.size() == ghost.size());
+                        std::copy(values.begin(), values.end(), ghost.begin());
+                    });
+        }
+
+        std::size_t width_;
+        bool periodic_;
+        std::vector<segment> segments_;
+    };
+}    // namespace hpx
@@ -55,9 +55,42 @@ namespace hpx {
     partitioned_vector<T, Data>::get_global_index(
         std::size_t segment, std::size_t part_size, size_type local_index) const
     {
+        if (!partition_offsets_.empty())
+            return partition_offsets_[segment] + local_index;
+
         return segment * part_size + local_index;
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::update_partition_layout()
+    {
+        partition_size_ = get_partition_size();
+        partition_offsets_.clear();
+
+        // the global index of an element can be computed directly if all
+        // partitions (except the last one) have the same size
+        std::size_t const num_parts = partitions_.size();
+        for (std::size_t i = 0; i + 1 < num_parts; ++i)
+        {
+            if (partitions_[i].size_ != partition_size_)
+            {
+                partition_offsets_.reserve(num_parts + 1);
+
+                std::size_t offset = 0;
+                for (partition_data const& p : partitions_)
+                {
+                    partition_offsets_.push_back(offset);
+                    offset += p.size_;
+                }
+                partition_offsets_.push_back(offset);
+
+                HPX_ASSERT(offset == size_);
+                break;
+            }
+        }
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::get_data_helper(
@@ -89,7 +122,7 @@ namespace hpx {
         }
         hpx::wait_all(ptrs);
 
-        partition_size_ = get_partition_size();
+        update_partition_layout();
         this->base_type::reset(HPX_MOVE(id));
     }
 
@@ -181,6 +214,16 @@ namespace hpx {
         if (global_index == size_)
             return partitions_.size();
 
+        if (!partition_offsets_.empty())
+        {
+            // find the last partition starting at or before the given index,
+            // this skips empty partitions
+            auto const it = std::upper_bound(partition_offsets_.begin(),
+                partition_offsets_.end(), global_index);
+            return static_cast<std::size_t>(
+                std::distance(partition_offsets_.begin(), it) - 1);
+        }
+
         std::size_t part_size = partition_size_;
         if (part_size != 0)
             return (part_size != size_) ? (global_index / part_size) : 0;
@@ -198,6 +241,12 @@ namespace hpx {
             return std::size_t(-1);
         }
 
+        if (!partition_offsets_.empty())
+        {
+            return global_index -
+                partition_offsets_[get_partition(global_index)];
+        }
+
         return (partition_size_ != size_) ? (global_index % partition_size_) :
                                             global_index;
     }
@@ -333,10 +382,22 @@ namespace hpx {
     template <typename T, typename Data /*= std::vector<T> */>
     template <typename DistPolicy, typename Create>
     void partitioned_vector<T, Data>::create(
-        DistPolicy const& policy, Create&& creator)
+        DistPolicy const& policy, Create&& creator, T const& val)
     {
         std::size_t num_parts =
             traits::num_container_partitions<DistPolicy>::call(policy);
+
+        // the distribution policy may specify the size of each partition,
+        // in which case the partitions are created empty and resized
+        // afterwards
+        std::vector<std::size_t> const sizes =
+            traits::container_partition_sizes<DistPolicy>::call(policy, size_);
+        if (!sizes.empty())
+        {
+            create_sized(creator(policy, num_parts, 0), sizes, val);
+            return;
+        }
+
         std::size_t part_size = (size_ + num_parts - 1) / num_parts;
 
         // create as many partitions as required
@@ -401,7 +462,105 @@ namespace hpx {
         hpx::wait_all(ptrs);
 
         // cache our partition size
-        partition_size_ = get_partition_size();
+        update_partition_layout();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::create_sized(
+        hpx::future<std::vector<bulk_locality_result>>&& f,
+        std::vector<std::size_t> const& sizes, T const& val)
+    {
+        std::size_t const num_parts = sizes.size();
+
+        // now initialize our data structures
+        std::uint32_t this_locality = get_locality_id();
+        std::vector<future<void>> ptrs;
+        ptrs.reserve(2 * num_parts);
+
+        std::size_t allocated_size = 0;
+        std::size_t l = 0;
+
+        // Fixing the size of partitions to avoid race conditions between
+        // possible reallocations during push back and the continuation
+        // to set the local partition data
+        partitions_.resize(num_parts);
+        for (bulk_locality_result const& r : f.get())
+        {
+            using naming::get_locality_id_from_id;
+            std::uint32_t locality = get_locality_id_from_id(r.first);
+            for (hpx::id_type const& id : r.second)
+            {
+                HPX_ASSERT(l < num_parts);
+
+                std::size_t const size = sizes[l];
+                partitions_[l] = partition_data(id, size, locality);
+
+                if (size != 0)
+                {
+                    ptrs.push_back(
+                        partitioned_vector_partition_client(id).resize_async(
+                            size, val));
+                }
+
+                if (locality == this_locality)
+                {
+                    ptrs.push_back(
+                        get_ptr<partitioned_vector_partition_server>(id).then(
+                            get_ptr_helper{l, partitions_}));
+                }
+
+                allocated_size += size;
+                ++l;
+            }
+        }
+        HPX_ASSERT(l == num_parts);
+
+        hpx::wait_all(ptrs);
+
+        if (l != num_parts || allocated_size != size_)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "partitioned_vector::create_sized",
+                "the partition sizes given by the distribution policy do not "
+                "match the size of the vector ({} partitions holding {} "
+                "elements, expected {} elements)",
+                l, allocated_size, size_);
+        }
+
+        // cache our partition size and offsets
+        update_partition_layout();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector<T, Data>::redistribute_helper(
+        hpx::future<std::vector<bulk_locality_result>>&& f,
+        std::vector<std::size_t>&& sizes)
+    {
+        // The new partitions are managed by a temporary vector, the elements
+        // are moved there by copying all overlapping ranges in parallel.
+        auto target = std::make_shared<partitioned_vector>();
+        target->size_ = size_;
+
+        return f.then([HPX_CXX20_CAPTURE_THIS(=), sizes = HPX_MOVE(sizes)](
+                          hpx::future<std::vector<bulk_locality_result>>&& f)
+                          -> hpx::future<void> {
+            target->create_sized(HPX_MOVE(f), sizes, T());
+
+            return copy_range(0, size_, *target, 0)
+                .then(hpx::launch::sync,
+                    [HPX_CXX20_CAPTURE_THIS(=)](hpx::future<void>&& f) -> void {
+                        f.get();    // propagate exceptions
+
+                        // the old partitions are destroyed once the last
+                        // reference to them has gone out of scope
+                        partitions_ = HPX_MOVE(target->partitions_);
+                        update_partition_layout();
+
+                        target->size_ = 0;
+                    });
+        });
     }
 
     template <typename T, typename Data /*= std::vector<T> */>
@@ -409,7 +568,7 @@ namespace hpx {
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::create(DistPolicy const& policy)
     {
-        create(policy, &partitioned_vector::create_helper1<DistPolicy>);
+        create(policy, &partitioned_vector::create_helper1<DistPolicy>, T());
     }
 
     template <typename T, typename Data /*= std::vector<T> */>
@@ -419,7 +578,8 @@ namespace hpx {
     {
         create(policy,
             hpx::bind_back(&partitioned_vector::create_helper2<DistPolicy>,
-                std::ref(val)));
+                std::ref(val)),
+            val);
     }
 
     template <typename T, typename Data /*= std::vector<T> */>
@@ -467,6 +627,7 @@ namespace hpx {
 
         size_ = rhs.size_;
         partition_size_ = rhs.partition_size_;
+        partition_offsets_ = rhs.partition_offsets_;
         std::swap(partitions_, partitions);
     }
 
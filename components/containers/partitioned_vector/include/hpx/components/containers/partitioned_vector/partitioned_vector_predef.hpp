@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/distribution_policies/container_distribution_policy.hpp>
+#include <hpx/distribution_policies/throughput_distribution_policy.hpp>
 
 #include <hpx/components/containers/partitioned_vector/export_definitions.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
@@ -33,9 +34,15 @@ extern template class hpx::partitioned_vector<double, std::vector<double>>;
 extern template hpx::partitioned_vector<double,
     std::vector<double>>::partitioned_vector(size_type,
     hpx::container_distribution_policy const&, void*);
+extern template hpx::partitioned_vector<double,
+    std::vector<double>>::partitioned_vector(size_type,
+    hpx::throughput_distribution_policy const&, void*);
 extern template hpx::partitioned_vector<double,
     std::vector<double>>::partitioned_vector(size_type, double const&,
     hpx::container_distribution_policy const&, void*);
+extern template hpx::partitioned_vector<double,
+    std::vector<double>>::partitioned_vector(size_type, double const&,
+    hpx::throughput_distribution_policy const&, void*);
 
 // partitioned_vector<int>
 HPX_REGISTER_PARTITIONED_VECTOR_DECLARATION(int)
@@ -46,9 +53,15 @@ extern template class hpx::partitioned_vector<int, std::vector<int>>;
 extern template hpx::partitioned_vector<int,
     std::vector<int>>::partitioned_vector(size_type,
     hpx::container_distribution_policy const&, void*);
+extern template hpx::partitioned_vector<int,
+    std::vector<int>>::partitioned_vector(size_type,
+    hpx::throughput_distribution_policy const&, void*);
 extern template hpx::partitioned_vector<int,
     std::vector<int>>::partitioned_vector(size_type, int const&,
     hpx::container_distribution_policy const&, void*);
+extern template hpx::partitioned_vector<int,
+    std::vector<int>>::partitioned_vector(size_type, int const&,
+    hpx::throughput_distribution_policy const&, void*);
 
 // partitioned_vector<long long>
 typedef long long long_long;
@@ -61,9 +74,15 @@ extern template class hpx::partitioned_vector<long long, std::vector<long long>>
 extern template hpx::partitioned_vector<long long,
     std::vector<long long>>::partitioned_vector(size_type,
     hpx::container_distribution_policy const&, void*);
+extern template hpx::partitioned_vector<long long,
+    std::vector<long long>>::partitioned_vector(size_type,
+    hpx::throughput_distribution_policy const&, void*);
 extern template hpx::partitioned_vector<long long,
     std::vector<long long>>::partitioned_vector(size_type, long long const&,
     hpx::container_distribution_policy const&, void*);
+extern template hpx::partitioned_vector<long long,
+    std::vector<long long>>::partitioned_vector(size_type, long long const&,
+    hpx::throughput_distribution_policy const&, void*);
 
 // partitioned_vector<std::string>
 using partitioned_vector_std_string_argument = std::string;
@@ -80,9 +99,15 @@ extern template class hpx::partitioned_vector<std::string,
 extern template hpx::partitioned_vector<std::string,
     std::vector<std::string>>::partitioned_vector(size_type,
     hpx::container_distribution_policy const&, void*);
+extern template hpx::partitioned_vector<std::string,
+    std::vector<std::string>>::partitioned_vector(size_type,
+    hpx::throughput_distribution_policy const&, void*);
 extern template hpx::partitioned_vector<std::string,
     std::vector<std::string>>::partitioned_vector(size_type, std::string const&,
     hpx::container_distribution_policy const&, void*);
+extern template hpx::partitioned_vector<std::string,
+    std::vector<std::string>>::partitioned_vector(size_type, std::string const&,
+    hpx::throughput_distribution_policy const&, void*);
 
 #endif
 
@@ -8,6 +8,7 @@
 
 #if !defined(HPX_HAVE_STATIC_LINKING)
 #include <hpx/distribution_policies/container_distribution_policy.hpp>
+#include <hpx/distribution_policies/throughput_distribution_policy.hpp>
 
 #include <hpx/components/containers/partitioned_vector/export_definitions.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector.hpp>
@@ -36,8 +37,14 @@ template HPX_PARTITIONED_VECTOR_EXPORT
 hpx::partitioned_vector<int, std::vector<int>>::partitioned_vector(
     size_type, hpx::container_distribution_policy const&, void*);
 template HPX_PARTITIONED_VECTOR_EXPORT
+hpx::partitioned_vector<int, std::vector<int>>::partitioned_vector(
+    size_type, hpx::throughput_distribution_policy const&, void*);
+template HPX_PARTITIONED_VECTOR_EXPORT
 hpx::partitioned_vector<int, std::vector<int>>::partitioned_vector(
     size_type, int const&, hpx::container_distribution_policy const&, void*);
+template HPX_PARTITIONED_VECTOR_EXPORT
+hpx::partitioned_vector<int, std::vector<int>>::partitioned_vector(
+    size_type, int const&, hpx::throughput_distribution_policy const&, void*);
 
 template class HPX_PARTITIONED_VECTOR_EXPORT
     hpx::server::partitioned_vector<long long, std::vector<long long>>;
@@ -48,9 +55,15 @@ template class HPX_PARTITIONED_VECTOR_EXPORT
 template HPX_PARTITIONED_VECTOR_EXPORT
 hpx::partitioned_vector<long long, std::vector<long long>>::partitioned_vector(
     size_type, hpx::container_distribution_policy const&, void*);
+template HPX_PARTITIONED_VECTOR_EXPORT
+hpx::partitioned_vector<long long, std::vector<long long>>::partitioned_vector(
+    size_type, hpx::throughput_distribution_policy const&, void*);
 template HPX_PARTITIONED_VECTOR_EXPORT hpx::partitioned_vector<long long,
     std::vector<long long>>::partitioned_vector(size_type, long long const&,
     hpx::container_distribution_policy const&, void*);
+template HPX_PARTITIONED_VECTOR_EXPORT hpx::partitioned_vector<long long,
+    std::vector<long long>>::partitioned_vector(size_type, long long const&,
+    hpx::throughput_distribution_policy const&, void*);
 
 #if defined(HPX_MSVC)
 #pragma warning(pop)
@@ -8,6 +8,7 @@
 
 #if !defined(HPX_HAVE_STATIC_LINKING)
 #include <hpx/distribution_policies/container_distribution_policy.hpp>
+#include <hpx/distribution_policies/throughput_distribution_policy.hpp>
 
 #include <hpx/components/containers/partitioned_vector/export_definitions.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector.hpp>
@@ -36,9 +37,15 @@ template class HPX_PARTITIONED_VECTOR_EXPORT
 template HPX_PARTITIONED_VECTOR_EXPORT hpx::partitioned_vector<std::string,
     std::vector<std::string>>::partitioned_vector(size_type,
     hpx::container_distribution_policy const&, void*);
+template HPX_PARTITIONED_VECTOR_EXPORT hpx::partitioned_vector<std::string,
+    std::vector<std::string>>::partitioned_vector(size_type,
+    hpx::throughput_distribution_policy const&, void*);
 template HPX_PARTITIONED_VECTOR_EXPORT hpx::partitioned_vector<std::string,
     std::vector<std::string>>::partitioned_vector(size_type, std::string const&,
     hpx::container_distribution_policy const&, void*);
+template HPX_PARTITIONED_VECTOR_EXPORT hpx::partitioned_vector<std::string,
+    std::vector<std::string>>::partitioned_vector(size_type, std::string const&,
+    hpx::throughput_distribution_policy const&, void*);
 
 #if defined(HPX_MSVC)
 #pragma warning(pop)
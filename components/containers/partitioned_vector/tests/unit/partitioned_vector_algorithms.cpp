@@ -0,0 +1,236 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_merge.hpp>
+#include <hpx/include/parallel_partition.hpp>
+#include <hpx/include/parallel_unique.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(int)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+struct is_odd
+{
+    bool operator()(int v) const
+    {
+        return (v % 2) != 0;
+    }
+};
+
+struct same_tens
+{
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs / 10 == rhs / 10;
+    }
+};
+
+struct greater
+{
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs > rhs;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_values(std::size_t size, int step)
+{
+    std::vector<int> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        values[i] = static_cast<int>((i * step) % 97);
+    }
+    return values;
+}
+
+hpx::partitioned_vector<int> make_vector(
+    std::vector<int> const& values, std::size_t num_segments)
+{
+    hpx::partitioned_vector<int> v(values.size(),
+        hpx::container_layout(num_segments, hpx::find_all_localities()));
+    v.put_range(hpx::launch::sync, 0, values);
+    return v;
+}
+
+std::vector<int> get_values(
+    hpx::partitioned_vector<int> const& v, std::size_t first, std::size_t last)
+{
+    return v.get_range(hpx::launch::sync, first, last);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void copy_if_test(std::size_t size, std::size_t src_segments,
+    std::size_t dest_segments)
+{
+    std::vector<int> const values = make_values(size, 7);
+    hpx::partitioned_vector<int> src = make_vector(values, src_segments);
+    hpx::partitioned_vector<int> dest =
+        make_vector(std::vector<int>(size, -1), dest_segments);
+
+    std::vector<int> expected;
+    std::copy_if(
+        values.begin(), values.end(), std::back_inserter(expected), is_odd());
+
+    auto it = hpx::copy_if(src.begin(), src.end(), dest.begin(), is_odd());
+    HPX_TEST(it == dest.begin() + expected.size());
+    HPX_TEST(get_values(dest, 0, expected.size()) == expected);
+    HPX_TEST(get_values(dest, expected.size(), size) ==
+        std::vector<int>(size - expected.size(), -1));
+
+    auto f = hpx::copy_if(hpx::execution::par(hpx::execution::task),
+        src.cbegin() + 1, src.cend(), dest.begin() + 1, is_odd());
+
+    expected.clear();
+    std::copy_if(values.begin() + 1, values.end(),
+        std::back_inserter(expected), is_odd());
+    HPX_TEST(f.get() == dest.begin() + 1 + expected.size());
+    HPX_TEST(get_values(dest, 1, 1 + expected.size()) == expected);
+
+    // the destination has to be large enough
+    bool caught_exception = false;
+    try
+    {
+        hpx::copy_if(src.begin(), src.end(), dest.end() - 1, is_odd());
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.get_error() == hpx::error::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void unique_test(std::size_t size, std::size_t num_segments)
+{
+    std::vector<int> values = make_values(size, 1);
+    std::sort(values.begin(), values.end());
+
+    {
+        hpx::partitioned_vector<int> v = make_vector(values, num_segments);
+
+        std::vector<int> expected = values;
+        expected.erase(
+            std::unique(expected.begin(), expected.end()), expected.end());
+
+        auto it = hpx::unique(v.begin(), v.end());
+        HPX_TEST(it == v.begin() + expected.size());
+        HPX_TEST(get_values(v, 0, expected.size()) == expected);
+    }
+
+    {
+        hpx::partitioned_vector<int> v = make_vector(values, num_segments);
+
+        std::vector<int> expected = values;
+        expected.erase(std::unique(expected.begin(), expected.end(),
+                           same_tens()),
+            expected.end());
+
+        auto it = hpx::unique(hpx::execution::par, v.begin(), v.end(),
+            same_tens());
+        HPX_TEST(it == v.begin() + expected.size());
+        HPX_TEST(get_values(v, 0, expected.size()) == expected);
+    }
+}
+
+void partition_test(std::size_t size, std::size_t num_segments)
+{
+    std::vector<int> const values = make_values(size, 13);
+    hpx::partitioned_vector<int> v = make_vector(values, num_segments);
+
+    std::size_t const num_odd = static_cast<std::size_t>(
+        std::count_if(values.begin(), values.end(), is_odd()));
+
+    auto it = hpx::partition(v.begin(), v.end(), is_odd());
+    HPX_TEST(it == v.begin() + num_odd);
+
+    std::vector<int> result = get_values(v, 0, size);
+    HPX_TEST(std::all_of(result.begin(), result.begin() + num_odd, is_odd()));
+    HPX_TEST(std::none_of(result.begin() + num_odd, result.end(), is_odd()));
+
+    // the partitioned sequence has to be a permutation of the input
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    std::sort(result.begin(), result.end());
+    HPX_TEST(result == sorted);
+}
+
+void merge_test(std::size_t size1, std::size_t size2,
+    std::size_t num_segments1, std::size_t num_segments2,
+    std::size_t dest_segments)
+{
+    std::vector<int> values1 = make_values(size1, 3);
+    std::vector<int> values2 = make_values(size2, 5);
+    std::sort(values1.begin(), values1.end());
+    std::sort(values2.begin(), values2.end());
+
+    hpx::partitioned_vector<int> src1 = make_vector(values1, num_segments1);
+    hpx::partitioned_vector<int> src2 = make_vector(values2, num_segments2);
+    hpx::partitioned_vector<int> dest =
+        make_vector(std::vector<int>(size1 + size2, -1), dest_segments);
+
+    std::vector<int> expected(size1 + size2);
+    std::merge(values1.begin(), values1.end(), values2.begin(), values2.end(),
+        expected.begin());
+
+    auto it = hpx::merge(src1.cbegin(), src1.cend(), src2.cbegin(),
+        src2.cend(), dest.begin());
+    HPX_TEST(it == dest.end());
+    HPX_TEST(get_values(dest, 0, size1 + size2) == expected);
+
+    // descending order using a custom comparison
+    std::reverse(values1.begin(), values1.end());
+    std::reverse(values2.begin(), values2.end());
+    src1.put_range(hpx::launch::sync, 0, values1);
+    src2.put_range(hpx::launch::sync, 0, values2);
+
+    std::reverse(expected.begin(), expected.end());
+
+    auto f = hpx::merge(hpx::execution::par(hpx::execution::task),
+        src1.begin(), src1.end(), src2.begin(), src2.end(), dest.begin(),
+        greater());
+    HPX_TEST(f.get() == dest.end());
+    HPX_TEST(get_values(dest, 0, size1 + size2) == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    copy_if_test(100, 1, 1);
+    copy_if_test(100, 4, 3);
+    copy_if_test(1000, 7, 13);
+
+    unique_test(100, 1);
+    unique_test(100, 4);
+    unique_test(1000, 7);
+
+    partition_test(100, 1);
+    partition_test(100, 4);
+    partition_test(1000, 7);
+
+    merge_test(100, 100, 1, 1, 1);
+    merge_test(100, 37, 4, 3, 5);
+    merge_test(1000, 1, 7, 1, 13);
+    merge_test(1, 500, 1, 3, 4);
+
+    return hpx::util::report_errors();
+}
+#endif
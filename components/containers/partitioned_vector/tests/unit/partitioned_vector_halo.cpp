@@ -0,0 +1,151 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_halo.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(double)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void fill_vector(hpx::partitioned_vector<double>& v, double offset)
+{
+    std::vector<std::size_t> pos(v.size());
+    std::vector<double> values(v.size());
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        pos[i] = i;
+        values[i] = offset + static_cast<double>(i);
+    }
+    v.set_values(hpx::launch::sync, pos, values);
+}
+
+void check_halo(hpx::partitioned_vector_halo<double> const& halo,
+    std::size_t size, std::size_t num_segments, double offset)
+{
+    std::size_t const width = halo.width();
+    std::size_t const segment_size = (size + num_segments - 1) / num_segments;
+
+    for (std::size_t i = 0; i != halo.size(); ++i)
+    {
+        std::size_t const part = halo.get_partition(i);
+        std::size_t const first = part * segment_size;
+        std::size_t const last = first + halo.data(i).size();
+
+        if (part != 0 || halo.periodic())
+        {
+            std::vector<double> const& left = halo.left(i);
+            HPX_TEST_EQ(left.size(), width);
+
+            std::size_t const begin = part != 0 ? first : size;
+            for (std::size_t j = 0; j != width; ++j)
+            {
+                HPX_TEST_EQ(
+                    left[j], offset + static_cast<double>(begin - width + j));
+            }
+        }
+        else
+        {
+            HPX_TEST(halo.left(i).empty());
+        }
+
+        if (part + 1 != num_segments || halo.periodic())
+        {
+            std::vector<double> const& right = halo.right(i);
+            HPX_TEST_EQ(right.size(), width);
+
+            std::size_t const begin = part + 1 != num_segments ? last : 0;
+            for (std::size_t j = 0; j != width; ++j)
+            {
+                HPX_TEST_EQ(right[j], offset + static_cast<double>(begin + j));
+            }
+        }
+        else
+        {
+            HPX_TEST(halo.right(i).empty());
+        }
+    }
+}
+
+void halo_test(std::size_t size, std::size_t num_segments, std::size_t width,
+    bool periodic)
+{
+    hpx::partitioned_vector<double> v(
+        size, hpx::container_layout(num_segments, hpx::find_all_localities()));
+
+    hpx::partitioned_vector_halo<double> halo(v, width, periodic);
+    HPX_TEST_EQ(halo.width(), width);
+
+    fill_vector(v, 0.0);
+    halo.refresh(hpx::launch::sync);
+    check_halo(halo, size, num_segments, 0.0);
+
+    // the ghost regions are not modified before they are refreshed again
+    fill_vector(v, 1000.0);
+    check_halo(halo, size, num_segments, 0.0);
+
+    hpx::future<void> f = halo.refresh();
+    f.get();
+    check_halo(halo, size, num_segments, 1000.0);
+
+    // refresh the ghost regions of each segment separately
+    fill_vector(v, 2000.0);
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != halo.size(); ++i)
+    {
+        futures.push_back(halo.refresh(i));
+    }
+    hpx::wait_all(futures);
+    check_halo(halo, size, num_segments, 2000.0);
+}
+
+void halo_width_test()
+{
+    hpx::partitioned_vector<double> v(
+        16, hpx::container_layout(4, hpx::find_all_localities()));
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::partitioned_vector_halo<double> halo(v, 5);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.get_error() == hpx::error::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    halo_test(100, 4, 1, false);
+    halo_test(100, 4, 1, true);
+    halo_test(100, 4, 5, false);
+    halo_test(100, 4, 5, true);
+    halo_test(1000, 7, 25, true);
+    halo_test(100, 1, 3, true);
+    halo_test(100, 1, 3, false);
+    halo_test(100, 4, 0, true);
+
+    halo_width_test();
+
+    return hpx::util::report_errors();
+}
+#endif
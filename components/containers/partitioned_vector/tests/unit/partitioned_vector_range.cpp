@@ -0,0 +1,142 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_copy.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(double)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<double> make_values(
+    std::size_t first, std::size_t count, double offset)
+{
+    std::vector<double> values(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        values[i] = offset + static_cast<double>(first + i);
+    }
+    return values;
+}
+
+void check_values(hpx::partitioned_vector<double> const& v, std::size_t first,
+    std::size_t last, double offset)
+{
+    std::vector<double> const values =
+        v.get_range(hpx::launch::sync, 0, v.size());
+    HPX_TEST_EQ(values.size(), v.size());
+
+    for (std::size_t i = first; i != last; ++i)
+    {
+        HPX_TEST_EQ(values[i], offset + static_cast<double>(i - first));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void get_put_range_test(std::size_t size, std::size_t num_segments)
+{
+    hpx::partitioned_vector<double> v(
+        size, hpx::container_layout(num_segments, hpx::find_all_localities()));
+
+    v.put_range(hpx::launch::sync, 0, make_values(0, size, 0.0));
+    check_values(v, 0, size, 0.0);
+
+    // ranges spanning several segments
+    std::size_t const first = size / 3;
+    std::size_t const last = size - size / 5;
+
+    hpx::future<void> f =
+        v.put_range(first, make_values(0, last - first, 1000.0));
+    f.get();
+    check_values(v, first, last, 1000.0);
+
+    std::vector<double> const values = v.get_range(first, last).get();
+    HPX_TEST(values == make_values(0, last - first, 1000.0));
+
+    HPX_TEST(v.get_range(hpx::launch::sync, first, first).empty());
+
+    bool caught_exception = false;
+    try
+    {
+        v.get_range(hpx::launch::sync, first, size + 1);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.get_error() == hpx::error::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void copy_range_test(std::size_t size, std::size_t src_segments,
+    std::size_t dest_segments)
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+    hpx::partitioned_vector<double> src(
+        size, hpx::container_layout(src_segments, localities));
+    hpx::partitioned_vector<double> dest(
+        size, hpx::container_layout(dest_segments, localities));
+
+    src.put_range(hpx::launch::sync, 0, make_values(0, size, 0.0));
+    dest.put_range(hpx::launch::sync, 0, std::vector<double>(size, -1.0));
+
+    // copy the middle part of the source to the beginning of the destination
+    std::size_t const first = size / 4;
+    std::size_t const last = size - size / 4;
+
+    src.copy_range(hpx::launch::sync, first, last, dest, 0);
+    check_values(dest, 0, last - first, static_cast<double>(first));
+    check_values(dest, last - first, size, -1.0);
+
+    // segmented hpx::copy between vectors with different distributions
+    auto it = hpx::copy(src.begin(), src.end(), dest.begin());
+    HPX_TEST(it == dest.end());
+    check_values(dest, 0, size, 0.0);
+
+    src.put_range(hpx::launch::sync, 0, make_values(0, size, 1000.0));
+
+    it = hpx::copy(hpx::execution::par, src.cbegin() + first,
+        src.cbegin() + last, dest.begin() + first);
+    HPX_TEST(it == dest.begin() + last);
+    check_values(dest, first, last, 1000.0 + static_cast<double>(first));
+
+    src.put_range(hpx::launch::sync, 0, make_values(0, size, 2000.0));
+
+    auto f = hpx::copy(hpx::execution::par(hpx::execution::task), src.begin(),
+        src.end(), dest.begin());
+    HPX_TEST(f.get() == dest.end());
+    check_values(dest, 0, size, 2000.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    get_put_range_test(100, 1);
+    get_put_range_test(100, 4);
+    get_put_range_test(1000, 7);
+
+    copy_range_test(100, 1, 1);
+    copy_range_test(100, 4, 4);
+    copy_range_test(100, 3, 5);
+    copy_range_test(1000, 7, 2);
+    copy_range_test(1000, 2, 13);
+
+    return hpx::util::report_errors();
+}
+#endif
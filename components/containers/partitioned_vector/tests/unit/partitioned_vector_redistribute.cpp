@@ -0,0 +1,186 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/distribution_policies/throughput_distribution_policy.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_distributed/find_here.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(double)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void fill_vector(hpx::partitioned_vector<double>& v)
+{
+    std::vector<double> values(v.size());
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        values[i] = static_cast<double>(i);
+    }
+    v.put_range(hpx::launch::sync, 0, values);
+}
+
+void check_vector(hpx::partitioned_vector<double> const& v, std::size_t size)
+{
+    HPX_TEST_EQ(v.size(), size);
+
+    std::vector<double> const values =
+        v.get_range(hpx::launch::sync, 0, v.size());
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(values[i], static_cast<double>(i));
+    }
+
+    // the segmented iterators have to agree with the new layout
+    std::size_t count = 0;
+    for (auto it = v.begin(); it != v.end(); ++it, ++count)
+    {
+        HPX_TEST_EQ(*it, static_cast<double>(count));
+    }
+    HPX_TEST_EQ(count, size);
+}
+
+void check_partitions(hpx::partitioned_vector<double> const& v,
+    std::vector<std::size_t> const& sizes)
+{
+    std::size_t first = 0;
+    for (std::size_t part = 0; part != sizes.size(); ++part)
+    {
+        for (std::size_t i = 0; i != sizes[part]; ++i)
+        {
+            HPX_TEST_EQ(v.get_partition(first + i), part);
+            HPX_TEST_EQ(v.get_local_index(first + i), i);
+        }
+        first += sizes[part];
+    }
+    HPX_TEST_EQ(first, v.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void weighted_sizes_test()
+{
+    using hpx::detail::get_weighted_partition_sizes;
+
+    HPX_TEST(get_weighted_partition_sizes(100, {1.0, 2.0, 1.0}) ==
+        std::vector<std::size_t>({25, 50, 25}));
+    HPX_TEST(get_weighted_partition_sizes(10, {1.0, 1.0, 1.0}) ==
+        std::vector<std::size_t>({4, 3, 3}));
+    HPX_TEST(get_weighted_partition_sizes(10, {0.0, 1.0}) ==
+        std::vector<std::size_t>({0, 10}));
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::throughput_layout(
+            std::vector<hpx::id_type>(2, hpx::find_here()), {1.0});
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.get_error() == hpx::error::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void throughput_layout_test(std::size_t size)
+{
+    // place all partitions onto this locality, the first partition is
+    // assumed to be three times as fast as the others
+    std::vector<hpx::id_type> const localities(3, hpx::find_here());
+    std::vector<double> const throughputs = {3.0, 1.0, 1.0};
+
+    hpx::partitioned_vector<double> v(
+        size, hpx::throughput_layout(localities, throughputs));
+    fill_vector(v);
+
+    check_vector(v, size);
+    check_partitions(
+        v, hpx::detail::get_weighted_partition_sizes(size, throughputs));
+}
+
+void redistribute_test(std::size_t size, std::size_t num_segments)
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+    hpx::partitioned_vector<double> v(
+        size, hpx::container_layout(num_segments, localities));
+    fill_vector(v);
+
+    // rebalance using throughput measurements, the first locality is
+    // assumed to be twice as fast as the others
+    std::vector<double> throughputs(localities.size(), 1.0);
+    throughputs[0] = 2.0;
+
+    v.redistribute(hpx::launch::sync,
+        hpx::throughput_layout(localities, throughputs));
+    check_vector(v, size);
+    check_partitions(
+        v, hpx::detail::get_weighted_partition_sizes(size, throughputs));
+
+    // skew the layout further
+    std::vector<hpx::id_type> const here(4, hpx::find_here());
+    std::vector<double> const skewed = {1.0, 0.0, 5.0, 2.0};
+
+    hpx::future<void> f =
+        v.redistribute(hpx::throughput_layout(here, skewed));
+    f.get();
+    check_vector(v, size);
+    check_partitions(
+        v, hpx::detail::get_weighted_partition_sizes(size, skewed));
+
+    // go back to an even distribution
+    v.redistribute(hpx::launch::sync,
+        hpx::container_layout(num_segments + 2, localities));
+    check_vector(v, size);
+}
+
+// the metadata of registered vectors would be stale after redistributing
+void registered_redistribute_test()
+{
+    hpx::partitioned_vector<double> v(10);
+    v.register_as(hpx::launch::sync, "partitioned_vector_redistribute_test");
+
+    bool caught_exception = false;
+    try
+    {
+        v.redistribute(hpx::launch::sync, hpx::container_layout(2));
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.get_error() == hpx::error::invalid_status);
+    }
+    HPX_TEST(caught_exception);
+    check_partitions(v, std::vector<std::size_t>{10});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    weighted_sizes_test();
+
+    throughput_layout_test(100);
+    throughput_layout_test(7);
+
+    redistribute_test(100, 1);
+    redistribute_test(100, 4);
+    redistribute_test(1000, 7);
+
+    registered_redistribute_test();
+
+    return hpx::util::report_errors();
+}
+#endif
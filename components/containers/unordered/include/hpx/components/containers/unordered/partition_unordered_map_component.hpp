@@ -126,6 +126,17 @@ namespace hpx { namespace server {
             return *this;
         }
 
+        /// Direct access to the stored elements, the caller is responsible
+        /// for avoiding concurrent modifications of the partition.
+        data_type& get_data()
+        {
+            return partition_unordered_map_;
+        }
+        data_type const& get_data() const
+        {
+            return partition_unordered_map_;
+        }
+
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
@@ -159,6 +159,11 @@ namespace hpx {
                 return hasher_(key);
             }
 
+            Hash const& get() const
+            {
+                return hasher_;
+            }
+
             Hash hasher_;
         };
 
@@ -174,6 +179,11 @@ namespace hpx {
             {
                 return Hash()(key);
             }
+
+            Hash get() const
+            {
+                return Hash();
+            }
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -196,6 +206,11 @@ namespace hpx {
                 return equal_(lhs, rhs);
             }
 
+            KeyEqual const& get() const
+            {
+                return equal_;
+            }
+
             KeyEqual equal_;
         };
 
@@ -211,6 +226,11 @@ namespace hpx {
             {
                 return KeyEqual()(lhs, rhs);
             }
+
+            KeyEqual get() const
+            {
+                return KeyEqual();
+            }
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -366,17 +386,6 @@ namespace hpx {
             return this->hasher_(key) % partitions_.size();
         }
 
-        std::vector<hpx::id_type> get_partition_ids() const
-        {
-            std::vector<hpx::id_type> ids;
-            ids.reserve(partitions_.size());
-            for (partition_data const& pd : partitions_)
-            {
-                ids.push_back(pd.get_id());
-            }
-            return ids;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         struct get_ptr_helper
         {
@@ -629,6 +638,34 @@ namespace hpx {
             return partitions_.size();
         }
 
+        /// Returns the function used to hash the keys. A key is stored in
+        /// the partition with the sequence number hash(key) % N, where N is
+        /// the number of partitions.
+        Hash hash_function() const
+        {
+            return this->hasher_.get();
+        }
+
+        /// Returns the function used to compare the keys for equality
+        KeyEqual key_eq() const
+        {
+            return this->equal_.get();
+        }
+
+        /// \cond NOINTERNAL
+        // Return the ids of all partitions, ordered by their sequence number
+        std::vector<hpx::id_type> get_partition_ids() const
+        {
+            std::vector<hpx::id_type> ids;
+            ids.reserve(partitions_.size());
+            for (partition_data const& pd : partitions_)
+            {
+                ids.push_back(pd.get_id());
+            }
+            return ids;
+        }
+        /// \endcond
+
         /// \brief Array subscript operator. This does not throw any exception.
         ///
         /// \param pos Position of the element in the unordered_map
@@ -0,0 +1,644 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/unordered/unordered_map_algorithms.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/components/get_ptr.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+#include <hpx/components/containers/unordered/partition_unordered_map_component.hpp>
+#include <hpx/components/containers/unordered/unordered_map.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// The algorithms in this file group the records (key/value pairs) stored in
+// a hpx::partitioned_vector by their key and store the results in a
+// hpx::unordered_map. They are implemented as a shuffle: every locality
+// holding parts of the input or of the result takes part in a single
+// all_to_all exchange, sending each record to the locality which holds the
+// partition of the result its key belongs to. The records are combined on
+// the sending locality before the exchange wherever possible, which reduces
+// the amount of data sent for frequent keys.
+//
+// Using these algorithms requires linking with both, the unordered and the
+// partitioned_vector components.
+
+namespace hpx {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        using shuffle_range_pieces =
+            std::vector<server::partitioned_vector_range_piece>;
+
+        ///////////////////////////////////////////////////////////////////////
+        // The part of a shuffle executed by one of the participating
+        // localities (sites).
+        struct unordered_map_shuffle_site
+        {
+            // Return the sequence number of the partition of the result the
+            // given key belongs to, this has to be consistent with
+            // unordered_map::get_partition.
+            template <typename Hash, typename Key>
+            std::size_t get_partition(Hash const& hash, Key const& key) const
+            {
+                return hash(key) % partitions_.size();
+            }
+
+            template <typename Hash, typename Key>
+            std::size_t get_site(Hash const& hash, Key const& key) const
+            {
+                return partition_sites_[get_partition(hash, key)];
+            }
+
+            // Send one bucket to each of the sites, return the buckets
+            // received from all of the sites.
+            template <typename Bucket>
+            std::vector<Bucket> exchange(std::vector<Bucket>&& buckets) const
+            {
+                using namespace hpx::collectives;
+
+                HPX_ASSERT(buckets.size() == num_sites_);
+
+                auto comm = create_communicator(basename_.c_str(),
+                    num_sites_arg(num_sites_), this_site_arg(this_site_));
+                return all_to_all(
+                    comm, HPX_MOVE(buckets), this_site_arg(this_site_))
+                    .get();
+            }
+
+            std::string basename_;
+            std::size_t num_sites_ = 0;
+            std::size_t this_site_ = 0;
+
+            // the partitions of the result and the sites holding them
+            std::vector<hpx::id_type> partitions_;
+            std::vector<std::size_t> partition_sites_;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & basename_ & num_sites_ & this_site_ & partitions_ &
+                    partition_sites_;
+                // clang-format on
+            }
+        };
+
+        // Collects the localities taking part in a shuffle, these are all
+        // localities holding partitions of the inputs or of the result.
+        class unordered_map_shuffle
+        {
+        public:
+            explicit unordered_map_shuffle(
+                std::vector<hpx::id_type>&& partitions)
+              : partitions_(HPX_MOVE(partitions))
+            {
+                for (auto const& id : partitions_)
+                    add_locality(id);
+            }
+
+            void add_input(shuffle_range_pieces const& pieces)
+            {
+                for (auto const& p : pieces)
+                    add_locality(p.partition_);
+            }
+
+            std::size_t num_sites() const noexcept
+            {
+                return localities_.size();
+            }
+
+            hpx::id_type get_locality(std::size_t site) const
+            {
+                HPX_ASSERT(site < localities_.size());
+                return naming::get_id_from_locality_id(localities_[site]);
+            }
+
+            unordered_map_shuffle_site get_site(
+                std::string const& basename, std::size_t site) const
+            {
+                unordered_map_shuffle_site result;
+                result.basename_ = basename;
+                result.num_sites_ = localities_.size();
+                result.this_site_ = site;
+                result.partitions_ = partitions_;
+                result.partition_sites_.reserve(partitions_.size());
+                for (auto const& id : partitions_)
+                    result.partition_sites_.push_back(get_site_of(id));
+                return result;
+            }
+
+            // Return the input pieces located on the given site
+            shuffle_range_pieces get_local_pieces(
+                shuffle_range_pieces const& pieces, std::size_t site) const
+            {
+                shuffle_range_pieces result;
+                for (auto const& p : pieces)
+                {
+                    if (get_site_of(p.partition_) == site)
+                        result.push_back(p);
+                }
+                return result;
+            }
+
+        private:
+            void add_locality(hpx::id_type const& id)
+            {
+                std::uint32_t const locality =
+                    naming::get_locality_id_from_id(id);
+                auto const it = std::lower_bound(
+                    localities_.begin(), localities_.end(), locality);
+                if (it == localities_.end() || *it != locality)
+                    localities_.insert(it, locality);
+            }
+
+            std::size_t get_site_of(hpx::id_type const& id) const
+            {
+                auto const it = std::lower_bound(localities_.begin(),
+                    localities_.end(), naming::get_locality_id_from_id(id));
+                HPX_ASSERT(it != localities_.end());
+                return static_cast<std::size_t>(
+                    std::distance(localities_.begin(), it));
+            }
+
+            std::vector<hpx::id_type> partitions_;
+            std::vector<std::uint32_t> localities_;    // sorted
+        };
+
+        // Every shuffle needs its own communicator
+        inline std::string get_unordered_map_shuffle_basename()
+        {
+            static std::atomic<std::size_t> count(0);
+            return "/hpx/unordered_map/shuffle/" +
+                std::to_string(hpx::get_locality_id()) + "/" +
+                std::to_string(++count);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Invoke f for each of the records stored in the given (local) pieces
+        template <typename Record, typename Data, typename F>
+        void for_each_record(shuffle_range_pieces const& pieces, F&& f)
+        {
+            for (auto const& p : pieces)
+            {
+                auto const segment =
+                    hpx::get_ptr<server::partitioned_vector<Record, Data>>(
+                        hpx::launch::sync, p.partition_);
+
+                auto const begin = segment->get_data().begin() + p.local_first_;
+                std::for_each(begin, begin + p.size_, f);
+            }
+        }
+
+        // Provides access to the partitions of the result located on this
+        // site
+        template <typename Key, typename T, typename Hash, typename KeyEqual>
+        class shuffle_partitions
+        {
+            using server_type =
+                server::partition_unordered_map<Key, T, Hash, KeyEqual>;
+
+        public:
+            explicit shuffle_partitions(unordered_map_shuffle_site const& site)
+              : site_(site)
+              , partitions_(site.partitions_.size())
+            {
+            }
+
+            typename server_type::data_type& get(std::size_t part)
+            {
+                HPX_ASSERT(site_.partition_sites_[part] == site_.this_site_);
+                if (!partitions_[part])
+                {
+                    partitions_[part] = hpx::get_ptr<server_type>(
+                        hpx::launch::sync, site_.partitions_[part]);
+                }
+                return partitions_[part]->get_data();
+            }
+
+        private:
+            unordered_map_shuffle_site const& site_;
+            std::vector<std::shared_ptr<server_type>> partitions_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A combiner describes how the values of records with equal keys are
+        // aggregated: init creates the aggregate from a single value, add
+        // includes another value, and merge combines two aggregates.
+        template <typename Op>
+        struct reduce_combiner
+        {
+            template <typename T>
+            std::decay_t<T> init(T&& value) const
+            {
+                return HPX_FORWARD(T, value);
+            }
+
+            template <typename T, typename U>
+            void add(T& aggregate, U&& value) const
+            {
+                aggregate =
+                    HPX_INVOKE(op_, HPX_MOVE(aggregate), HPX_FORWARD(U, value));
+            }
+
+            template <typename T, typename U>
+            void merge(T& aggregate, U&& value) const
+            {
+                add(aggregate, HPX_FORWARD(U, value));
+            }
+
+            Op op_;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & op_;
+                // clang-format on
+            }
+        };
+
+        struct group_combiner
+        {
+            template <typename T>
+            std::vector<std::decay_t<T>> init(T&& value) const
+            {
+                std::vector<std::decay_t<T>> result;
+                result.push_back(HPX_FORWARD(T, value));
+                return result;
+            }
+
+            template <typename T, typename U>
+            void add(std::vector<T>& aggregate, U&& value) const
+            {
+                aggregate.push_back(HPX_FORWARD(U, value));
+            }
+
+            template <typename T>
+            void merge(std::vector<T>& aggregate, std::vector<T>&& values) const
+            {
+                if (aggregate.empty())
+                {
+                    aggregate = HPX_MOVE(values);
+                    return;
+                }
+                aggregate.insert(aggregate.end(),
+                    std::make_move_iterator(values.begin()),
+                    std::make_move_iterator(values.end()));
+            }
+        };
+
+        template <typename Map, typename Key, typename T, typename Combiner>
+        void combine_value(
+            Map& m, Key const& key, T&& value, Combiner const& combiner)
+        {
+            auto const it = m.find(key);
+            if (it == m.end())
+                m.emplace(key, combiner.init(HPX_FORWARD(T, value)));
+            else
+                combiner.add(it->second, HPX_FORWARD(T, value));
+        }
+
+        template <typename Map, typename Key, typename U, typename Combiner>
+        void merge_aggregate(
+            Map& m, Key const& key, U&& aggregate, Combiner const& combiner)
+        {
+            auto const it = m.find(key);
+            if (it == m.end())
+                m.emplace(key, HPX_FORWARD(U, aggregate));
+            else
+                combiner.merge(it->second, HPX_FORWARD(U, aggregate));
+        }
+
+        // Combine the local records separately for each of the sites they
+        // have to be sent to
+        template <typename Key, typename T, typename Data, typename U,
+            typename Hash, typename KeyEqual, typename Combiner>
+        std::vector<std::vector<std::pair<Key, U>>> combine_records(
+            unordered_map_shuffle_site const& site,
+            shuffle_range_pieces const& input, Hash const& hash,
+            KeyEqual const& equal, Combiner const& combiner)
+        {
+            using record_type = std::pair<Key, T>;
+            using map_type = std::unordered_map<Key, U, Hash, KeyEqual>;
+
+            std::vector<map_type> combined(
+                site.num_sites_, map_type(0, hash, equal));
+            for_each_record<record_type, Data>(
+                input, [&](record_type const& r) {
+                    combine_value(combined[site.get_site(hash, r.first)],
+                        r.first, r.second, combiner);
+                });
+
+            std::vector<std::vector<std::pair<Key, U>>> buckets(
+                site.num_sites_);
+            for (std::size_t i = 0; i != site.num_sites_; ++i)
+            {
+                buckets[i].reserve(combined[i].size());
+                for (auto& value : combined[i])
+                {
+                    buckets[i].emplace_back(
+                        value.first, HPX_MOVE(value.second));
+                }
+                map_type().swap(combined[i]);
+            }
+            return buckets;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Key, typename T, typename Data, typename U,
+            typename Hash, typename KeyEqual, typename Combiner>
+        void aggregate_by_key_site(unordered_map_shuffle_site const& site,
+            shuffle_range_pieces const& input, Hash const& hash,
+            KeyEqual const& equal, Combiner const& combiner)
+        {
+            auto received = site.exchange(
+                combine_records<Key, T, Data, U>(
+                    site, input, hash, equal, combiner));
+
+            // merge the received aggregates into the local partitions of the
+            // result
+            shuffle_partitions<Key, U, Hash, KeyEqual> partitions(site);
+            for (auto& bucket : received)
+            {
+                for (auto& r : bucket)
+                {
+                    merge_aggregate(
+                        partitions.get(site.get_partition(hash, r.first)),
+                        r.first, HPX_MOVE(r.second), combiner);
+                }
+            }
+        }
+
+        template <typename Key, typename T, typename Data, typename U,
+            typename Hash, typename KeyEqual, typename Combiner>
+        struct aggregate_by_key_site_action
+          : hpx::actions::make_action<
+                decltype(&aggregate_by_key_site<Key, T, Data, U, Hash,
+                    KeyEqual, Combiner>),
+                &aggregate_by_key_site<Key, T, Data, U, Hash, KeyEqual,
+                    Combiner>,
+                aggregate_by_key_site_action<Key, T, Data, U, Hash, KeyEqual,
+                    Combiner>>::type
+        {
+        };
+
+        template <typename Key, typename T1, typename Data1, typename T2,
+            typename Data2, typename Hash, typename KeyEqual>
+        void hash_join_site(unordered_map_shuffle_site const& site,
+            shuffle_range_pieces const& left, shuffle_range_pieces const& right,
+            Hash const& hash, KeyEqual const& equal)
+        {
+            using left_bucket_type =
+                std::vector<std::pair<Key, std::vector<T1>>>;
+            using right_bucket_type =
+                std::vector<std::pair<Key, std::vector<T2>>>;
+            using bucket_type = std::pair<left_bucket_type, right_bucket_type>;
+
+            // both sides are exchanged at once, the records are grouped by
+            // their key before being sent
+            std::vector<bucket_type> buckets(site.num_sites_);
+            {
+                auto left_buckets =
+                    combine_records<Key, T1, Data1, std::vector<T1>>(
+                        site, left, hash, equal, group_combiner());
+                auto right_buckets =
+                    combine_records<Key, T2, Data2, std::vector<T2>>(
+                        site, right, hash, equal, group_combiner());
+
+                for (std::size_t i = 0; i != site.num_sites_; ++i)
+                {
+                    buckets[i].first = HPX_MOVE(left_buckets[i]);
+                    buckets[i].second = HPX_MOVE(right_buckets[i]);
+                }
+            }
+
+            auto received = site.exchange(HPX_MOVE(buckets));
+
+            // build the hash table from the left side
+            std::unordered_map<Key, std::vector<T1>, Hash, KeyEqual> table(
+                0, hash, equal);
+            for (auto& bucket : received)
+            {
+                for (auto& r : bucket.first)
+                {
+                    merge_aggregate(
+                        table, r.first, HPX_MOVE(r.second), group_combiner());
+                }
+            }
+
+            // probe it with the right side
+            shuffle_partitions<Key, std::vector<std::pair<T1, T2>>, Hash,
+                KeyEqual>
+                partitions(site);
+            for (auto const& bucket : received)
+            {
+                for (auto const& r : bucket.second)
+                {
+                    auto const it = table.find(r.first);
+                    if (it == table.end())
+                        continue;
+
+                    auto& joined = partitions.get(
+                        site.get_partition(hash, r.first))[r.first];
+                    joined.reserve(
+                        joined.size() + it->second.size() * r.second.size());
+                    for (auto const& l : it->second)
+                    {
+                        for (auto const& v : r.second)
+                            joined.emplace_back(l, v);
+                    }
+                }
+            }
+        }
+
+        template <typename Key, typename T1, typename Data1, typename T2,
+            typename Data2, typename Hash, typename KeyEqual>
+        struct hash_join_site_action
+          : hpx::actions::make_action<
+                decltype(&hash_join_site<Key, T1, Data1, T2, Data2, Hash,
+                    KeyEqual>),
+                &hash_join_site<Key, T1, Data1, T2, Data2, Hash, KeyEqual>,
+                hash_join_site_action<Key, T1, Data1, T2, Data2, Hash,
+                    KeyEqual>>::type
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        inline hpx::future<void> when_all_sites(
+            std::vector<hpx::future<void>>&& sites)
+        {
+            return hpx::when_all(sites).then(hpx::launch::sync,
+                [](hpx::future<std::vector<hpx::future<void>>>&& f) {
+                    for (auto& site : f.get())
+                        site.get();    // propagate exceptions
+                });
+        }
+
+        template <typename Key, typename T, typename Data, typename U,
+            typename Hash, typename KeyEqual, typename Combiner>
+        hpx::future<void> aggregate_by_key(
+            partitioned_vector<std::pair<Key, T>, Data> const& input,
+            unordered_map<Key, U, Hash, KeyEqual>& result,
+            Combiner const& combiner)
+        {
+            using action_type = aggregate_by_key_site_action<Key, T, Data, U,
+                Hash, KeyEqual, Combiner>;
+
+            shuffle_range_pieces const pieces =
+                input.get_range_pieces(0, input.size());
+
+            unordered_map_shuffle shuffle(result.get_partition_ids());
+            shuffle.add_input(pieces);
+
+            std::string const basename = get_unordered_map_shuffle_basename();
+
+            std::vector<hpx::future<void>> sites;
+            sites.reserve(shuffle.num_sites());
+            for (std::size_t i = 0; i != shuffle.num_sites(); ++i)
+            {
+                sites.push_back(hpx::async(action_type(),
+                    shuffle.get_locality(i), shuffle.get_site(basename, i),
+                    shuffle.get_local_pieces(pieces, i),
+                    result.hash_function(), result.key_eq(), combiner));
+            }
+            return when_all_sites(HPX_MOVE(sites));
+        }
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Combine the values of all records with equal keys stored in \a input
+    /// using the binary operation \a op. The results are combined with the
+    /// values already stored in \a result for the same keys, other keys are
+    /// inserted.
+    ///
+    /// \param input    The records to aggregate
+    /// \param result   The unordered_map to store the aggregated values in
+    /// \param op       The (associative and commutative) binary operation
+    ///                 used to combine two values, it has to be serializable
+    ///
+    /// \returns A future which becomes ready once all records have been
+    ///          aggregated.
+    ///
+    template <typename Key, typename T, typename Data, typename Hash,
+        typename KeyEqual, typename Op>
+    hpx::future<void> reduce_by_key(
+        partitioned_vector<std::pair<Key, T>, Data> const& input,
+        unordered_map<Key, T, Hash, KeyEqual>& result, Op op)
+    {
+        return detail::aggregate_by_key(
+            input, result, detail::reduce_combiner<Op>{HPX_MOVE(op)});
+    }
+
+    /// Collect the values of all records with equal keys stored in \a input.
+    /// The values are appended to the values already stored in \a result
+    /// for the same keys, the order of the appended values is unspecified.
+    ///
+    /// \param input    The records to group
+    /// \param result   The unordered_map to store the grouped values in
+    ///
+    /// \returns A future which becomes ready once all records have been
+    ///          grouped.
+    ///
+    template <typename Key, typename T, typename Data, typename Hash,
+        typename KeyEqual>
+    hpx::future<void> group_by(
+        partitioned_vector<std::pair<Key, T>, Data> const& input,
+        unordered_map<Key, std::vector<T>, Hash, KeyEqual>& result)
+    {
+        return detail::aggregate_by_key(
+            input, result, detail::group_combiner());
+    }
+
+    /// Compute the inner join of the records stored in \a left and \a right
+    /// on their keys. For every key present in both inputs all pairs of
+    /// values are appended to the values already stored in \a result for
+    /// this key, the order of the appended pairs is unspecified.
+    ///
+    /// Both inputs are partitioned by the hash of their keys using the
+    /// layout of \a result, the records of the left input are used to build
+    /// the hash tables which are then probed with the right input.
+    ///
+    /// \param left     The records of the left side of the join
+    /// \param right    The records of the right side of the join
+    /// \param result   The unordered_map to store the joined values in
+    ///
+    /// \returns A future which becomes ready once the join has been
+    ///          computed.
+    ///
+    template <typename Key, typename T1, typename Data1, typename T2,
+        typename Data2, typename Hash, typename KeyEqual>
+    hpx::future<void> hash_join(
+        partitioned_vector<std::pair<Key, T1>, Data1> const& left,
+        partitioned_vector<std::pair<Key, T2>, Data2> const& right,
+        unordered_map<Key, std::vector<std::pair<T1, T2>>, Hash, KeyEqual>&
+            result)
+    {
+        using action_type = detail::hash_join_site_action<Key, T1, Data1, T2,
+            Data2, Hash, KeyEqual>;
+
+        detail::shuffle_range_pieces const left_pieces =
+            left.get_range_pieces(0, left.size());
+        detail::shuffle_range_pieces const right_pieces =
+            right.get_range_pieces(0, right.size());
+
+        detail::unordered_map_shuffle shuffle(result.get_partition_ids());
+        shuffle.add_input(left_pieces);
+        shuffle.add_input(right_pieces);
+
+        std::string const basename =
+            detail::get_unordered_map_shuffle_basename();
+
+        std::vector<hpx::future<void>> sites;
+        sites.reserve(shuffle.num_sites());
+        for (std::size_t i = 0; i != shuffle.num_sites(); ++i)
+        {
+            sites.push_back(hpx::async(action_type(), shuffle.get_locality(i),
+                shuffle.get_site(basename, i),
+                shuffle.get_local_pieces(left_pieces, i),
+                shuffle.get_local_pieces(right_pieces, i),
+                result.hash_function(), result.key_eq()));
+        }
+        return detail::when_all_sites(HPX_MOVE(sites));
+    }
+}    // namespace hpx
@@ -0,0 +1,183 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the distributed reduce_by_key, group_by, and
+// hash_join operations for inputs with a configurable key skew. The keys are
+// drawn from [0, num_keys) such that a skew of 1 gives a uniform distribution
+// and larger values concentrate more and more of the records on a few hot
+// keys.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/components/containers/unordered/unordered_map_algorithms.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using record_type = std::pair<std::int64_t, double>;
+using grouped_type = std::vector<double>;
+using joined_type = std::vector<std::pair<double, double>>;
+
+HPX_REGISTER_PARTITIONED_VECTOR(record_type)
+
+HPX_REGISTER_UNORDERED_MAP(std::int64_t, double)
+HPX_REGISTER_UNORDERED_MAP(std::int64_t, grouped_type)
+HPX_REGISTER_UNORDERED_MAP(std::int64_t, joined_type)
+
+///////////////////////////////////////////////////////////////////////////////
+struct plus_op
+{
+    double operator()(double lhs, double rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::partitioned_vector<record_type> make_records(std::size_t size,
+    std::int64_t num_keys, double skew, unsigned int seed,
+    std::vector<hpx::id_type> const& localities)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    std::vector<record_type> records(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        auto key = static_cast<std::int64_t>(
+            static_cast<double>(num_keys) * std::pow(dist(gen), skew));
+        records[i] = record_type(
+            (std::min)(key, num_keys - 1), static_cast<double>(i));
+    }
+
+    hpx::partitioned_vector<record_type> v(
+        size, hpx::container_layout(localities));
+    v.put_range(hpx::launch::sync, 0, records);
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double measure(int test_count, F&& f)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        f();
+    }
+
+    return static_cast<double>(
+               hpx::chrono::high_resolution_clock::now() - start) /
+        (test_count * 1e9);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const size = vm["vector_size"].as<std::size_t>();
+    std::int64_t const num_keys = vm["num_keys"].as<std::int64_t>();
+    double const skew = vm["skew"].as<double>();
+    int const test_count = vm["test_count"].as<int>();
+    unsigned int const seed = vm["seed"].as<unsigned int>();
+
+    if (test_count <= 0 || num_keys <= 0 || skew <= 0)
+    {
+        hpx::cout << "test_count, num_keys, and skew have to be positive...\n"
+                  << std::flush;
+        return hpx::finalize();
+    }
+
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+    hpx::partitioned_vector<record_type> left =
+        make_records(size, num_keys, skew, seed, localities);
+    hpx::partitioned_vector<record_type> right =
+        make_records(size / 16, num_keys, 1.0, seed + 1, localities);
+
+    double const reduce_time = measure(test_count, [&]() {
+        hpx::unordered_map<std::int64_t, double> m(
+            hpx::container_layout(localities));
+        hpx::reduce_by_key(left, m, plus_op()).get();
+    });
+
+    double const group_time = measure(test_count, [&]() {
+        hpx::unordered_map<std::int64_t, grouped_type> m(
+            hpx::container_layout(localities));
+        hpx::group_by(left, m).get();
+    });
+
+    // the join produces a result per matching pair of records, only the
+    // smaller right hand side is therefore generated without skew
+    double const join_time = measure(test_count, [&]() {
+        hpx::unordered_map<std::int64_t, joined_type> m(
+            hpx::container_layout(localities));
+        hpx::hash_join(left, right, m).get();
+    });
+
+    hpx::cout << "localities: " << localities.size() << ", records: " << size
+              << ", keys: " << num_keys << ", skew: " << skew << "\n"
+              << "reduce_by_key: " << reduce_time << " [s]\n"
+              << "group_by: " << group_time << " [s]\n"
+              << "hash_join: " << join_time << " [s]\n"
+              << std::flush;
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(100000)
+        , "number of records (default: 100000)")
+
+        ("num_keys"
+        , hpx::program_options::value<std::int64_t>()->default_value(1000)
+        , "number of distinct keys (default: 1000)")
+
+        ("skew"
+        , hpx::program_options::value<double>()->default_value(4.0)
+        , "skew of the key distribution, 1 is uniform (default: 4)")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of tests to be averaged (default: 10)")
+
+        ("seed"
+        , hpx::program_options::value<unsigned int>()->default_value(42)
+        , "seed for the random key generator (default: 42)")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,163 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/components/containers/unordered/unordered_map_algorithms.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using record_type = std::pair<int, double>;
+using grouped_type = std::vector<double>;
+using joined_type = std::vector<std::pair<double, double>>;
+
+HPX_REGISTER_PARTITIONED_VECTOR(record_type)
+
+HPX_REGISTER_UNORDERED_MAP(int, double)
+HPX_REGISTER_UNORDERED_MAP(int, grouped_type)
+HPX_REGISTER_UNORDERED_MAP(int, joined_type)
+
+///////////////////////////////////////////////////////////////////////////////
+struct plus_op
+{
+    double operator()(double lhs, double rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+constexpr int num_keys = 17;
+
+hpx::partitioned_vector<record_type> make_records(
+    std::size_t size, std::size_t num_segments, int first_key = 0)
+{
+    std::vector<record_type> records(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        records[i] = record_type(first_key + static_cast<int>(i % num_keys),
+            static_cast<double>(i));
+    }
+
+    hpx::partitioned_vector<record_type> v(size,
+        hpx::container_layout(num_segments, hpx::find_all_localities()));
+    v.put_range(hpx::launch::sync, 0, records);
+    return v;
+}
+
+std::size_t count_key(std::size_t size, int key)
+{
+    return size / num_keys + (static_cast<std::size_t>(key) < size % num_keys);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void reduce_by_key_test(std::size_t size, std::size_t num_segments)
+{
+    hpx::partitioned_vector<record_type> v = make_records(size, num_segments);
+
+    hpx::unordered_map<int, double> m(
+        hpx::container_layout(3, hpx::find_all_localities()));
+    hpx::reduce_by_key(v, m, plus_op()).get();
+
+    std::vector<double> sums(num_keys, 0.0);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        sums[i % num_keys] += static_cast<double>(i);
+    }
+
+    HPX_TEST_EQ(m.size(), (std::min)(size, std::size_t(num_keys)));
+    for (int key = 0; key != num_keys && key < static_cast<int>(size); ++key)
+    {
+        HPX_TEST_EQ(m.get_value(hpx::launch::sync, key), sums[key]);
+    }
+
+    // the new values are combined with the existing ones
+    hpx::reduce_by_key(v, m, plus_op()).get();
+    for (int key = 0; key != num_keys && key < static_cast<int>(size); ++key)
+    {
+        HPX_TEST_EQ(m.get_value(hpx::launch::sync, key), 2 * sums[key]);
+    }
+}
+
+void group_by_test(std::size_t size, std::size_t num_segments)
+{
+    hpx::partitioned_vector<record_type> v = make_records(size, num_segments);
+
+    hpx::unordered_map<int, grouped_type> m(
+        hpx::container_layout(2, hpx::find_all_localities()));
+    hpx::group_by(v, m).get();
+
+    for (int key = 0; key != num_keys && key < static_cast<int>(size); ++key)
+    {
+        grouped_type values = m.get_value(hpx::launch::sync, key);
+        std::sort(values.begin(), values.end());
+
+        HPX_TEST_EQ(values.size(), count_key(size, key));
+        for (std::size_t i = 0; i != values.size(); ++i)
+        {
+            HPX_TEST_EQ(values[i], static_cast<double>(key + i * num_keys));
+        }
+    }
+}
+
+void hash_join_test(std::size_t size, std::size_t num_segments)
+{
+    // the keys of both sides overlap partially
+    int const offset = num_keys / 2;
+    hpx::partitioned_vector<record_type> left =
+        make_records(size, num_segments);
+    hpx::partitioned_vector<record_type> right =
+        make_records(size / 2, num_segments + 1, offset);
+
+    hpx::unordered_map<int, joined_type> m(
+        hpx::container_layout(4, hpx::find_all_localities()));
+    hpx::hash_join(left, right, m).get();
+
+    std::size_t num_joined_keys = 0;
+    for (int key = offset; key != num_keys; ++key)
+    {
+        std::size_t const count_left = count_key(size, key);
+        std::size_t const count_right = count_key(size / 2, key - offset);
+        if (count_left == 0 || count_right == 0)
+            continue;
+
+        ++num_joined_keys;
+
+        joined_type const values = m.get_value(hpx::launch::sync, key);
+        HPX_TEST_EQ(values.size(), count_left * count_right);
+        for (auto const& p : values)
+        {
+            HPX_TEST_EQ(static_cast<int>(p.first) % num_keys, key);
+            HPX_TEST_EQ(static_cast<int>(p.second) % num_keys, key - offset);
+        }
+    }
+    HPX_TEST_EQ(m.size(), num_joined_keys);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    reduce_by_key_test(1000, 1);
+    reduce_by_key_test(1000, 4);
+    reduce_by_key_test(10, 3);
+
+    group_by_test(1000, 1);
+    group_by_test(1000, 5);
+
+    hash_join_test(1000, 1);
+    hash_join_test(1000, 3);
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,292 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This example is a variant of example four. Instead of creating a new
+// dataflow graph of futures for every time step, the dependencies between the
+// partitions of a couple of time steps are recorded once into a task graph.
+// The task graph is then replayed until all time steps have been computed.
+// Replaying the graph does not allocate futures or register continuations,
+// which reduces the overheads per partition and time step compared to
+// example four. The results are identical to those of example four for the
+// same parameters.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/experimental/task_graph.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/iterator_support.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "print_time_results.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Command-line variables
+bool header = true;    // print csv heading
+double k = 0.5;        // heat transfer coefficient
+double dt = 1.;        // time step
+double dx = 1.;        // grid spacing
+
+inline std::size_t idx(std::size_t i, int dir, std::size_t size)
+{
+    if (i == 0 && dir == -1)
+        return size - 1;
+    if (i == size - 1 && dir == +1)
+        return 0;
+
+    HPX_ASSERT((i + dir) < size);
+
+    return i + dir;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Our partition data type
+struct partition_data
+{
+public:
+    explicit partition_data(std::size_t size)
+      : data_(new double[size])
+      , size_(size)
+    {
+    }
+
+    partition_data(std::size_t size, double initial_value)
+      : data_(new double[size])
+      , size_(size)
+    {
+        double base_value = double(initial_value * size);
+        for (std::size_t i = 0; i != size; ++i)
+            data_[i] = base_value + double(i);
+    }
+
+    partition_data(partition_data&& other) noexcept
+      : data_(std::move(other.data_))
+      , size_(other.size_)
+    {
+    }
+
+    double& operator[](std::size_t idx)
+    {
+        return data_[idx];
+    }
+    double operator[](std::size_t idx) const
+    {
+        return data_[idx];
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+private:
+    std::unique_ptr<double[]> data_;
+    std::size_t size_;
+};
+
+std::ostream& operator<<(std::ostream& os, partition_data const& c)
+{
+    os << "{";
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        if (i != 0)
+            os << ", ";
+        os << c[i];
+    }
+    os << "}";
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct stepper
+{
+    // Our data for one time step
+    typedef std::vector<partition_data> space;
+
+    // Our operator
+    static double heat(double left, double middle, double right)
+    {
+        return middle + (k * dt / (dx * dx)) * (left - 2 * middle + right);
+    }
+
+    // The partitioned operator, it invokes the heat operator above on all
+    // elements of a partition. The result is written to the preallocated
+    // partition 'next'.
+    static void heat_part(partition_data const& left,
+        partition_data const& middle, partition_data const& right,
+        partition_data& next)
+    {
+        std::size_t size = middle.size();
+
+        next[0] = heat(left[size - 1], middle[0], middle[1]);
+
+        for (std::size_t i = 1; i != size - 1; ++i)
+        {
+            next[i] = heat(middle[i - 1], middle[i], middle[i + 1]);
+        }
+
+        next[size - 1] = heat(middle[size - 2], middle[size - 1], right[0]);
+    }
+
+    // Record 'steps' time steps into the given task graph, starting with
+    // the data in U[0]. Partition i of a time step depends on the partitions
+    // i-1, i, and i+1 of the previous time step. As these are also the only
+    // tasks reading the data overwritten by partition i two time steps
+    // later, two buffers are sufficient.
+    static void record(hpx::experimental::task_graph& g,
+        std::vector<space>& U, std::size_t np, std::size_t steps)
+    {
+        using task = hpx::experimental::task_graph::task;
+
+        std::vector<task> current(np);
+        for (std::size_t t = 0; t != steps; ++t)
+        {
+            space const& from = U[t % 2];
+            space& to = U[(t + 1) % 2];
+
+            std::vector<task> next(np);
+            for (std::size_t i = 0; i != np; ++i)
+            {
+                auto op = [&from, &to, i, np]() {
+                    heat_part(from[idx(i, -1, np)], from[i],
+                        from[idx(i, +1, np)], to[i]);
+                };
+
+                if (t == 0)
+                {
+                    next[i] = g.async(op);
+                }
+                else
+                {
+                    next[i] = g.dataflow(op, current[idx(i, -1, np)],
+                        current[i], current[idx(i, +1, np)]);
+                }
+            }
+            current = std::move(next);
+        }
+    }
+
+    // do all the work on 'np' partitions, 'nx' data points each, for 'nt'
+    // time steps, record 'nd' time steps into one task graph
+    space do_work(
+        std::size_t np, std::size_t nx, std::size_t nt, std::uint64_t nd)
+    {
+        // U[t][i] is the state of position i at time t.
+        std::vector<space> U(2);
+        for (space& s : U)
+            s.reserve(np);
+
+        // Initial conditions: f(0, i) = i
+        for (std::size_t i = 0; i != np; ++i)
+        {
+            U[0].emplace_back(nx, double(i));
+            U[1].emplace_back(nx);
+        }
+
+        // the number of recorded time steps has to be even for the data to
+        // end up in U[0] after every replay
+        std::size_t const steps = nd < 2 ? 2 : nd - nd % 2;
+
+        hpx::experimental::task_graph g;
+        record(g, U, np, steps);
+
+        // Actual time step loop
+        std::size_t t = 0;
+        for (/**/; t + steps <= nt; t += steps)
+        {
+            g.replay().get();
+        }
+
+        // remaining time steps
+        if (t != nt)
+        {
+            hpx::experimental::task_graph rest;
+            record(rest, U, np, nt - t);
+            rest.replay().get();
+        }
+
+        // Return the solution at time-step 'nt'.
+        return std::move(U[(nt - t) % 2]);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t np = vm["np"].as<std::uint64_t>();    // Number of partitions.
+    std::uint64_t nx =
+        vm["nx"].as<std::uint64_t>();    // Number of grid points.
+    std::uint64_t nt = vm["nt"].as<std::uint64_t>();    // Number of steps.
+    std::uint64_t nd =
+        vm["nd"].as<std::uint64_t>();    // Recorded time steps.
+
+    if (vm.count("no-header"))
+        header = false;
+
+    // Create the stepper object
+    stepper step;
+
+    // Measure execution time.
+    std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+
+    // Execute nt time steps on nx grid points.
+    stepper::space solution = step.do_work(np, nx, nt, nd);
+
+    std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now() - t;
+
+    // Print the final solution
+    if (vm.count("results"))
+    {
+        for (std::size_t i = 0; i != np; ++i)
+            std::cout << "U[" << i << "] = " << solution[i] << std::endl;
+    }
+
+    std::uint64_t const os_thread_count = hpx::get_os_thread_count();
+    print_time_results(os_thread_count, elapsed, nx, np, nt, header);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    // Configure application-specific options.
+    options_description desc_commandline;
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("results", "print generated results (default: false)")
+        ("nx", value<std::uint64_t>()->default_value(10),
+         "Local x dimension (of each partition)")
+        ("nt", value<std::uint64_t>()->default_value(45),
+         "Number of time steps")
+        ("nd", value<std::uint64_t>()->default_value(10),
+         "Number of time steps to record into the task graph")
+        ("np", value<std::uint64_t>()->default_value(10),
+         "Number of partitions")
+        ("k", value<double>(&k)->default_value(0.5),
+         "Heat transfer coefficient (default: 0.5)")
+        ("dt", value<double>(&dt)->default_value(1.0),
+         "Timestep unit (default: 1.0[s])")
+        ("dx", value<double>(&dx)->default_value(1.0),
+         "Local x dimension")
+        ( "no-header", "do not print out the csv header row")
+    ;
+    // clang-format on
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
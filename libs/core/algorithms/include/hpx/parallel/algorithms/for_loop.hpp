@@ -804,6 +804,15 @@ namespace hpx::parallel {
             (hpx::get<Is>(args).exit_iteration(size), ...);
         }
 
+        // The end of each chunk is a safe point for long running HPX threads
+        // to give other threads a chance to run (see hpx.time_slice).
+        HPX_HOST_DEVICE HPX_FORCEINLINE void end_of_chunk() noexcept
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            hpx::this_thread::yield_if_slice_expired();
+#endif
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename ExPolicy, typename F, typename S = void,
             typename Tuple = hpx::tuple<>>
@@ -881,6 +890,8 @@ namespace hpx::parallel {
                         detail::next_iteration(args_, pack);
                     }
                 }
+
+                end_of_chunk();
             }
 
             template <typename Archive>
@@ -932,6 +943,8 @@ namespace hpx::parallel {
                 HPX_ASSERT(stride_ == 1);
                 parallel::util::loop_n<std::decay_t<ExPolicy>>(
                     part_begin, part_steps, f_);
+
+                end_of_chunk();
             }
 
             template <typename B>
@@ -941,8 +954,10 @@ namespace hpx::parallel {
                 if (stride_ == 1)
                 {
                     (*this)(part_begin, part_steps);
+                    return;
                 }
-                else if (stride_ > 0)
+
+                if (stride_ > 0)
                 {
                     while (part_steps >= static_cast<std::size_t>(stride_))
                     {
@@ -974,6 +989,8 @@ namespace hpx::parallel {
                         HPX_INVOKE(f_, part_begin);
                     }
                 }
+
+                end_of_chunk();
             }
 
             template <typename Archive>
@@ -1043,6 +1060,8 @@ namespace hpx::parallel {
                         detail::next_iteration(args_, pack);
                     }
                 }
+
+                end_of_chunk();
             }
 
             template <typename Archive>
@@ -1099,6 +1118,8 @@ namespace hpx::parallel {
                     parallel::util::loop_n<std::decay_t<ExPolicy>>(
                         part_begin, part_steps, f_);
                 }
+
+                end_of_chunk();
             }
 
             template <typename Archive>
@@ -20,7 +20,8 @@ namespace hpx { namespace experimental {
     /// the value being the
     /// GENERALIZED_NONCOMMUTATIVE_SUM(op, init, *first, ..., *(first + (i - result))).
     /// for the run of consecutive matching keys.
-    /// The number of keys supplied must match the number of values.
+    /// The number of keys supplied must match the number of values. The
+    /// output ranges may be the same as the input ranges.
     ///
     /// \note   Complexity: O(\a last - \a first) applications of the
     ///         predicate \a op.
@@ -97,6 +98,10 @@ namespace hpx { namespace experimental {
     /// permitted to execute in an unordered fashion in unspecified
     /// threads, and indeterminately sequenced within each thread.
     ///
+    /// If the algorithm is invoked with one of the simd execution policies
+    /// the values of each run of equal keys are reduced using vector packs,
+    /// in this case \a func has to be callable with vector pack arguments.
+    ///
     /// \returns  The \a reduce_by_key algorithm returns a
     ///           \a hpx::future<pair<Iter1,Iter2>> if the execution policy is of
     ///           type
@@ -121,330 +126,211 @@ namespace hpx { namespace experimental {
 #else
 
 #include <hpx/config.hpp>
-#include <hpx/datastructures/tuple.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/optional.hpp>
 #include <hpx/execution/executors/execution.hpp>
-#include <hpx/iterator_support/range.hpp>
-#include <hpx/iterator_support/transform_iterator.hpp>
-#include <hpx/parallel/algorithms/for_each.hpp>
-#include <hpx/parallel/algorithms/inclusive_scan.hpp>
-#include <hpx/parallel/container_algorithms/copy.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/deferred_call.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/result_types.hpp>
-#include <hpx/parallel/util/zip_iterator.hpp>
+#include <hpx/type_support/empty_function.hpp>
 
-#include <cstdint>
+#include <cstddef>
 #include <functional>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
-/// \cond NOINTERNAL
-#ifdef EXTRA_DEBUG
-#include <iostream>
-#define DEBUG_REDUCE_BY_KEY(a) std::cout << a
-#else
-#define DEBUG_REDUCE_BY_KEY(a)
-#endif
-/// \endcond
-
 namespace hpx::parallel::detail {
     /// \cond NOINTERNAL
 
     // -------------------------------------------------------------------
-    // simple iterator helper object for access to prev/next items
+    // The keys and values are processed as two separate sequences
+    // (structure of arrays). A run of equal consecutive keys is located by
+    // comparing the keys only, its values are then reduced with a plain
+    // sequential reduction over a contiguous range of values, which is
+    // vectorized for the simd execution policies.
     // -------------------------------------------------------------------
-    struct reduce_stencil_transformer
+    template <typename KeyIter, typename Compare>
+    std::size_t reduce_by_key_run_end(KeyIter keys, std::size_t first,
+        std::size_t count, Compare& comp)
     {
-        // declare result type as a template
-        template <typename T>
-        struct result;
-
-        // specialize result for iterator type
-        template <typename This, typename Iterator>
-        struct result<This(Iterator)>
+        std::size_t last = first + 1;
+        while (last != count && HPX_INVOKE(comp, keys[last - 1], keys[last]))
         {
-            using element_type =
-                typename std::iterator_traits<Iterator>::reference;
-            using type = hpx::tuple<element_type, element_type, element_type>;
-        };
-
-        // call operator for stencil transform
-        // it will dereference tuple(it-1, it, it+1)
-        template <typename Iterator>
-        typename result<reduce_stencil_transformer(Iterator)>::type operator()(
-            Iterator const& it) const
-        {
-            using type =
-                typename result<reduce_stencil_transformer(Iterator)>::type;
-            return type(*std::prev(it), *it, *std::next(it));
+            ++last;
         }
-    };
+        return last;
+    }
 
-    // -------------------------------------------------------------------
-    // transform iterator using reduce_stencil_transformer helper
-    // -------------------------------------------------------------------
-    template <typename Iterator,
-        typename Transformer = detail::reduce_stencil_transformer>
-    class reduce_stencil_iterator
-      : public hpx::util::transform_iterator<Iterator, Transformer>
+    template <typename ExPolicy, typename ValueIter, typename Func>
+    typename std::iterator_traits<ValueIter>::value_type reduce_by_key_run(
+        ValueIter values, std::size_t first, std::size_t last, Func& func)
     {
-    private:
-        using base_type = hpx::util::transform_iterator<Iterator, Transformer>;
-
-    public:
-        reduce_stencil_iterator() = default;
+        using value_type = typename std::iterator_traits<ValueIter>::value_type;
 
-        explicit reduce_stencil_iterator(Iterator const& it)
-          : base_type(it, Transformer())
-        {
-        }
-
-        reduce_stencil_iterator(Iterator const& it, Transformer const& t)
-          : base_type(it, t)
-        {
-        }
-    };
-
-    template <typename Iterator, typename Transformer>
-    reduce_stencil_iterator<Iterator, Transformer> make_reduce_stencil_iterator(
-        Iterator const& it, Transformer const& t)
-    {
-        return reduce_stencil_iterator<Iterator, Transformer>(it, t);
+        value_type init = values[first];
+        return sequential_reduce<ExPolicy>(
+            values + (first + 1), last - first - 1, HPX_MOVE(init), func);
     }
 
     // -------------------------------------------------------------------
-    // state of a reduce by key step
+    // result of reducing the runs of one partition of the input, the
+    // leading elements continue a run started in a preceding partition
     // -------------------------------------------------------------------
-    struct reduce_key_series_states
+    template <typename Key, typename Value>
+    struct reduce_by_key_partition
     {
-        bool start;    // START of a segment
-        bool end;      // END of a segment
-
-        explicit reduce_key_series_states(bool s = false, bool e = false)
-          : start(s)
-          , end(e)
-        {
-        }
+        hpx::optional<Value> lead;
+        std::vector<Key> keys;
+        std::vector<Value> values;
+        std::size_t offset = 0;
     };
 
-    // -------------------------------------------------------------------
-    // callable that actually computes the state using the stencil iterator
-    // -------------------------------------------------------------------
-    template <typename Transformer, typename StencilIterType,
-        typename KeyStateIterType, typename Compare>
-    struct reduce_stencil_generate
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2, typename Compare, typename Func>
+    util::in_out_result<FwdIter1, FwdIter2> sequential_reduce_by_key(
+        RanIter key_first, RanIter key_last, RanIter2 values_first,
+        FwdIter1 keys_output, FwdIter2 values_output, Compare& comp,
+        Func& func)
     {
-        using element_type = typename Transformer::template result<Transformer(
-            StencilIterType)>::element_type;
-        using tuple_type = typename Transformer::template result<Transformer(
-            StencilIterType)>::type;
-        using KeyStateType =
-            typename std::iterator_traits<KeyStateIterType>::reference;
-
-        reduce_stencil_generate() {}
-
-        void operator()(tuple_type const& value, KeyStateType& kiter,
-            Compare const& comp) const
+        // every run is reduced before its key and value are written, the
+        // output may therefore alias the input
+        std::size_t const count = std::distance(key_first, key_last);
+        for (std::size_t run = 0; run != count; /**/)
         {
-            // resolves to a tuple of values for *(it-1), *it, *(it+1)
-            element_type left = hpx::get<0>(value);
-            element_type mid = hpx::get<1>(value);
-            element_type right = hpx::get<2>(value);
-
-            // we need to determine which of three states this
-            // index is. It can be:
-            // 1. Middle of a set of equivalent keys.
-            // 2. Start of a set of equivalent keys.
-            // 3. End of a set of equivalent keys.
-            // 4. Both the start and end of a set of keys
-
-            bool const left_matches(comp(left, mid));
-            bool const right_matches(comp(mid, right));
-            kiter = reduce_key_series_states(!left_matches, !right_matches);
-        }
-    };
+            std::size_t const next =
+                reduce_by_key_run_end(key_first, run, count, comp);
 
-    // -------------------------------------------------------------------
-    // helper that extracts the final output iterators from copy_if
-    // -------------------------------------------------------------------
-    // Zip iterator has 3 iterators inside
-    // Iter1, key type : Iter2, value type : Iter3, state type
-    template <typename ZIter, typename iKey, typename iVal>
-    constexpr util::in_out_result<iKey, iVal> make_pair_result(
-        ZIter zipiter, iKey key_start, iVal val_start)
-    {
-        // the iterator we want is 'second' part of pair type (from copy_if)
-        auto t = zipiter.out.get_iterator_tuple();
-        iKey key_end = hpx::get<0>(t);
-        return util::in_out_result<iKey, iVal>{
-            key_end, std::next(val_start, std::distance(key_start, key_end))};
-    }
+            auto value =
+                reduce_by_key_run<ExPolicy>(values_first, run, next, func);
 
-    // async version that returns future<pair> from future<zip_iterator<blah>>
-    template <typename ZIter, typename iKey, typename iVal>
-    hpx::future<util::in_out_result<iKey, iVal>> make_pair_result(
-        hpx::future<ZIter>&& ziter, iKey key_start, iVal val_start)
-    {
-        using result_type = util::in_out_result<iKey, iVal>;
-
-        return hpx::make_future<result_type>(
-            HPX_MOVE(ziter), [=](ZIter zipiter) {
-                auto t = zipiter.second.get_iterator_tuple();
-                iKey key_end = hpx::get<0>(t);
-                return result_type{key_end,
-                    std::next(val_start, std::distance(key_start, key_end))};
-            });
+            *keys_output++ = key_first[run];
+            *values_output++ = HPX_MOVE(value);
+
+            run = next;
+        }
+        return {keys_output, values_output};
     }
 
     // -------------------------------------------------------------------
-    // The main algorithm is implemented here, it replaces any async execution
-    // policy with a non async one so that no waits are necessary on the
-    // internal algorithms. Async execution is handled by the wrapper layer that
-    // calls this.
+    // The parallel algorithm runs in two passes. The first pass reduces
+    // all runs starting in each partition of the input into partition local
+    // buffers. After the partial results of runs spanning partitions have
+    // been combined, the second pass copies the buffers to their final
+    // positions in the output. No output is written before all of the input
+    // has been read, which allows for the output to alias the input.
     // -------------------------------------------------------------------
     template <typename ExPolicy, typename RanIter, typename RanIter2,
         typename FwdIter1, typename FwdIter2, typename Compare, typename Func>
-    static util::in_out_result<FwdIter1, FwdIter2> reduce_by_key_impl(
+    util::in_out_result<FwdIter1, FwdIter2> reduce_by_key_impl(
         ExPolicy&& policy, RanIter key_first, RanIter key_last,
         RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
         Compare&& comp, Func&& func)
     {
-        using namespace hpx::parallel::detail;
-        using namespace hpx::util;
-
-        // we need to determine based on the keys what is the key state for each
-        // key. The states are start, middle, end of a series and the special
-        // state start and end of the sequence
-        std::vector<reduce_key_series_states> key_state;
-        using keystate_iter_type =
-            std::vector<reduce_key_series_states>::iterator;
-        using reducebykey_iter = detail::reduce_stencil_iterator<RanIter,
-            reduce_stencil_transformer>;
-        using element_type = typename std::iterator_traits<RanIter>::reference;
-        using zip_ref = typename zip_iterator<reducebykey_iter,
-            keystate_iter_type>::reference;
-        //
-        const std::uint64_t number_of_keys = std::distance(key_first, key_last);
-        //
-        key_state.assign(number_of_keys, reduce_key_series_states());
-        {
-            reduce_stencil_transformer r_s_t;
-            reducebykey_iter reduce_begin =
-                make_reduce_stencil_iterator(key_first, r_s_t);
-            reducebykey_iter reduce_end =
-                make_reduce_stencil_iterator(key_last, r_s_t);
+        // internal passes are synchronous, asynchronous execution is
+        // handled by the caller
+        auto sync_policy = policy(hpx::execution::non_task);
+        using policy_type = decltype(sync_policy);
+
+        using key_type = typename std::iterator_traits<RanIter>::value_type;
+        using value_type = typename std::iterator_traits<RanIter2>::value_type;
+        using partition_type = reduce_by_key_partition<key_type, value_type>;
+        using result_type = util::in_out_result<FwdIter1, FwdIter2>;
+
+        std::size_t const count = std::distance(key_first, key_last);
 
-            // FIXME: handle cases number_of_keys == 0 and
-            //        number_of_keys == 1
+        auto reduce_partition = [=, &comp, &func](RanIter part_begin,
+                                    std::size_t part_size) -> partition_type {
+            std::size_t const base = std::distance(key_first, part_begin);
+            RanIter2 values = std::next(values_first, base);
 
-            if (number_of_keys == 2)
+            partition_type part;
+
+            std::size_t run = 0;
+            if (base != 0 &&
+                HPX_INVOKE(comp, *std::prev(part_begin), *part_begin))
             {
-                // for two entries, one is a start, the other an end,
-                // if they are different, then they are both start/end
-                element_type left = *key_first;
-                element_type right = *std::next(key_first);
-                key_state[0] =
-                    reduce_key_series_states(true, !comp(left, right));
-                key_state[1] =
-                    reduce_key_series_states(!comp(left, right), true);
+                run = reduce_by_key_run_end(part_begin, 0, part_size, comp);
+                part.lead =
+                    reduce_by_key_run<policy_type>(values, 0, run, func);
             }
-            else
+
+            while (run != part_size)
             {
-                // do the first and last elements by hand to simplify the iterator
-                // traversal as there is no prev/next for first/last
-                element_type elem0 = *key_first;
-                element_type elem1 = *std::next(key_first);
-                key_state[0] = reduce_key_series_states(true, elem0 != elem1);
-                // middle elements
-                reduce_stencil_generate<reduce_stencil_transformer, RanIter,
-                    keystate_iter_type, Compare>
-                    kernel;
-                hpx::for_each(policy(hpx::execution::non_task),
-                    zip_iterator(reduce_begin + 1, key_state.begin() + 1),
-                    zip_iterator(reduce_end - 1, key_state.end() - 1),
-                    [&kernel, &comp](zip_ref ref) {
-                        kernel(hpx::get<0>(ref), hpx::get<1>(ref), comp);
-                    });
-                // Last element
-                element_type elem_n = *std::prev(key_last);
-                element_type elemn = *std::prev(std::prev(key_last));
-                key_state.back() =
-                    reduce_key_series_states(elem_n != elemn, true);
+                std::size_t const next =
+                    reduce_by_key_run_end(part_begin, run, part_size, comp);
+
+                part.keys.push_back(part_begin[run]);
+                part.values.push_back(
+                    reduce_by_key_run<policy_type>(values, run, next, func));
+
+                run = next;
             }
-        }
-        {
-            using zip_iterator_in = zip_iterator<RanIter2,
-                std::vector<reduce_key_series_states>::iterator>;
-            using zip_type_in = typename zip_iterator_in::value_type;
-
-            using zip_iterator_vout = zip_iterator<FwdIter2,
-                std::vector<reduce_key_series_states>::iterator>;
-
-            using value_type =
-                typename std::iterator_traits<RanIter2>::value_type;
-
-            zip_iterator_in states_begin =
-                zip_iterator(values_first, hpx::util::begin(key_state));
-            zip_iterator_in states_end = zip_iterator(
-                values_first + number_of_keys, hpx::util::end(key_state));
-            zip_iterator_vout states_out_begin =
-                zip_iterator(values_output, hpx::util::begin(key_state));
-
-            zip_type_in initial;
-            //
-            using lambda_type =
-                hpx::tuple<value_type, reduce_key_series_states>;
-            hpx::inclusive_scan(
-                policy(hpx::execution::non_task), states_begin, states_end,
-                states_out_begin,
-                // B is the current entry, A is the one passed in from 'previous'
-                [&func](zip_type_in a, zip_type_in b) -> lambda_type {
-                    value_type a_val = hpx::get<0>(a);
-                    reduce_key_series_states const a_state = hpx::get<1>(a);
-                    value_type b_val = hpx::get<0>(b);
-                    reduce_key_series_states const b_state = hpx::get<1>(b);
-                    DEBUG_REDUCE_BY_KEY("{ " << a_val << "+" << b_val << " },\t"
-                                             << a_state << b_state);
-                    // if carrying a start flag, then copy - don't add
-                    if (b_state.start)
-                    {
-                        DEBUG_REDUCE_BY_KEY(" = " << b_val << std::endl);
-                        return hpx::make_tuple(b_val,
-                            reduce_key_series_states(
-                                a_state.start || b_state.start, b_state.end));
-                    }
-
-                    // normal add of previous + this
-                    DEBUG_REDUCE_BY_KEY(
-                        " = " << func(a_val, b_val) << std::endl);
-
-                    value_type temp = func(a_val, b_val);
-                    return hpx::make_tuple(temp,
-                        reduce_key_series_states(
-                            a_state.start || b_state.start, b_state.end));
-                },
-                initial);
-
-            // now copy the values and keys for each element that is marked by
-            // an 'END' state to the final output
-            using zip2_ref = typename hpx::util::zip_iterator<RanIter, FwdIter2,
-                std::vector<reduce_key_series_states>::iterator>::reference;
-
-            std::vector<value_type> temp(number_of_keys);
-            hpx::copy(policy(hpx::execution::non_task), values_output,
-                values_output + number_of_keys, temp.begin());
-
-            return make_pair_result(
-                hpx::ranges::copy_if(policy(hpx::execution::non_task),
-                    zip_iterator(
-                        key_first, temp.begin(), hpx::util::begin(key_state)),
-                    zip_iterator(key_last, temp.begin() + number_of_keys,
-                        hpx::util::end(key_state)),
-                    zip_iterator(keys_output, values_output,
-                        hpx::util::begin(key_state)),
-                    // copies to dest only when 'end' state is true
-                    [](zip2_ref it) { return hpx::get<2>(it).end; }),
-                keys_output, values_output);
-        }
+            return part;
+        };
+
+        auto copy_partitions = [=](auto part_begin, std::size_t part_size) {
+            for (/**/; part_size != 0; (void) ++part_begin, --part_size)
+            {
+                partition_type& part = *part_begin;
+
+                auto keys_dest = std::next(keys_output, part.offset);
+                for (auto& key : part.keys)
+                {
+                    *keys_dest++ = HPX_MOVE(key);
+                }
+
+                auto values_dest = std::next(values_output, part.offset);
+                for (auto& value : part.values)
+                {
+                    *values_dest++ = HPX_MOVE(value);
+                }
+            }
+        };
+
+        auto combine_partitions =
+            [&, keys_output, values_output](auto&& parts) -> result_type {
+            // the first partition always starts a new run, the lead of any
+            // other partition is combined with the last run started before
+            // it, in order
+            value_type* last_value = nullptr;
+            std::size_t offset = 0;
+            for (auto& part : parts)
+            {
+                if (part.lead)
+                {
+                    HPX_ASSERT(last_value != nullptr);
+                    *last_value = HPX_INVOKE(
+                        func, HPX_MOVE(*last_value), HPX_MOVE(*part.lead));
+                }
+                if (!part.values.empty())
+                {
+                    last_value = &part.values.back();
+                }
+
+                part.offset = offset;
+                offset += part.keys.size();
+            }
+
+            util::partitioner<policy_type>::call(sync_policy, parts.begin(),
+                parts.size(), copy_partitions, hpx::util::empty_function());
+
+            return result_type{std::next(keys_output, offset),
+                std::next(values_output, offset)};
+        };
+
+        return util::partitioner<policy_type, result_type,
+            partition_type>::call(sync_policy, key_first, count,
+            HPX_MOVE(reduce_partition), hpx::unwrapping(combine_partitions));
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -463,13 +349,12 @@ namespace hpx::parallel::detail {
         template <typename ExPolicy, typename RanIter, typename RanIter2,
             typename Compare, typename Func>
         static constexpr util::in_out_result<FwdIter1, FwdIter2> sequential(
-            ExPolicy&& policy, RanIter key_first, RanIter key_last,
+            ExPolicy&&, RanIter key_first, RanIter key_last,
             RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
             Compare&& comp, Func&& func)
         {
-            return reduce_by_key_impl(HPX_FORWARD(ExPolicy, policy), key_first,
-                key_last, values_first, keys_output, values_output,
-                HPX_FORWARD(Compare, comp), HPX_FORWARD(Func, func));
+            return sequential_reduce_by_key<std::decay_t<ExPolicy>>(key_first,
+                key_last, values_first, keys_output, values_output, comp, func);
         }
 
         template <typename ExPolicy, typename RanIter, typename RanIter2,
@@ -497,15 +382,6 @@ namespace hpx::parallel::detail {
 
 namespace hpx::experimental {
 
-#ifdef EXTRA_DEBUG
-    std::ostream& operator<<(
-        std::ostream& os, detail::reduce_key_series_states const& rs)
-    {
-        os << "{ start=" << rs.start << ",end=" << rs.end << "} ";
-        return os;
-    }
-#endif
-
     // clang-format off
     template <typename ExPolicy, typename RanIter, typename RanIter2,
         typename FwdIter1, typename FwdIter2,
@@ -533,13 +409,8 @@ namespace hpx::experimental {
                 hpx::traits::is_forward_iterator_v<FwdIter2>,
             "iterators : Random_access for inputs and forward for outputs.");
 
-        std::uint64_t const number_of_keys = std::distance(key_first, key_last);
-
-        if (number_of_keys <= 1)
+        if (key_first == key_last)
         {
-            // we only have a single key/value so that is our output
-            *keys_output = *key_first;
-            *values_output = *values_first;
             return result::get(
                 hpx::parallel::util::in_out_result<FwdIter1, FwdIter2>{
                     keys_output, values_output});
@@ -0,0 +1,464 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/transpose.hpp
+/// \page hpx::experimental::transpose, hpx::experimental::for_each_tile
+/// \headerfile hpx/parallel/algorithms/transpose.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Invokes the given function for each tile of a two-dimensional index
+    /// space [0, rows) x [0, cols). The index space is divided into tiles of
+    /// \a tile_rows x \a tile_cols indices, the tiles at the lower and right
+    /// border may be smaller. The tiles are enumerated row by row and
+    /// consecutive tiles are handed to the same task, which keeps the
+    /// assignment of memory to tasks stable between invocations using the
+    /// same execution policy. When used with an executor bound to NUMA
+    /// domains and a static chunk size this places each tile on the domain
+    /// that touched the corresponding memory first.
+    ///
+    /// \note   Complexity: Applies \a f exactly once for each tile.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rows         The number of rows of the index space.
+    /// \param cols         The number of columns of the index space.
+    /// \param tile_rows    The number of rows of a tile.
+    /// \param tile_cols    The number of columns of a tile.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each tile. The signature of
+    ///                     this function should be equivalent to:
+    ///                     \code
+    ///                     void f(std::size_t row_first, std::size_t row_last,
+    ///                         std::size_t col_first, std::size_t col_last);
+    ///                     \endcode \n
+    ///                     where the arguments describe the half-open index
+    ///                     ranges covered by the tile.
+    ///
+    /// \returns  The \a for_each_tile algorithm returns a \a hpx::future<void>
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns void otherwise.
+    ///
+    template <typename ExPolicy, typename F>
+    util::detail::algorithm_result_t<ExPolicy> for_each_tile(
+        ExPolicy&& policy, std::size_t rows, std::size_t cols,
+        std::size_t tile_rows, std::size_t tile_cols, F&& f);
+
+    /// Writes the transpose of the \a rows x \a cols matrix stored in row
+    /// major order starting at \a first to the \a cols x \a rows matrix
+    /// starting at \a dest. The matrices may not overlap.
+    ///
+    /// The destination is divided into square tiles which are distributed
+    /// over the tasks as described for \a for_each_tile. Every tile is
+    /// transposed by recursively halving its longer side until the remaining
+    /// block of both matrices fits into the cache, independently of the
+    /// actual cache size.
+    ///
+    /// \note   Complexity: Performs exactly \a rows * \a cols assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the source iterator used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RandIter2   The type of the destination iterator used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the source matrix.
+    /// \param rows         The number of rows of the source matrix.
+    /// \param cols         The number of columns of the source matrix.
+    /// \param dest         Refers to the beginning of the destination matrix.
+    ///
+    /// The assignments in the parallel \a transpose algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a transpose algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a transpose algorithm returns a
+    ///           \a hpx::future<RandIter2> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter2 otherwise. The iterator refers to the
+    ///           element following the last element of the destination
+    ///           matrix.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2>
+    util::detail::algorithm_result_t<ExPolicy, RandIter2> transpose(
+        ExPolicy&& policy, RandIter1 first, std::size_t rows,
+        std::size_t cols, RandIter2 dest);
+
+    /// Writes the transpose of the \a rows x \a cols matrix stored in row
+    /// major order starting at \a first to the \a cols x \a rows matrix
+    /// starting at \a dest. The matrices may not overlap.
+    ///
+    /// \note   Complexity: Performs exactly \a rows * \a cols assignments.
+    ///
+    /// \tparam RandIter1   The type of the source iterator used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RandIter2   The type of the destination iterator used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    ///
+    /// \param first        Refers to the beginning of the source matrix.
+    /// \param rows         The number of rows of the source matrix.
+    /// \param cols         The number of columns of the source matrix.
+    /// \param dest         Refers to the beginning of the destination matrix.
+    ///
+    /// \returns  The \a transpose algorithm returns \a RandIter2, referring
+    ///           to the element following the last element of the
+    ///           destination matrix.
+    ///
+    template <typename RandIter1, typename RandIter2>
+    RandIter2 transpose(RandIter1 first, std::size_t rows, std::size_t cols,
+        RandIter2 dest);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/type_support/empty_function.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // tiles handed to the tasks by transpose, and the size below which the
+    // recursive subdivision of a tile stops
+    inline constexpr std::size_t transpose_tile_size = 64;
+    inline constexpr std::size_t transpose_block_size = 16;
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct tile_iteration
+    {
+        std::size_t rows;
+        std::size_t cols;
+        std::size_t tile_rows;
+        std::size_t tile_cols;
+
+        constexpr std::size_t tiles_per_row() const noexcept
+        {
+            return (cols + tile_cols - 1) / tile_cols;
+        }
+
+        constexpr std::size_t size() const noexcept
+        {
+            return ((rows + tile_rows - 1) / tile_rows) * tiles_per_row();
+        }
+
+        template <typename F>
+        void operator()(F& f, std::size_t first, std::size_t count) const
+        {
+            std::size_t const per_row = tiles_per_row();
+            for (std::size_t tile = first; tile != first + count; ++tile)
+            {
+                std::size_t const row_first = (tile / per_row) * tile_rows;
+                std::size_t const col_first = (tile % per_row) * tile_cols;
+
+                HPX_INVOKE(f, row_first,
+                    (std::min)(row_first + tile_rows, rows), col_first,
+                    (std::min)(col_first + tile_cols, cols));
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct for_each_tile : public algorithm<for_each_tile>
+    {
+        constexpr for_each_tile() noexcept
+          : for_each_tile::algorithm("for_each_tile")
+        {
+        }
+
+        template <typename ExPolicy, typename F>
+        static hpx::util::unused_type sequential(
+            ExPolicy&&, tile_iteration const& tiles, F&& f)
+        {
+            tiles(f, 0, tiles.size());
+            return {};
+        }
+
+        template <typename ExPolicy, typename F>
+        static decltype(auto) parallel(
+            ExPolicy&& policy, tile_iteration const& tiles, F&& f)
+        {
+            constexpr bool is_scheduler_policy =
+                hpx::execution_policy_has_scheduler_executor_v<ExPolicy>;
+
+            std::size_t const count = tiles.size();
+            if constexpr (!is_scheduler_policy)
+            {
+                if (count == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy>::get();
+                }
+            }
+
+            auto f1 = [tiles, f = HPX_FORWARD(F, f)](std::size_t part_begin,
+                          std::size_t part_size) mutable {
+                tiles(f, part_begin, part_size);
+            };
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy> ||
+                is_scheduler_policy)
+            {
+                return util::detail::algorithm_result<ExPolicy>::get(
+                    util::partitioner<ExPolicy>::call(
+                        HPX_FORWARD(ExPolicy, policy), std::size_t(0), count,
+                        HPX_MOVE(f1), hpx::util::empty_function()));
+            }
+            else
+            {
+                util::partitioner<ExPolicy>::call(
+                    HPX_FORWARD(ExPolicy, policy), std::size_t(0), count,
+                    HPX_MOVE(f1), hpx::util::empty_function());
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Cache-oblivious transpose of the block [row_first, row_last) x
+    // [col_first, col_last) of the source, the longer side is halved until
+    // the block is small enough to be transposed directly.
+    template <typename RandIter1, typename RandIter2>
+    void transpose_block(RandIter1 src, RandIter2 dest, std::size_t rows,
+        std::size_t cols, std::size_t row_first, std::size_t row_last,
+        std::size_t col_first, std::size_t col_last)
+    {
+        while (true)
+        {
+            std::size_t const num_rows = row_last - row_first;
+            std::size_t const num_cols = col_last - col_first;
+
+            if (num_rows <= transpose_block_size &&
+                num_cols <= transpose_block_size)
+            {
+                for (std::size_t row = row_first; row != row_last; ++row)
+                {
+                    for (std::size_t col = col_first; col != col_last; ++col)
+                    {
+                        dest[col * rows + row] = src[row * cols + col];
+                    }
+                }
+                return;
+            }
+
+            if (num_rows >= num_cols)
+            {
+                std::size_t const row_mid = row_first + num_rows / 2;
+                transpose_block(src, dest, rows, cols, row_first, row_mid,
+                    col_first, col_last);
+                row_first = row_mid;
+            }
+            else
+            {
+                std::size_t const col_mid = col_first + num_cols / 2;
+                transpose_block(src, dest, rows, cols, row_first, row_last,
+                    col_first, col_mid);
+                col_first = col_mid;
+            }
+        }
+    }
+
+    template <typename RandIter1, typename RandIter2>
+    struct transpose_tile
+    {
+        RandIter1 src;
+        RandIter2 dest;
+        std::size_t rows;
+        std::size_t cols;
+
+        // the tiles are given in coordinates of the destination matrix
+        void operator()(std::size_t row_first, std::size_t row_last,
+            std::size_t col_first, std::size_t col_last) const
+        {
+            transpose_block(src, dest, rows, cols, col_first, col_last,
+                row_first, row_last);
+        }
+    };
+
+    template <typename RandIter2>
+    struct transpose : public algorithm<transpose<RandIter2>, RandIter2>
+    {
+        constexpr transpose() noexcept
+          : algorithm<transpose, RandIter2>("transpose")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter1>
+        static RandIter2 sequential(ExPolicy&&, RandIter1 first,
+            std::size_t rows, std::size_t cols, RandIter2 dest)
+        {
+            transpose_block(first, dest, rows, cols, 0, rows, 0, cols);
+            return std::next(dest, rows * cols);
+        }
+
+        template <typename ExPolicy, typename RandIter1>
+        static decltype(auto) parallel(ExPolicy&& policy, RandIter1 first,
+            std::size_t rows, std::size_t cols, RandIter2 dest)
+        {
+            RandIter2 last = std::next(dest, rows * cols);
+
+            tile_iteration const tiles{
+                cols, rows, transpose_tile_size, transpose_tile_size};
+
+            std::size_t const count = tiles.size();
+            if constexpr (!hpx::execution_policy_has_scheduler_executor_v<
+                              ExPolicy>)
+            {
+                if (count == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        RandIter2>::get(HPX_MOVE(last));
+                }
+            }
+
+            return util::partitioner<ExPolicy, RandIter2>::call(
+                HPX_FORWARD(ExPolicy, policy), std::size_t(0), count,
+                [tiles,
+                    f = transpose_tile<RandIter1, RandIter2>{
+                        first, dest, rows, cols}](std::size_t part_begin,
+                    std::size_t part_size) mutable {
+                    tiles(f, part_begin, part_size);
+                },
+                [last](auto&&) { return last; });
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr struct for_each_tile_t final
+      : hpx::detail::tag_parallel_algorithm<for_each_tile_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy>
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+        tag_fallback_invoke(hpx::experimental::for_each_tile_t,
+            ExPolicy&& policy, std::size_t rows, std::size_t cols,
+            std::size_t tile_rows, std::size_t tile_cols, F&& f)
+        {
+            HPX_ASSERT(tile_rows != 0 && tile_cols != 0);
+
+            return hpx::parallel::detail::for_each_tile().call(
+                HPX_FORWARD(ExPolicy, policy),
+                hpx::parallel::detail::tile_iteration{
+                    rows, cols, tile_rows, tile_cols},
+                HPX_FORWARD(F, f));
+        }
+
+        template <typename F>
+        friend void tag_fallback_invoke(hpx::experimental::for_each_tile_t,
+            std::size_t rows, std::size_t cols, std::size_t tile_rows,
+            std::size_t tile_cols, F&& f)
+        {
+            HPX_ASSERT(tile_rows != 0 && tile_cols != 0);
+
+            hpx::parallel::detail::for_each_tile().call(hpx::execution::seq,
+                hpx::parallel::detail::tile_iteration{
+                    rows, cols, tile_rows, tile_cols},
+                HPX_FORWARD(F, f));
+        }
+    } for_each_tile{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr struct transpose_t final
+      : hpx::detail::tag_parallel_algorithm<transpose_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2>
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+            RandIter2>
+        tag_fallback_invoke(hpx::experimental::transpose_t, ExPolicy&& policy,
+            RandIter1 first, std::size_t rows, std::size_t cols,
+            RandIter2 dest)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter1>,
+                "Requires a random access iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter2>,
+                "Requires a random access iterator.");
+
+            return hpx::parallel::detail::transpose<RandIter2>().call(
+                HPX_FORWARD(ExPolicy, policy), first, rows, cols, dest);
+        }
+
+        // clang-format off
+        template <typename RandIter1, typename RandIter2,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2>
+            )>
+        // clang-format on
+        friend RandIter2 tag_fallback_invoke(hpx::experimental::transpose_t,
+            RandIter1 first, std::size_t rows, std::size_t cols,
+            RandIter2 dest)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter1>,
+                "Requires a random access iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter2>,
+                "Requires a random access iterator.");
+
+            return hpx::parallel::detail::transpose<RandIter2>().call(
+                hpx::execution::seq, first, rows, cols, dest);
+        }
+    } transpose{};
+}    // namespace hpx::experimental
+
+#endif
@@ -0,0 +1,291 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_graph.hpp
+/// \page hpx::experimental::task_graph
+/// \headerfile hpx/experimental/task_graph.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/errors/exception_list.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/functional/invoke_fused.hpp>
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Top-level namespace
+namespace hpx::experimental {
+
+    /// A \c task_graph records a directed acyclic graph of tasks once and
+    /// executes it repeatedly. Tasks are recorded with \c async (a task
+    /// without dependencies) and \c dataflow (a task that runs after all of
+    /// the given tasks have finished), mirroring \c hpx::async and
+    /// \c hpx::dataflow. Instead of futures, both return handles to the
+    /// recorded tasks that can be used as dependencies of later tasks.
+    ///
+    /// Every call to \c replay executes all recorded tasks. The dependency
+    /// structure is computed once when the graph is replayed for the first
+    /// time. A replay does not allocate any per task state: the counters of
+    /// unfinished dependencies are preallocated and reset, no futures are
+    /// created and no continuations are registered. A task becoming ready is
+    /// run directly by the thread that has finished its last dependency
+    /// whenever possible.
+    ///
+    /// Tasks communicate through data owned by the application (e.g.
+    /// buffers captured by reference), the graph only ensures the order of
+    /// their execution. Recording a task after the graph has been replayed
+    /// invalidates the computed dependency structure.
+    class task_graph
+    {
+        static constexpr std::uint32_t npos = static_cast<std::uint32_t>(-1);
+
+    public:
+        /// A handle to a task recorded in a \c task_graph
+        class task
+        {
+        public:
+            task() = default;
+
+            /// Return whether this handle refers to a recorded task
+            explicit operator bool() const noexcept
+            {
+                return index_ != npos;
+            }
+
+        private:
+            friend class task_graph;
+
+            explicit constexpr task(std::uint32_t index) noexcept
+              : index_(index)
+            {
+            }
+
+            std::uint32_t index_ = npos;
+        };
+
+        HPX_CORE_EXPORT task_graph();
+        HPX_CORE_EXPORT ~task_graph();
+
+        task_graph(task_graph const&) = delete;
+        task_graph(task_graph&&) = delete;
+
+        task_graph& operator=(task_graph const&) = delete;
+        task_graph& operator=(task_graph&&) = delete;
+
+    public:
+        /// \brief Records a task computing \c f(ts...) that does not depend
+        ///        on any other task.
+        ///
+        /// \tparam F  The type of the user defined function to invoke.
+        /// \tparam Ts The type of additional arguments used to invoke \c f().
+        ///
+        /// \param f   The user defined function to invoke during every
+        ///            replay of the graph.
+        /// \param ts  Additional arguments to use to invoke \c f(), they are
+        ///            stored in the graph and passed as lvalues.
+        ///
+        /// \returns   A handle to the recorded task.
+        template <typename F, typename... Ts>
+        task async(F&& f, Ts&&... ts)
+        {
+            return record(make_function(HPX_FORWARD(F, f),
+                              HPX_FORWARD(Ts, ts)...),
+                {});
+        }
+
+        /// \brief Records a task computing \c f() that runs after all of the
+        ///        given tasks have finished.
+        ///
+        /// \tparam F     The type of the user defined function to invoke.
+        /// \tparam Deps  The types of the dependencies, either \c task or
+        ///               ranges of \c task.
+        ///
+        /// \param f      The user defined function to invoke during every
+        ///               replay of the graph.
+        /// \param deps   The tasks this task depends on.
+        ///
+        /// \returns      A handle to the recorded task.
+        template <typename F, typename... Deps>
+        task dataflow(F&& f, Deps const&... deps)
+        {
+            std::vector<std::uint32_t> dependencies;
+            (add_dependency(dependencies, deps), ...);
+            return record(
+                make_function(HPX_FORWARD(F, f)), HPX_MOVE(dependencies));
+        }
+
+        /// \brief Executes all recorded tasks on the given executor.
+        ///
+        /// \param exec  The executor to use for running the tasks.
+        ///
+        /// \returns     A future that becomes ready once all tasks have
+        ///              finished. If any of the tasks has thrown an
+        ///              exception, no further tasks are started and the
+        ///              future holds an \c hpx::exception_list containing the
+        ///              exceptions.
+        ///
+        /// \note A graph can not be replayed again (or modified) before the
+        ///       previous replay has finished.
+        // clang-format off
+        template <typename Executor,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_executor_any_v<std::decay_t<Executor>>
+            )>
+        // clang-format on
+        hpx::future<void> replay(Executor&& exec)
+        {
+            hpx::future<void> f = begin_replay();
+            for (std::uint32_t const root : roots_)
+            {
+                spawn(exec, root);
+            }
+            return f;
+        }
+
+        /// \brief Executes all recorded tasks on the default executor.
+        hpx::future<void> replay()
+        {
+            return replay(execution::parallel_executor{});
+        }
+
+        /// Return the number of recorded tasks
+        std::size_t size() const noexcept
+        {
+            return tasks_.size();
+        }
+
+        /// Remove all recorded tasks
+        HPX_CORE_EXPORT void clear();
+
+    private:
+        using function_type = hpx::move_only_function<void()>;
+
+        template <typename F, typename... Ts>
+        static function_type make_function(F&& f, Ts&&... ts)
+        {
+            return [f = HPX_FORWARD(F, f),
+                       t = hpx::make_tuple(HPX_FORWARD(Ts, ts)...)]() mutable {
+                hpx::invoke_fused(f, t);
+            };
+        }
+
+        static void add_dependency(
+            std::vector<std::uint32_t>& dependencies, task const& t)
+        {
+            dependencies.push_back(t.index_);
+        }
+
+        // clang-format off
+        template <typename Range,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_range_v<Range>
+            )>
+        // clang-format on
+        static void add_dependency(
+            std::vector<std::uint32_t>& dependencies, Range const& r)
+        {
+            for (task const& t : r)
+            {
+                dependencies.push_back(t.index_);
+            }
+        }
+
+        HPX_CORE_EXPORT task record(
+            function_type&& f, std::vector<std::uint32_t>&& dependencies);
+
+        // computes the dependency structure if needed, resets the counters
+        // and creates the shared state of the returned future
+        HPX_CORE_EXPORT hpx::future<void> begin_replay();
+
+        // invoke the given task unless an earlier task has failed
+        HPX_CORE_EXPORT void invoke(std::uint32_t index) noexcept;
+
+        // returns true if this was the last unfinished task of the replay,
+        // in this case the graph must not be accessed anymore
+        HPX_CORE_EXPORT bool finish() noexcept;
+
+        template <typename Executor>
+        void spawn(Executor& exec, std::uint32_t index)
+        {
+            hpx::parallel::execution::post(
+                exec, [this, exec, index]() mutable { run(exec, index); });
+        }
+
+        template <typename Executor>
+        void run(Executor& exec, std::uint32_t index)
+        {
+            while (true)
+            {
+                invoke(index);
+
+                // the first successor becoming ready is run on this thread,
+                // all others are spawned
+                std::uint32_t next = npos;
+                for (std::uint32_t i = successor_offsets_[index];
+                     i != successor_offsets_[index + 1]; ++i)
+                {
+                    std::uint32_t const successor = successors_[i];
+                    if (counters_[successor].fetch_sub(
+                            1, std::memory_order_acq_rel) == 1)
+                    {
+                        if (next == npos)
+                        {
+                            next = successor;
+                        }
+                        else
+                        {
+                            spawn(exec, successor);
+                        }
+                    }
+                }
+
+                if (finish() || next == npos)
+                {
+                    return;
+                }
+                index = next;
+            }
+        }
+
+    private:
+        struct recorded_task
+        {
+            function_type f;
+            std::vector<std::uint32_t> dependencies;
+        };
+
+        std::vector<recorded_task> tasks_;
+
+        // dependency structure, computed on first replay
+        bool instantiated_ = false;
+        std::vector<std::uint32_t> roots_;
+        std::vector<std::uint32_t> dependency_counts_;
+        std::vector<std::uint32_t> successor_offsets_;
+        std::vector<std::uint32_t> successors_;
+
+        // state of the current replay
+        std::unique_ptr<std::atomic<std::uint32_t>[]> counters_;
+        std::atomic<std::size_t> remaining_;
+        std::atomic<bool> failed_;
+        std::atomic<bool> running_;
+        hpx::exception_list errors_;
+        hpx::intrusive_ptr<lcos::detail::future_data<void>> state_;
+    };
+}    // namespace hpx::experimental
@@ -0,0 +1,210 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/futures/traits/future_access.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/parallel/task_graph.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    task_graph::task_graph()
+      : remaining_(0)
+      , failed_(false)
+      , running_(false)
+    {
+    }
+
+    task_graph::~task_graph()
+    {
+        // the last replay must have finished
+        HPX_ASSERT(!running_.load(std::memory_order_acquire));
+    }
+
+    void task_graph::clear()
+    {
+        if (running_.load(std::memory_order_acquire))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "task_graph::clear",
+                "the task graph can not be modified while it is replayed");
+        }
+
+        tasks_.clear();
+        instantiated_ = false;
+        roots_.clear();
+        dependency_counts_.clear();
+        successor_offsets_.clear();
+        successors_.clear();
+        counters_.reset();
+    }
+
+    task_graph::task task_graph::record(
+        function_type&& f, std::vector<std::uint32_t>&& dependencies)
+    {
+        if (running_.load(std::memory_order_acquire))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "task_graph::record",
+                "the task graph can not be modified while it is replayed");
+        }
+
+        std::size_t const index = tasks_.size();
+        if (index >= npos)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::out_of_memory,
+                "task_graph::record", "too many tasks recorded");
+        }
+
+        // dependencies can refer to earlier tasks only, which makes sure the
+        // graph is acyclic
+        for (std::uint32_t const dependency : dependencies)
+        {
+            if (dependency >= index)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "task_graph::record",
+                    "the task depends on a task that was not recorded in "
+                    "this graph");
+            }
+        }
+
+        tasks_.push_back(recorded_task{HPX_MOVE(f), HPX_MOVE(dependencies)});
+        instantiated_ = false;
+
+        return task(static_cast<std::uint32_t>(index));
+    }
+
+    hpx::future<void> task_graph::begin_replay()
+    {
+        bool expected = false;
+        if (!running_.compare_exchange_strong(expected, true))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "task_graph::replay",
+                "the previous replay of the task graph has not finished");
+        }
+
+        std::size_t const size = tasks_.size();
+        if (!instantiated_)
+        {
+            // compute the successors of all tasks (in compressed sparse row
+            // format) and the number of dependencies of each task
+            roots_.clear();
+            dependency_counts_.assign(size, 0);
+            successor_offsets_.assign(size + 1, 0);
+
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                auto const& dependencies = tasks_[i].dependencies;
+                dependency_counts_[i] =
+                    static_cast<std::uint32_t>(dependencies.size());
+                if (dependencies.empty())
+                {
+                    roots_.push_back(static_cast<std::uint32_t>(i));
+                }
+                for (std::uint32_t const dependency : dependencies)
+                {
+                    ++successor_offsets_[dependency + 1];
+                }
+            }
+
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                successor_offsets_[i + 1] += successor_offsets_[i];
+            }
+
+            successors_.resize(successor_offsets_[size]);
+            std::vector<std::uint32_t> fill(
+                successor_offsets_.begin(), successor_offsets_.end() - 1);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                for (std::uint32_t const dependency : tasks_[i].dependencies)
+                {
+                    successors_[fill[dependency]++] =
+                        static_cast<std::uint32_t>(i);
+                }
+            }
+
+            counters_.reset(new std::atomic<std::uint32_t>[size]);
+            instantiated_ = true;
+        }
+
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            counters_[i].store(
+                dependency_counts_[i], std::memory_order_relaxed);
+        }
+        remaining_.store(size, std::memory_order_relaxed);
+        failed_.store(false, std::memory_order_relaxed);
+        errors_ = hpx::exception_list();
+
+        using shared_state_type = lcos::detail::future_data<void>;
+        using init_no_addref = shared_state_type::init_no_addref;
+        state_.reset(new shared_state_type(init_no_addref{}), false);
+
+        hpx::future<void> f =
+            hpx::traits::future_access<hpx::future<void>>::create(state_);
+
+        if (size == 0)
+        {
+            auto const state = HPX_MOVE(state_);
+            running_.store(false, std::memory_order_release);
+            state->set_value(hpx::util::unused);
+        }
+        return f;
+    }
+
+    void task_graph::invoke(std::uint32_t index) noexcept
+    {
+        // don't start any further tasks once one of them has failed
+        if (failed_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        hpx::detail::try_catch_exception_ptr([&]() { tasks_[index].f(); },
+            [this](std::exception_ptr e) {
+                failed_.store(true, std::memory_order_relaxed);
+                errors_.add(HPX_MOVE(e));
+            });
+    }
+
+    bool task_graph::finish() noexcept
+    {
+        if (remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return false;
+        }
+
+        // this was the last task, the graph may be destroyed or replayed
+        // again as soon as the future has become ready
+        auto const state = HPX_MOVE(state_);
+        if (failed_.load(std::memory_order_relaxed))
+        {
+            hpx::exception_list errors = HPX_MOVE(errors_);
+            running_.store(false, std::memory_order_release);
+            state->set_exception(std::make_exception_ptr(HPX_MOVE(errors)));
+        }
+        else
+        {
+            running_.store(false, std::memory_order_release);
+            state->set_value(hpx::util::unused);
+        }
+        return true;
+    }
+}    // namespace hpx::experimental
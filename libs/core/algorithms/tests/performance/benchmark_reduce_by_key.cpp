@@ -0,0 +1,238 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares hpx::experimental::reduce_by_key with a
+// formulation based on a segmented inclusive_scan over zip iterators followed
+// by a copy_if of the run ends, which is how reduce_by_key used to be
+// implemented.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+// runs of equal keys with a random length in [1, max_run_length]
+void generate_input(std::size_t size, std::size_t max_run_length,
+    std::vector<int>& keys, std::vector<double>& values)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::size_t> run_dist(1, max_run_length);
+    std::uniform_real_distribution<double> value_dist(-1.0, 1.0);
+
+    keys.resize(size);
+    values.resize(size);
+
+    int key = 0;
+    for (std::size_t i = 0; i != size; ++key)
+    {
+        std::size_t const run = (std::min)(run_dist(gen), size - i);
+        std::fill_n(keys.begin() + i, run, key);
+        i += run;
+    }
+    std::generate(values.begin(), values.end(),
+        [&]() { return value_dist(gen); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+std::size_t reduce_by_key_zip_scan(ExPolicy policy,
+    std::vector<int> const& keys, std::vector<double> const& values,
+    std::vector<int>& keys_output, std::vector<double>& values_output)
+{
+    std::size_t const size = keys.size();
+
+    // mark the start and the end of each run of equal keys
+    std::vector<char> starts(size), ends(size);
+    hpx::experimental::for_loop(policy, std::size_t(0), size, [&](auto i) {
+        starts[i] = i == 0 || keys[i - 1] != keys[i];
+        ends[i] = i == size - 1 || keys[i] != keys[i + 1];
+    });
+
+    // segmented inclusive scan of the values
+    using state_type = hpx::tuple<double, char>;
+
+    std::vector<double> scanned(size);
+    std::vector<char> scanned_starts(size);
+    hpx::inclusive_scan(policy,
+        hpx::util::zip_iterator(values.begin(), starts.begin()),
+        hpx::util::zip_iterator(values.end(), starts.end()),
+        hpx::util::zip_iterator(scanned.begin(), scanned_starts.begin()),
+        [](state_type const& a, state_type const& b) -> state_type {
+            if (hpx::get<1>(b))
+                return b;
+            return state_type(hpx::get<0>(a) + hpx::get<0>(b), hpx::get<1>(a));
+        });
+
+    // copy the keys and reduced values at the end of each run
+    std::vector<char> ignored(size);
+    auto result = hpx::copy_if(policy,
+        hpx::util::zip_iterator(keys.begin(), scanned.begin(), ends.begin()),
+        hpx::util::zip_iterator(keys.end(), scanned.end(), ends.end()),
+        hpx::util::zip_iterator(
+            keys_output.begin(), values_output.begin(), ignored.begin()),
+        [](auto const& t) { return hpx::get<2>(t) != 0; });
+
+    return std::distance(
+        keys_output.begin(), hpx::get<0>(result.get_iterator_tuple()));
+}
+
+template <typename ExPolicy>
+std::size_t reduce_by_key_soa(ExPolicy policy, std::vector<int> const& keys,
+    std::vector<double> const& values, std::vector<int>& keys_output,
+    std::vector<double>& values_output)
+{
+    auto result = hpx::experimental::reduce_by_key(policy, keys.begin(),
+        keys.end(), values.begin(), keys_output.begin(), values_output.begin());
+
+    return std::distance(keys_output.begin(), result.in);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double run_benchmark(int test_count, std::vector<int> const& keys,
+    std::vector<double> const& values, std::size_t expected_size, F&& f)
+{
+    std::vector<int> keys_output(keys.size());
+    std::vector<double> values_output(values.size());
+
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        std::size_t const size = f(keys, values, keys_output, values_output);
+        time += hpx::chrono::high_resolution_clock::now() - start;
+
+        HPX_TEST_EQ(size, expected_size);
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t const max_run_length = vm["max_run_length"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed           : " << seed << std::endl;
+    std::cout << "vector_size    : " << vector_size << std::endl;
+    std::cout << "max_run_length : " << max_run_length << std::endl;
+    std::cout << "test_count     : " << test_count << std::endl;
+    std::cout << "os threads     : " << hpx::get_os_thread_count()
+              << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    std::vector<int> keys;
+    std::vector<double> values;
+    generate_input(
+        vector_size, (std::max)(max_run_length, std::size_t(1)), keys, values);
+
+    std::size_t const expected_size = keys.empty() ?
+        0 :
+        static_cast<std::size_t>(keys.back()) + 1;
+
+    using namespace hpx::execution;
+
+    double const time_zip_seq = run_benchmark(
+        test_count, keys, values, expected_size, [](auto&&... args) {
+            return reduce_by_key_zip_scan(seq, args...);
+        });
+    double const time_zip_par = run_benchmark(
+        test_count, keys, values, expected_size, [](auto&&... args) {
+            return reduce_by_key_zip_scan(par, args...);
+        });
+
+    double const time_seq = run_benchmark(test_count, keys, values,
+        expected_size,
+        [](auto&&... args) { return reduce_by_key_soa(seq, args...); });
+    double const time_par = run_benchmark(test_count, keys, values,
+        expected_size,
+        [](auto&&... args) { return reduce_by_key_soa(par, args...); });
+    double const time_par_unseq = run_benchmark(
+        test_count, keys, values, expected_size, [](auto&&... args) {
+            return reduce_by_key_soa(par_unseq, args...);
+        });
+#if defined(HPX_HAVE_DATAPAR)
+    double const time_par_simd = run_benchmark(
+        test_count, keys, values, expected_size, [](auto&&... args) {
+            return reduce_by_key_soa(par_simd, args...);
+        });
+#endif
+
+    std::cout << "-------------- Benchmark Result --------------"
+              << std::endl;
+    auto fmt = "reduce_by_key ({1}) : {2}(sec)";
+    hpx::util::format_to(std::cout, fmt, "zip scan, seq", time_zip_seq)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "zip scan, par", time_zip_par)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "seq", time_seq) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "par", time_par) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "par_unseq", time_par_unseq)
+        << std::endl;
+#if defined(HPX_HAVE_DATAPAR)
+    hpx::util::format_to(std::cout, fmt, "par_simd", time_par_simd)
+        << std::endl;
+#endif
+    std::cout << "----------------------------------------------" << std::endl;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(10000000),
+         "number of keys and values (default: 10000000)")
+        ("max_run_length", value<std::size_t>()->default_value(64),
+         "maximal length of a run of equal keys (default: 64)")
+        ("test_count", value<int>()->default_value(10),
+         "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
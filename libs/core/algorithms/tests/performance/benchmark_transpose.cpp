@@ -0,0 +1,232 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares hpx::experimental::transpose with the kernels used
+// by the examples in examples/transpose: a naive serial loop, a serial loop
+// over square tiles, and a parallel for_loop over the rows of tiles.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/transpose.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+// transpose_serial.cpp
+void transpose_serial(std::vector<double> const& a, std::vector<double>& b,
+    std::size_t order, std::size_t)
+{
+    for (std::size_t i = 0; i != order; ++i)
+    {
+        for (std::size_t j = 0; j != order; ++j)
+        {
+            b[i + order * j] = a[j + order * i];
+        }
+    }
+}
+
+// transpose_serial_block.cpp
+void transpose_tile(std::vector<double> const& a, std::vector<double>& b,
+    std::size_t order, std::size_t tile_size, std::size_t i)
+{
+    std::size_t const i_max = (std::min)(order, i + tile_size);
+    for (std::size_t j = 0; j < order; j += tile_size)
+    {
+        std::size_t const j_max = (std::min)(order, j + tile_size);
+        for (std::size_t it = i; it < i_max; ++it)
+        {
+            for (std::size_t jt = j; jt < j_max; ++jt)
+            {
+                b[it + order * jt] = a[jt + order * it];
+            }
+        }
+    }
+}
+
+void transpose_serial_block(std::vector<double> const& a,
+    std::vector<double>& b, std::size_t order, std::size_t tile_size)
+{
+    for (std::size_t i = 0; i < order; i += tile_size)
+    {
+        transpose_tile(a, b, order, tile_size, i);
+    }
+}
+
+// transpose_smp_block.cpp
+void transpose_smp_block(std::vector<double> const& a, std::vector<double>& b,
+    std::size_t order, std::size_t tile_size)
+{
+    std::size_t const num_tiles = (order + tile_size - 1) / tile_size;
+    hpx::experimental::for_loop(hpx::execution::par, std::size_t(0),
+        num_tiles, [&](std::size_t tile) {
+            transpose_tile(a, b, order, tile_size, tile * tile_size);
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double run_benchmark(int test_count, std::vector<double> const& a,
+    std::size_t order, std::size_t tile_size, F&& f)
+{
+    std::vector<double> b(a.size());
+
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        f(a, b, order, tile_size);
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+
+    for (std::size_t i = 0; i != order; ++i)
+    {
+        for (std::size_t j = 0; j != order; ++j)
+        {
+            HPX_TEST_EQ(b[i + order * j], a[j + order * i]);
+        }
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+template <typename ExPolicy>
+void transpose_hpx(ExPolicy policy, std::vector<double> const& a,
+    std::vector<double>& b, std::size_t order)
+{
+    if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+    {
+        hpx::experimental::transpose(policy, a.begin(), order, order, b.begin())
+            .get();
+    }
+    else
+    {
+        hpx::experimental::transpose(
+            policy, a.begin(), order, order, b.begin());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const order = vm["matrix_size"].as<std::size_t>();
+    std::size_t const tile_size =
+        (std::max)(vm["tile_size"].as<std::size_t>(), std::size_t(1));
+    int const test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed        : " << seed << std::endl;
+    std::cout << "matrix_size : " << order << std::endl;
+    std::cout << "tile_size   : " << tile_size << std::endl;
+    std::cout << "test_count  : " << test_count << std::endl;
+    std::cout << "os threads  : " << hpx::get_os_thread_count() << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    std::vector<double> a(order * order);
+    std::generate(a.begin(), a.end(), [&]() { return dist(gen); });
+
+    using namespace hpx::execution;
+
+    double const time_serial =
+        run_benchmark(test_count, a, order, tile_size, &transpose_serial);
+    double const time_serial_block =
+        run_benchmark(test_count, a, order, tile_size, &transpose_serial_block);
+    double const time_smp_block =
+        run_benchmark(test_count, a, order, tile_size, &transpose_smp_block);
+
+    double const time_seq = run_benchmark(test_count, a, order, tile_size,
+        [](auto const& src, auto& dest, std::size_t n, std::size_t) {
+            transpose_hpx(seq, src, dest, n);
+        });
+    double const time_par = run_benchmark(test_count, a, order, tile_size,
+        [](auto const& src, auto& dest, std::size_t n, std::size_t) {
+            transpose_hpx(par, src, dest, n);
+        });
+    double const time_par_task = run_benchmark(test_count, a, order, tile_size,
+        [](auto const& src, auto& dest, std::size_t n, std::size_t) {
+            transpose_hpx(par(task), src, dest, n);
+        });
+
+    // bytes read and written per transpose
+    double const bytes = 2.0 * sizeof(double) * order * order;
+
+    std::cout << "-------------- Benchmark Result --------------"
+              << std::endl;
+    auto fmt = "transpose ({1}) : {2}(sec), {3}(MB/s)";
+    hpx::util::format_to(std::cout, fmt, "serial", time_serial,
+        1e-6 * bytes / time_serial)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "serial block", time_serial_block,
+        1e-6 * bytes / time_serial_block)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "smp block", time_smp_block,
+        1e-6 * bytes / time_smp_block)
+        << std::endl;
+    hpx::util::format_to(
+        std::cout, fmt, "seq", time_seq, 1e-6 * bytes / time_seq)
+        << std::endl;
+    hpx::util::format_to(
+        std::cout, fmt, "par", time_par, 1e-6 * bytes / time_par)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "par(task)", time_par_task,
+        1e-6 * bytes / time_par_task)
+        << std::endl;
+    std::cout << "----------------------------------------------" << std::endl;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("matrix_size", value<std::size_t>()->default_value(4096),
+         "order of the square matrix (default: 4096)")
+        ("tile_size", value<std::size_t>()->default_value(32),
+         "tile size used by the blocked baselines (default: 32)")
+        ("test_count", value<int>()->default_value(10),
+         "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
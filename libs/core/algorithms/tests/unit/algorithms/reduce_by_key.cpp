@@ -21,6 +21,7 @@
 //
 #define HPX_REDUCE_BY_KEY_TEST_SIZE (1 << 18)
 //
+#include "reduce_by_key_tests.hpp"
 #include "sort_tests.hpp"
 //
 #define EXTRA_DEBUG
@@ -399,6 +400,15 @@ void test_reduce_by_key_async(
     }
 }
 
+void test_reduce_by_key_small()
+{
+    using namespace hpx::execution;
+
+    test_reduce_by_key_small(seq);
+    test_reduce_by_key_small(par);
+    test_reduce_by_key_small(par_unseq);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void test_reduce_by_key1()
 {
@@ -494,6 +504,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::cout << "using seed: " << seed << std::endl;
     gen.seed(seed);
 
+    test_reduce_by_key_small();
     test_reduce_by_key1();
     //    test_reduce_by_key2();
     return hpx::local::finalize();
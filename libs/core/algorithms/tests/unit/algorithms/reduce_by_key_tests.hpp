@@ -0,0 +1,64 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/reduce_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_reduce_by_key_small(ExPolicy&& policy)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    // runs of equal keys spanning many partitions, written to separate
+    // output sequences
+    std::size_t const size = 10007;
+    std::vector<int> keys(size), values(size);
+    std::vector<int> expected_keys, expected_values;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = static_cast<int>(i / 1000);
+        values[i] = static_cast<int>(i % 7);
+        if (i % 1000 == 0)
+        {
+            expected_keys.push_back(keys[i]);
+            expected_values.push_back(0);
+        }
+        expected_values.back() += values[i];
+    }
+
+    std::vector<int> o_keys(size, -1), o_values(size, -1);
+    auto result = hpx::experimental::reduce_by_key(policy, keys.begin(),
+        keys.end(), values.begin(), o_keys.begin(), o_values.begin());
+
+    HPX_TEST(result.in == o_keys.begin() + expected_keys.size());
+    HPX_TEST(result.out == o_values.begin() + expected_values.size());
+    HPX_TEST(std::equal(
+        expected_keys.begin(), expected_keys.end(), o_keys.begin()));
+    HPX_TEST(std::equal(
+        expected_values.begin(), expected_values.end(), o_values.begin()));
+
+    // a single element is copied to the output
+    result = hpx::experimental::reduce_by_key(policy, keys.begin(),
+        keys.begin() + 1, values.begin(), o_keys.begin(), o_values.begin());
+    HPX_TEST(result.in == o_keys.begin() + 1);
+    HPX_TEST(result.out == o_values.begin() + 1);
+    HPX_TEST_EQ(o_keys[0], keys[0]);
+    HPX_TEST_EQ(o_values[0], values[0]);
+
+    // an empty input leaves the output untouched
+    result = hpx::experimental::reduce_by_key(policy, keys.begin(),
+        keys.begin(), values.begin(), o_keys.begin(), o_values.begin());
+    HPX_TEST(result.in == o_keys.begin());
+    HPX_TEST(result.out == o_values.begin());
+}
@@ -0,0 +1,201 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/transpose.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+void verify_transpose(std::vector<std::size_t> const& src,
+    std::vector<std::size_t> const& dest, std::size_t rows, std::size_t cols)
+{
+    for (std::size_t row = 0; row != rows; ++row)
+    {
+        for (std::size_t col = 0; col != cols; ++col)
+        {
+            HPX_TEST_EQ(dest[col * rows + row], src[row * cols + col]);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_transpose(ExPolicy&& policy, std::size_t rows, std::size_t cols)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> src(rows * cols);
+    std::iota(src.begin(), src.end(), gen());
+    std::vector<std::size_t> dest(rows * cols);
+
+    auto result = hpx::experimental::transpose(
+        policy, src.begin(), rows, cols, dest.begin());
+
+    HPX_TEST(result == dest.end());
+    verify_transpose(src, dest, rows, cols);
+}
+
+template <typename ExPolicy>
+void test_transpose_async(ExPolicy&& p, std::size_t rows, std::size_t cols)
+{
+    std::vector<std::size_t> src(rows * cols);
+    std::iota(src.begin(), src.end(), gen());
+    std::vector<std::size_t> dest(rows * cols);
+
+    auto f = hpx::experimental::transpose(
+        p, src.begin(), rows, cols, dest.begin());
+
+    HPX_TEST(f.get() == dest.end());
+    verify_transpose(src, dest, rows, cols);
+}
+
+void transpose_test()
+{
+    using namespace hpx::execution;
+
+    // square, rectangular, and degenerate matrices, with sizes not being a
+    // multiple of the tile size
+    std::pair<std::size_t, std::size_t> const shapes[] = {{0, 0}, {1, 1},
+        {1, 1000}, {1000, 1}, {64, 64}, {257, 129}, {100, 513}};
+
+    for (auto const& shape : shapes)
+    {
+        {
+            std::vector<std::size_t> src(shape.first * shape.second);
+            std::iota(src.begin(), src.end(), gen());
+            std::vector<std::size_t> dest(shape.first * shape.second);
+
+            auto result = hpx::experimental::transpose(
+                src.begin(), shape.first, shape.second, dest.begin());
+
+            HPX_TEST(result == dest.end());
+            verify_transpose(src, dest, shape.first, shape.second);
+        }
+
+        test_transpose(seq, shape.first, shape.second);
+        test_transpose(par, shape.first, shape.second);
+        test_transpose(par_unseq, shape.first, shape.second);
+
+        test_transpose_async(seq(task), shape.first, shape.second);
+        test_transpose_async(par(task), shape.first, shape.second);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_for_each_tile(ExPolicy&& policy, std::size_t rows, std::size_t cols,
+    std::size_t tile_rows, std::size_t tile_cols)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    // every index has to be covered by exactly one tile
+    std::vector<std::atomic<std::size_t>> visited(rows * cols);
+    std::atomic<std::size_t> num_tiles(0);
+
+    auto f = [&](std::size_t row_first, std::size_t row_last,
+                 std::size_t col_first, std::size_t col_last) {
+        HPX_TEST_LT(row_first, row_last);
+        HPX_TEST_LT(col_first, col_last);
+        HPX_TEST_LTE(row_last - row_first, tile_rows);
+        HPX_TEST_LTE(col_last - col_first, tile_cols);
+
+        for (std::size_t row = row_first; row != row_last; ++row)
+        {
+            for (std::size_t col = col_first; col != col_last; ++col)
+            {
+                ++visited[row * cols + col];
+            }
+        }
+        ++num_tiles;
+    };
+
+    if constexpr (hpx::is_async_execution_policy_v<std::decay_t<ExPolicy>>)
+    {
+        hpx::experimental::for_each_tile(
+            policy, rows, cols, tile_rows, tile_cols, f)
+            .get();
+    }
+    else
+    {
+        hpx::experimental::for_each_tile(
+            policy, rows, cols, tile_rows, tile_cols, f);
+    }
+
+    for (auto const& v : visited)
+    {
+        HPX_TEST_EQ(v.load(), std::size_t(1));
+    }
+    HPX_TEST_EQ(num_tiles.load(),
+        ((rows + tile_rows - 1) / tile_rows) *
+            ((cols + tile_cols - 1) / tile_cols));
+}
+
+void for_each_tile_test()
+{
+    using namespace hpx::execution;
+
+    test_for_each_tile(seq, 100, 37, 8, 8);
+    test_for_each_tile(par, 100, 37, 8, 8);
+    test_for_each_tile(par, 1, 1000, 16, 32);
+    test_for_each_tile(par_unseq, 1000, 3, 7, 5);
+    test_for_each_tile(par, 0, 10, 4, 4);
+
+    test_for_each_tile(par(task), 100, 37, 8, 8);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    transpose_test();
+    for_each_tile_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,189 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/experimental/task_graph.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// a chain of tasks has to run strictly in order
+void task_graph_test_chain()
+{
+    std::vector<int> order;
+
+    hpx::experimental::task_graph g;
+    auto t = g.async([&] { order.push_back(0); });
+    for (int i = 1; i != 100; ++i)
+    {
+        t = g.dataflow([&, i] { order.push_back(i); }, t);
+    }
+    HPX_TEST_EQ(g.size(), std::size_t(100));
+
+    for (int replay = 0; replay != 10; ++replay)
+    {
+        order.clear();
+        g.replay().get();
+
+        HPX_TEST_EQ(order.size(), std::size_t(100));
+        for (int i = 0; i != 100; ++i)
+        {
+            HPX_TEST_EQ(order[i], i);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// fork/join: every task of a level depends on all tasks of the previous level
+template <typename Executor>
+void task_graph_test_levels(Executor&& exec)
+{
+    constexpr std::size_t num_levels = 10;
+    constexpr std::size_t width = 16;
+
+    std::vector<std::atomic<std::size_t>> finished(num_levels);
+    std::atomic<bool> ordered(true);
+
+    hpx::experimental::task_graph g;
+
+    std::vector<hpx::experimental::task_graph::task> previous;
+    for (std::size_t level = 0; level != num_levels; ++level)
+    {
+        std::vector<hpx::experimental::task_graph::task> current;
+        for (std::size_t i = 0; i != width; ++i)
+        {
+            auto f = [&, level] {
+                if (level != 0 && finished[level - 1].load() != width)
+                {
+                    ordered = false;
+                }
+                ++finished[level];
+            };
+            current.push_back(
+                level == 0 ? g.async(f) : g.dataflow(f, previous));
+        }
+        previous = std::move(current);
+    }
+
+    for (int replay = 0; replay != 10; ++replay)
+    {
+        for (auto& f : finished)
+        {
+            f = 0;
+        }
+
+        g.replay(exec).get();
+
+        HPX_TEST(ordered.load());
+        for (auto& f : finished)
+        {
+            HPX_TEST_EQ(f.load(), width);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void task_graph_test_arguments()
+{
+    std::atomic<int> sum(0);
+
+    hpx::experimental::task_graph g;
+    auto t1 = g.async([&](int i) { sum += i; }, 1);
+    auto t2 = g.async([&](int i, int j) { sum += i * j; }, 2, 3);
+    g.dataflow([&] { sum += 10 * sum.load(); }, t1, t2);
+
+    g.replay().get();
+    HPX_TEST_EQ(sum.load(), 77);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void task_graph_test_exception()
+{
+    std::atomic<int> count(0);
+
+    hpx::experimental::task_graph g;
+    auto t = g.async([] { throw std::runtime_error("test"); });
+    g.dataflow([&] { ++count; }, t);
+
+    for (int replay = 0; replay != 2; ++replay)
+    {
+        bool caught_exception = false;
+        try
+        {
+            g.replay().get();
+            HPX_TEST(false);
+        }
+        catch (hpx::exception_list const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_EQ(e.size(), std::size_t(1));
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // the dependent task must not have been run
+    HPX_TEST_EQ(count.load(), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void task_graph_test_empty()
+{
+    hpx::experimental::task_graph g;
+    g.replay().get();
+
+    bool caught_exception = false;
+    try
+    {
+        // handles of other graphs can not be used as dependencies
+        hpx::experimental::task_graph other;
+        auto t = other.async([] {});
+        g.dataflow([] {}, t);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::error::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+
+    g.clear();
+    HPX_TEST_EQ(g.size(), std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    task_graph_test_chain();
+    task_graph_test_levels(hpx::execution::par.executor());
+    task_graph_test_levels(hpx::execution::seq.executor());
+    task_graph_test_arguments();
+    task_graph_test_exception();
+    task_graph_test_empty();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,44 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+
+#include <string>
+#include <vector>
+
+#include "../algorithms/reduce_by_key_tests.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+void reduce_by_key_test()
+{
+    using namespace hpx::execution;
+
+    test_reduce_by_key_small(simd);
+    test_reduce_by_key_small(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    reduce_by_key_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
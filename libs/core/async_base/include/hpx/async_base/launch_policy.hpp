@@ -896,6 +896,26 @@ namespace hpx {
             return static_cast<bool>(static_cast<int>(p.policy()) &
                 static_cast<int>(detail::launch_policy::async_policies));
         }
+
+        // Work-first execution: a continuation launched with a hint for the
+        // local worker thread that also asks to be run as a child is executed
+        // directly on the stack of the thread that has made its last input
+        // ready instead of being scheduled.
+        HPX_FORCEINLINE constexpr bool is_work_first_hint(
+            threads::thread_schedule_hint hint) noexcept
+        {
+            return hint.mode ==
+                threads::thread_schedule_hint_mode::local_thread &&
+                hint.runs_as_child_mode() ==
+                threads::thread_execution_hint::run_as_child;
+        }
+
+        template <typename Policy>
+        HPX_FORCEINLINE constexpr bool has_work_first_policy(
+            Policy const& p) noexcept
+        {
+            return is_work_first_hint(p.hint());
+        }
     }    // namespace detail
     /// \endcond
 }    // namespace hpx
@@ -0,0 +1,111 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx::experimental {
+
+    namespace file_io::detail {
+
+        enum class operation : std::uint8_t
+        {
+            read,
+            write,
+            fsync
+        };
+
+        // Queue the given operation for submission to the io_uring instance
+        // shared by all thread pools that have enabled file I/O polling. The
+        // returned future becomes ready with the number of bytes transferred
+        // once the polling scheduler has reaped the completion.
+        HPX_CORE_EXPORT hpx::future<std::size_t> submit(operation op, int fd,
+            void* buffer, std::size_t size, std::uint64_t offset);
+    }    // namespace file_io::detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A file opened for asynchronous I/O. All operations are submitted to an
+    /// io_uring instance whose completions are reaped by the scheduling loop
+    /// of the thread pools that have enabled file I/O polling (see
+    /// \a hpx::experimental::file_io::enable_user_polling). No worker thread
+    /// is ever blocked on an operation, waiting for the returned futures
+    /// suspends the calling HPX thread only.
+    ///
+    /// The buffers passed to the asynchronous operations have to stay valid
+    /// until the returned future has become ready.
+    class HPX_CORE_EXPORT file
+    {
+    public:
+        file() noexcept = default;
+
+        /// Open the file with the given path. The flags and the mode are
+        /// passed on to open(2), throws hpx::error::filesystem_error if the
+        /// file could not be opened.
+        explicit file(
+            std::string const& path, int flags, unsigned int mode = 0644);
+
+        file(file const&) = delete;
+        file& operator=(file const&) = delete;
+
+        file(file&& rhs) noexcept;
+        file& operator=(file&& rhs) noexcept;
+
+        /// Closes the file, all operations issued on it have to be finished.
+        ~file();
+
+        bool is_open() const noexcept
+        {
+            return fd_ != -1;
+        }
+
+        int native_handle() const noexcept
+        {
+            return fd_;
+        }
+
+        /// Close the file, all operations issued on it have to be finished.
+        void close();
+
+        /// Read up to \a size bytes starting at the given offset into the
+        /// given buffer. The future holds the number of bytes read, which
+        /// may be less than \a size, like for pread(2).
+        hpx::future<std::size_t> async_read(
+            void* buffer, std::size_t size, std::uint64_t offset) const
+        {
+            return file_io::detail::submit(file_io::detail::operation::read,
+                fd_, buffer, size, offset);
+        }
+
+        /// Write up to \a size bytes from the given buffer starting at the
+        /// given offset. The future holds the number of bytes written, which
+        /// may be less than \a size, like for pwrite(2).
+        hpx::future<std::size_t> async_write(
+            void const* buffer, std::size_t size, std::uint64_t offset) const
+        {
+            return file_io::detail::submit(file_io::detail::operation::write,
+                fd_, const_cast<void*>(buffer), size, offset);
+        }
+
+        /// Flush the data and the metadata of the file to the storage
+        /// device.
+        hpx::future<void> async_fsync() const
+        {
+            return file_io::detail::submit(
+                file_io::detail::operation::fsync, fd_, nullptr, 0, 0);
+        }
+
+    private:
+        int fd_ = -1;
+    };
+}    // namespace hpx::experimental
@@ -0,0 +1,70 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace hpx::experimental::file_io {
+
+    namespace detail {
+
+        /// Register the file I/O polling function with the scheduler of the
+        /// given pool (see scheduler_base.hpp). The io_uring instance is
+        /// created when polling is enabled on the first pool, at most
+        /// \a queue_depth operations are in flight at any time, all others
+        /// wait for their submission in a queue.
+        HPX_CORE_EXPORT void register_polling(
+            hpx::threads::thread_pool_base& pool, std::size_t queue_depth);
+
+        /// Unregister the file I/O polling function, all operations have to
+        /// be finished if this is the last pool polling for completions.
+        HPX_CORE_EXPORT void unregister_polling(
+            hpx::threads::thread_pool_base& pool);
+    }    // namespace detail
+
+    /// This RAII helper class enables polling for completed file I/O
+    /// operations on the given thread pool for a scoped block
+    struct [[nodiscard]] enable_user_polling
+    {
+        explicit enable_user_polling(
+            std::string const& pool_name = {}, std::size_t queue_depth = 1024)
+          : pool_name_(pool_name)
+        {
+            if (pool_name_.empty())
+            {
+                detail::register_polling(
+                    hpx::resource::get_thread_pool(0), queue_depth);
+            }
+            else
+            {
+                detail::register_polling(
+                    hpx::resource::get_thread_pool(pool_name_), queue_depth);
+            }
+        }
+
+        ~enable_user_polling()
+        {
+            if (pool_name_.empty())
+            {
+                detail::unregister_polling(hpx::resource::get_thread_pool(0));
+            }
+            else
+            {
+                detail::unregister_polling(
+                    hpx::resource::get_thread_pool(pool_name_));
+            }
+        }
+
+    private:
+        std::string pool_name_;
+    };
+}    // namespace hpx::experimental::file_io
@@ -0,0 +1,71 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async_io/file.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace hpx::experimental {
+
+    file::file(std::string const& path, int flags, unsigned int mode)
+      : fd_(::open(path.c_str(), flags | O_CLOEXEC, mode))
+    {
+        if (fd_ == -1)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::experimental::file::file", "could not open {}: {}", path,
+                std::strerror(errno));
+        }
+    }
+
+    file::file(file&& rhs) noexcept
+      : fd_(std::exchange(rhs.fd_, -1))
+    {
+    }
+
+    file& file::operator=(file&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            if (fd_ != -1)
+            {
+                ::close(fd_);
+            }
+            fd_ = std::exchange(rhs.fd_, -1);
+        }
+        return *this;
+    }
+
+    file::~file()
+    {
+        if (fd_ != -1)
+        {
+            ::close(fd_);
+        }
+    }
+
+    void file::close()
+    {
+        if (fd_ == -1)
+            return;
+
+        int const fd = std::exchange(fd_, -1);
+        if (::close(fd) == -1)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::experimental::file::close", "could not close file: {}",
+                std::strerror(errno));
+        }
+    }
+}    // namespace hpx::experimental
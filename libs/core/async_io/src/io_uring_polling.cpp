@@ -0,0 +1,324 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// All file I/O operations are funneled through a single io_uring instance.
+// Submitting an operation only enqueues it into a lock-free queue. The
+// scheduling loops of the thread pools that have enabled polling reap the
+// completions, and move queued operations into the submission queue of the
+// ring as long as less than queue_depth operations are in flight. All
+// operations prepared during one polling step are submitted with a single
+// system call.
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_io/file.hpp>
+#include <hpx/async_io/polling_helper.hpp>
+#include <hpx/concurrency/concurrentqueue.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+#include <liburing.h>
+
+namespace hpx::experimental::file_io::detail {
+
+    namespace {
+
+        // The shared state of an operation, the ring holds a reference to it
+        // while the operation is in flight.
+        struct request : hpx::lcos::detail::future_data<std::size_t>
+        {
+            HPX_NON_COPYABLE(request);
+
+            using base_type = hpx::lcos::detail::future_data<std::size_t>;
+            using init_no_addref = typename base_type::init_no_addref;
+
+            request(init_no_addref no_addref, operation op, int fd,
+                void* buffer, std::size_t size, std::uint64_t offset) noexcept
+              : base_type(no_addref)
+              , op_(op)
+              , fd_(fd)
+              , buffer_(buffer)
+              , size_(size)
+              , offset_(offset)
+            {
+            }
+
+            operation op_;
+            int fd_;
+            void* buffer_;
+            std::size_t size_;
+            std::uint64_t offset_;
+        };
+
+        using request_ptr = hpx::intrusive_ptr<request>;
+
+        char const* operation_name(operation op) noexcept
+        {
+            switch (op)
+            {
+            case operation::read:
+                return "hpx::experimental::file::async_read";
+
+            case operation::write:
+                return "hpx::experimental::file::async_write";
+
+            case operation::fsync:
+                return "hpx::experimental::file::async_fsync";
+
+            default:
+                break;
+            }
+            return "hpx::experimental::file";
+        }
+
+        // the polling function runs inside the scheduling loop, never on an
+        // HPX thread, we only ever try_lock the ring
+        using mutex_type = hpx::spinlock;
+
+        struct io_uring_context
+        {
+            // protects the ring and in_flight_
+            mutex_type ring_mtx_;
+            ::io_uring ring_;
+            std::size_t queue_depth_ = 0;
+            std::size_t in_flight_ = 0;
+
+            // operations waiting for their submission to the ring
+            concurrency::ConcurrentQueue<request_ptr> pending_;
+
+            // number of operations submitted to the ring (for the work count)
+            std::atomic<std::size_t> in_flight_count_{0};
+            std::atomic<bool> initialized_{false};
+
+            // protects the creation and destruction of the ring
+            std::mutex register_mtx_;
+            std::size_t register_count_ = 0;
+        };
+
+        io_uring_context& get_context()
+        {
+            static io_uring_context context;
+            return context;
+        }
+
+        void complete(request& req, int result)
+        {
+            if (result < 0)
+            {
+                req.set_exception(HPX_GET_EXCEPTION(
+                    hpx::error::filesystem_error, operation_name(req.op_),
+                    hpx::util::format("operation failed: {}",
+                        std::strerror(-result))));
+            }
+            else
+            {
+                req.set_data(static_cast<std::size_t>(result));
+            }
+        }
+
+        void prepare(::io_uring_sqe* sqe, request const& req) noexcept
+        {
+            // io_uring transfers at most 4GB per operation, larger requests
+            // complete with a partial transfer like pread/pwrite
+            auto const size = static_cast<unsigned int>((std::min)(req.size_,
+                static_cast<std::size_t>(
+                    (std::numeric_limits<unsigned int>::max)())));
+
+            switch (req.op_)
+            {
+            case operation::read:
+                ::io_uring_prep_read(
+                    sqe, req.fd_, req.buffer_, size, req.offset_);
+                break;
+
+            case operation::write:
+                ::io_uring_prep_write(
+                    sqe, req.fd_, req.buffer_, size, req.offset_);
+                break;
+
+            case operation::fsync:
+                ::io_uring_prep_fsync(sqe, req.fd_, 0);
+                break;
+
+            default:
+                HPX_ASSERT(false);
+                break;
+            }
+        }
+
+        // Reap completed operations and submit queued ones.
+        hpx::threads::policies::detail::polling_status poll()
+        {
+            using hpx::threads::policies::detail::polling_status;
+
+            io_uring_context& ctx = get_context();
+            if (!ctx.initialized_.load(std::memory_order_acquire))
+            {
+                return polling_status::idle;
+            }
+
+            // Don't poll if another thread is already polling
+            std::unique_lock<mutex_type> lk(ctx.ring_mtx_, std::try_to_lock);
+            if (!lk.owns_lock() ||
+                !ctx.initialized_.load(std::memory_order_relaxed))
+            {
+                return polling_status::idle;
+            }
+
+            // reap the completions, every entry adopts the reference that
+            // was handed to the ring on submission
+            unsigned int head = 0;
+            unsigned int completed = 0;
+            ::io_uring_cqe* cqe = nullptr;
+            io_uring_for_each_cqe(&ctx.ring_, head, cqe)
+            {
+                request_ptr req(
+                    static_cast<request*>(::io_uring_cqe_get_data(cqe)), false);
+                complete(*req, cqe->res);
+                ++completed;
+            }
+            ::io_uring_cq_advance(&ctx.ring_, completed);
+            ctx.in_flight_ -= completed;
+
+            // move queued operations to the ring
+            request_ptr req;
+            while (ctx.in_flight_ < ctx.queue_depth_ &&
+                ctx.pending_.try_dequeue(req))
+            {
+                ::io_uring_sqe* sqe = ::io_uring_get_sqe(&ctx.ring_);
+                if (sqe == nullptr)
+                {
+                    // the submission queue is still occupied by operations
+                    // the kernel did not accept yet
+                    ctx.pending_.enqueue(HPX_MOVE(req));
+                    break;
+                }
+
+                prepare(sqe, *req);
+                ::io_uring_sqe_set_data(sqe, req.detach());
+                ++ctx.in_flight_;
+            }
+
+            if (::io_uring_sq_ready(&ctx.ring_) != 0)
+            {
+                // on failure (-EAGAIN, -EBUSY, -EINTR) the operations stay in
+                // the submission queue and are retried during the next poll
+                ::io_uring_submit(&ctx.ring_);
+            }
+
+            ctx.in_flight_count_.store(
+                ctx.in_flight_, std::memory_order_relaxed);
+
+            return ctx.in_flight_ == 0 && ctx.pending_.size_approx() == 0 ?
+                polling_status::idle :
+                polling_status::busy;
+        }
+
+        std::size_t get_work_count()
+        {
+            io_uring_context const& ctx = get_context();
+            return ctx.in_flight_count_.load(std::memory_order_relaxed) +
+                ctx.pending_.size_approx();
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<std::size_t> submit(operation op, int fd, void* buffer,
+        std::size_t size, std::uint64_t offset)
+    {
+        io_uring_context& ctx = get_context();
+        if (!ctx.initialized_.load(std::memory_order_acquire))
+        {
+            return hpx::make_exceptional_future<std::size_t>(
+                HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                    operation_name(op),
+                    "file I/O polling has not been enabled on any thread "
+                    "pool, use hpx::experimental::file_io::"
+                    "enable_user_polling"));
+        }
+
+        request_ptr req(new request(request::init_no_addref{}, op, fd,
+                            buffer, size, offset),
+            false);
+
+        hpx::future<std::size_t> f =
+            hpx::traits::future_access<hpx::future<std::size_t>>::create(req);
+
+        ctx.pending_.enqueue(HPX_MOVE(req));
+        return f;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_polling(
+        hpx::threads::thread_pool_base& pool, std::size_t queue_depth)
+    {
+        io_uring_context& ctx = get_context();
+
+        {
+            std::lock_guard<std::mutex> l(ctx.register_mtx_);
+            if (ctx.register_count_++ == 0)
+            {
+                HPX_ASSERT(queue_depth != 0);
+
+                std::lock_guard<mutex_type> ring_lock(ctx.ring_mtx_);
+                int const result = ::io_uring_queue_init(
+                    static_cast<unsigned int>(queue_depth), &ctx.ring_, 0);
+                if (result < 0)
+                {
+                    --ctx.register_count_;
+                    HPX_THROW_EXCEPTION(hpx::error::kernel_error,
+                        "hpx::experimental::file_io::register_polling",
+                        "io_uring_queue_init failed: {}",
+                        std::strerror(-result));
+                }
+
+                ctx.queue_depth_ = queue_depth;
+                ctx.in_flight_ = 0;
+                ctx.initialized_.store(true, std::memory_order_release);
+            }
+        }
+
+        pool.get_scheduler()->set_io_polling_functions(&poll, &get_work_count);
+    }
+
+    void unregister_polling(hpx::threads::thread_pool_base& pool)
+    {
+        pool.get_scheduler()->clear_io_polling_function();
+
+        io_uring_context& ctx = get_context();
+
+        std::lock_guard<std::mutex> l(ctx.register_mtx_);
+        HPX_ASSERT(ctx.register_count_ != 0);
+        if (--ctx.register_count_ == 0)
+        {
+            std::lock_guard<mutex_type> ring_lock(ctx.ring_mtx_);
+
+            HPX_ASSERT_MSG(
+                ctx.in_flight_ == 0 && ctx.pending_.size_approx() == 0,
+                "file I/O polling was disabled while there are unfinished "
+                "operations. Make sure file I/O polling is not disabled too "
+                "early.");
+
+            ctx.initialized_.store(false, std::memory_order_release);
+            ::io_uring_queue_exit(&ctx.ring_);
+        }
+    }
+}    // namespace hpx::experimental::file_io::detail
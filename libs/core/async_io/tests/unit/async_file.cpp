@@ -0,0 +1,160 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/async_io.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+constexpr std::size_t block_size = 4096;
+constexpr std::size_t num_blocks = 2048;
+
+std::string temp_file_name()
+{
+    return (hpx::filesystem::temp_directory_path() /
+        ("hpx_async_file_" + std::to_string(::getpid()) + ".dat"))
+        .string();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_not_enabled(std::string const& path)
+{
+    hpx::experimental::file f(path, O_RDWR | O_CREAT | O_TRUNC);
+
+    // no thread pool polls for completions
+    char buffer[16];
+    bool caught_exception = false;
+    try
+    {
+        f.async_read(buffer, sizeof(buffer), 0).get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_write_read(std::string const& path)
+{
+    hpx::experimental::file f(path, O_RDWR | O_CREAT | O_TRUNC);
+    HPX_TEST(f.is_open());
+
+    // more operations in flight than the ring can take at once
+    std::vector<std::uint8_t> data(block_size * num_blocks);
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        data[i] = static_cast<std::uint8_t>(i * 7 + i / block_size);
+    }
+
+    std::vector<hpx::future<std::size_t>> writes;
+    writes.reserve(num_blocks);
+    for (std::size_t i = 0; i != num_blocks; ++i)
+    {
+        writes.push_back(f.async_write(
+            data.data() + i * block_size, block_size, i * block_size));
+    }
+    for (auto& w : writes)
+    {
+        HPX_TEST_EQ(w.get(), block_size);
+    }
+
+    f.async_fsync().get();
+
+    // read the blocks back in reverse order
+    std::vector<std::uint8_t> result(data.size(), 0);
+    std::vector<hpx::future<std::size_t>> reads;
+    reads.reserve(num_blocks);
+    for (std::size_t i = num_blocks; i != 0; --i)
+    {
+        reads.push_back(f.async_read(result.data() + (i - 1) * block_size,
+            block_size, (i - 1) * block_size));
+    }
+    for (auto& r : reads)
+    {
+        HPX_TEST_EQ(r.get(), block_size);
+    }
+    HPX_TEST(result == data);
+
+    // reading past the end of the file yields a short read
+    std::vector<std::uint8_t> tail(2 * block_size);
+    HPX_TEST_EQ(
+        f.async_read(tail.data(), tail.size(), data.size() - block_size).get(),
+        block_size);
+    HPX_TEST_EQ(
+        f.async_read(tail.data(), tail.size(), data.size() + block_size).get(),
+        std::size_t(0));
+
+    // continuations are attached as for any other future
+    hpx::future<bool> verified =
+        f.async_read(tail.data(), block_size, 0).then([&](auto&& r) {
+            return r.get() == block_size && tail[1] == data[1];
+        });
+    HPX_TEST(verified.get());
+
+    f.close();
+    HPX_TEST(!f.is_open());
+}
+
+void test_error(std::string const& path)
+{
+    // writing to a file opened for reading fails with EBADF
+    hpx::experimental::file f(path, O_RDONLY);
+
+    char buffer[16] = {};
+    bool caught_exception = false;
+    try
+    {
+        f.async_write(buffer, sizeof(buffer), 0).get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::filesystem_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::string const path = temp_file_name();
+
+    test_not_enabled(path);
+
+    {
+        // a small ring makes most of the operations wait for submission
+        hpx::experimental::file_io::enable_user_polling enable_polling(
+            "", 64);
+
+        test_write_read(path);
+        test_error(path);
+    }
+
+    hpx::filesystem::remove(path);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -65,6 +65,10 @@ namespace hpx::local::detail {
             hpx::program_options::variables_map& vm,
             std::vector<std::string>& ini_config);
 
+        static void enable_profiling_settings(
+            hpx::program_options::variables_map const& vm,
+            std::vector<std::string>& ini_config);
+
         void store_command_line(int argc, char** argv);
         void store_unregistered_options(std::string const& cmd_name,
             std::vector<std::string> const& unregistered_options);
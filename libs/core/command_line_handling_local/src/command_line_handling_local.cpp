@@ -482,11 +482,13 @@ namespace hpx::local::detail {
             }
 
             if (!(queuing_ == "local-priority" || queuing_ == "abp-priority" ||
+                    queuing_ == "local-deadline" ||
                     queuing_.find("local-workrequesting") != 0))
             {
                 throw hpx::detail::command_line_error(
                     "Invalid command line option --hpx:high-priority-threads, "
                     "valid for --hpx:queuing=local-priority, "
+                    "--hpx:queuing=local-deadline, "
                     "--hpx:queuing=local-workrequesting-fifo, "
                     "--hpx:queuing=local-workrequesting-lifo, "
                     "--hpx:queuing=local-workrequesting-mc, "
@@ -508,6 +510,7 @@ namespace hpx::local::detail {
 
         // fill logging default
         enable_logging_settings(vm, ini_config);
+        enable_profiling_settings(vm, ini_config);
 
         // handle command line arguments after logging defaults
         if (vm.count("hpx:ini"))
@@ -708,6 +711,24 @@ namespace hpx::local::detail {
 #endif
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void command_line_handling::enable_profiling_settings(
+        hpx::program_options::variables_map const& vm,
+        std::vector<std::string>& ini_config)
+    {
+        if (vm.count("hpx:profile"))
+        {
+            ini_config.emplace_back("hpx.profile.destination!=" +
+                vm["hpx:profile"].as<std::string>());
+        }
+
+        if (vm.count("hpx:trace"))
+        {
+            ini_config.emplace_back("hpx.trace.destination!=" +
+                vm["hpx:trace"].as<std::string>());
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void command_line_handling::store_command_line(int argc, char** argv)
     {
@@ -559,8 +559,8 @@ namespace hpx::local::detail {
             ("hpx:queuing", value<argument_string>(),
                 "the queue scheduling policy to use, options are "
                 "'local', 'local-priority-fifo','local-priority-lifo', "
-                "'abp-priority-fifo', 'abp-priority-lifo', 'static', "
-                "'static-priority', 'local-workrequesting-fifo',"
+                "'local-deadline', 'abp-priority-fifo', 'abp-priority-lifo', "
+                "'static', 'static-priority', 'local-workrequesting-fifo',"
                 "'local-workrequesting-lifo', and 'local-workrequesting-mc' "
                 "(default: 'local-priority'; all option values can be "
                 "abbreviated)")
@@ -568,6 +568,7 @@ namespace hpx::local::detail {
                 "the number of operating system threads maintaining a high "
                 "priority queue (default: number of OS threads), valid for "
                 "--hpx:queuing=local-priority,--hpx:queuing=static-priority, "
+                "--hpx:queuing=local-deadline, "
                 "--hpx:queuing=local-workrequesting-fifo, "
                 "--hpx:queuing=local-workrequesting-lifo, "
                 "--hpx:queuing=local-workrequesting-mc, "
@@ -605,6 +606,20 @@ namespace hpx::local::detail {
                 "wait for a debugger to be attached, possible values: "
                 "off, startup, exception or test-failure (default: startup)")
 #endif
+            ("hpx:profile",
+                value<std::string>()->implicit_value(
+                    "hpx_profile.$[hpx.locality:0].folded"),
+                "sample the worker threads and write the collected stack "
+                "samples (attributed to the HPX thread descriptions) to the "
+                "given file in the folded stacks format at shutdown "
+                "(default: hpx_profile.<locality-id>.folded)")
+            ("hpx:trace",
+                value<std::string>()->implicit_value(
+                    "hpx_trace.$[hpx.locality:0].json"),
+                "record the execution of all HPX threads and write the "
+                "collected events to the given file in the Chrome trace "
+                "event format at shutdown "
+                "(default: hpx_trace.<locality-id>.json)")
             ("hpx:debug-hpx-log", value<std::string>()->implicit_value("cout"),
                 "enable all messages on the HPX log channel and send all "
                 "HPX logs to the target destination")
@@ -140,6 +140,11 @@ namespace hpx::threads::coroutines {
             impl_.rebind(HPX_MOVE(f), HPX_MOVE(id));
         }
 
+        void unbind_stack() noexcept
+        {
+            impl_.unbind_stack();
+        }
+
         HPX_FORCEINLINE result_type operator()(arg_type arg = arg_type())
         {
             HPX_ASSERT(impl_.is_ready());
@@ -101,7 +101,7 @@ namespace hpx::threads::coroutines {
             {
                 // Condition excludes MacOS/M1 from using posix mmap
 #if defined(HPX_USE_POSIX_STACK_UTILITIES)
-                void* limit = posix::alloc_stack(size);
+                void* limit = posix::alloc_cached_stack(size);
                 posix::watermark_stack(limit, size);
 #else
                 void* limit = std::calloc(size, sizeof(char));
@@ -274,6 +274,26 @@ namespace hpx::threads::coroutines {
                 }
             }
 
+            // Release the stack of a terminated coroutine to the stack cache
+            // of the calling OS thread. The next invocation binds a new stack.
+            // The coroutine keeps its stack if the cache is full.
+            void unbind_stack() noexcept
+            {
+#if defined(HPX_USE_POSIX_STACK_UTILITIES) &&                                  \
+    !defined(HPX_GENERIC_CONTEXT_USE_SEGMENTED_STACKS)
+                if (ctx_ == nullptr || stack_pointer_ == nullptr ||
+                    !posix::cache_stack(
+                        static_cast<char*>(stack_pointer_) - stack_size_,
+                        stack_size_))
+                {
+                    return;
+                }
+
+                stack_pointer_ = nullptr;
+                ctx_ = nullptr;
+#endif
+            }
+
             void rebind_stack()
             {
                 if (ctx_)
@@ -311,8 +311,8 @@ namespace hpx::threads::coroutines::detail::lx {
                     "stack size of {1} is invalid", m_stack_size));
             }
 
-            m_stack =
-                posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
+            m_stack = posix::alloc_cached_stack(
+                static_cast<std::size_t>(m_stack_size));
             if (m_stack == nullptr)
             {
                 throw std::runtime_error("could not allocate memory for stack");
@@ -380,6 +380,25 @@ namespace hpx::threads::coroutines::detail::lx {
             }
         }
 
+        // Release the stack of a terminated coroutine to the stack cache of
+        // the calling OS thread. The next invocation binds a new stack. The
+        // coroutine keeps its stack if the cache is full.
+        void unbind_stack() noexcept
+        {
+            if (m_stack == nullptr ||
+                !posix::cache_stack(
+                    m_stack, static_cast<std::size_t>(m_stack_size)))
+            {
+                return;
+            }
+
+#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
+            VALGRIND_STACK_DEREGISTER(
+                reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
+#endif
+            m_stack = nullptr;
+        }
+
         void rebind_stack()
         {
             // directly executed coroutine, no need to allocate a stack
@@ -466,8 +485,14 @@ namespace hpx::threads::coroutines::detail::lx {
             // https://rethinkdb.com/blog/handling-stack-overflow-on-custom-stacks/
             // http://www.evanjones.ca/software/threading.html
             //
-            if (register_signal_handler)
+            // the alternate signal stack has to be installed only once per OS
+            // thread, stacks are bound whenever a thread is run for the first
+            // time
+            static thread_local bool installed = false;
+            if (register_signal_handler && !installed)
             {
+                installed = true;
+
                 segv_stack.ss_sp = valloc(SEGV_STACK_SIZE);
                 segv_stack.ss_flags = 0;
                 segv_stack.ss_size = SEGV_STACK_SIZE;
@@ -250,7 +250,8 @@ namespace hpx::threads::coroutines {
                 if (m_stack != nullptr)
                     return;
 
-                m_stack = alloc_stack(static_cast<std::size_t>(m_stack_size));
+                m_stack = alloc_cached_stack(
+                    static_cast<std::size_t>(m_stack_size));
                 if (m_stack == nullptr)
                 {
                     throw std::runtime_error(
@@ -268,8 +269,14 @@ namespace hpx::threads::coroutines {
                 // https://rethinkdb.com/blog/handling-stack-overflow-on-custom-stacks/
                 // http://www.evanjones.ca/software/threading.html
                 //
-                if (register_signal_handler)
+                // the alternate signal stack has to be installed only once
+                // per OS thread, stacks are bound whenever a thread is run for
+                // the first time
+                static thread_local bool installed = false;
+                if (register_signal_handler && !installed)
                 {
+                    installed = true;
+
                     segv_stack.ss_sp = valloc(SEGV_STACK_SIZE);
                     segv_stack.ss_flags = 0;
                     segv_stack.ss_size = SEGV_STACK_SIZE;
@@ -369,6 +376,21 @@ namespace hpx::threads::coroutines {
                 }
             }
 
+            // Release the stack of a terminated coroutine to the stack cache
+            // of the calling OS thread. The next invocation binds a new stack.
+            // The coroutine keeps its stack if the cache is full.
+            void unbind_stack() noexcept
+            {
+                if (m_stack == nullptr ||
+                    !cache_stack(
+                        m_stack, static_cast<std::size_t>(m_stack_size)))
+                {
+                    return;
+                }
+
+                m_stack = nullptr;
+            }
+
             void rebind_stack()
             {
                 if (m_stack)
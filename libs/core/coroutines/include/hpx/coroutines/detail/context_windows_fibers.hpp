@@ -283,6 +283,9 @@ namespace hpx::threads::coroutines {
 
             static constexpr void reset_stack(bool) noexcept {}
 
+            // fibers own their stack
+            static constexpr void unbind_stack() noexcept {}
+
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
             void rebind_stack() noexcept
             {
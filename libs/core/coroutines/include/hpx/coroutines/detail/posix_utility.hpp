@@ -46,6 +46,7 @@
  */
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -78,6 +79,27 @@ namespace hpx::threads::coroutines::detail::posix {
 
     HPX_CORE_EXPORT extern bool use_guard_pages;
 
+    // this global variable defines the number of stacks released by
+    // terminated threads which are kept per OS thread for reuse (threads keep
+    // their stack until they are destroyed if the cache is full, zero
+    // disables caching stacks)
+    HPX_CORE_EXPORT extern std::size_t stack_cache_size;
+
+    // Allocate a stack of the given size, reusing a stack from the cache of
+    // the calling OS thread, if possible.
+    HPX_CORE_EXPORT void* alloc_cached_stack(std::size_t size);
+
+    // Return a stack to the cache of the calling OS thread. Returns false if
+    // the cache is full, in which case the stack remains owned by the caller.
+    HPX_CORE_EXPORT bool cache_stack(void* stack, std::size_t size) noexcept;
+
+    // Return the number of stacks released to (reused from) the stack caches
+    // of all OS threads.
+    HPX_CORE_EXPORT std::int64_t get_stack_cache_release_count(
+        bool reset) noexcept;
+    HPX_CORE_EXPORT std::int64_t get_stack_cache_reuse_count(
+        bool reset) noexcept;
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
@@ -217,6 +217,20 @@ namespace hpx::threads {
         /// domains to the scheduler. Typically indices will wrap around when
         /// too large.
         numa = 2,
+
+        /// A hint that tells the scheduler to prefer scheduling a task on the
+        /// worker thread that creates it. For continuations this is the
+        /// worker thread that has made the last of their inputs ready. The
+        /// hint is resolved into a \a thread hint when the task is created,
+        /// the numerical hint is unused. Tasks created from outside of the
+        /// thread pool are scheduled as if no hint was given.
+        local_thread = 3,
+
+        /// A hint that tells the scheduler to prefer scheduling a task on the
+        /// NUMA domain of the worker thread that creates it. The hint is
+        /// resolved into a \a numa hint when the task is created, the
+        /// numerical hint is unused.
+        local_numa = 4,
     };
 
     ///////////////////////////////////////////////////////////////////////////
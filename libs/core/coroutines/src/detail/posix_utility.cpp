@@ -12,12 +12,105 @@
 
 #include <hpx/coroutines/detail/posix_utility.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 namespace hpx::threads::coroutines::detail::posix {
 
     ///////////////////////////////////////////////////////////////////////////
     // this global variable is used to control whether guard pages will be used
     // or not
     bool use_guard_pages = true;
+
+    // this global variable is used to control how many stacks will be cached
+    // per OS thread
+    std::size_t stack_cache_size = 16;
+
+    namespace {
+
+        // The stacks most recently released on an OS thread. Those are
+        // likely to be still in the caches of the core executing this OS
+        // thread, thus the last released stack is reused first.
+        struct stack_cache
+        {
+            stack_cache() = default;
+
+            stack_cache(stack_cache const&) = delete;
+            stack_cache(stack_cache&&) = delete;
+            stack_cache& operator=(stack_cache const&) = delete;
+            stack_cache& operator=(stack_cache&&) = delete;
+
+            ~stack_cache()
+            {
+                for (auto const& [stack, size] : stacks_)
+                {
+                    free_stack(stack, size);
+                }
+            }
+
+            std::vector<std::pair<void*, std::size_t>> stacks_;
+        };
+
+        stack_cache& get_stack_cache()
+        {
+            static thread_local stack_cache cache;
+            return cache;
+        }
+
+        std::atomic<std::int64_t> stack_cache_release_count(0);
+        std::atomic<std::int64_t> stack_cache_reuse_count(0);
+    }    // namespace
+
+    void* alloc_cached_stack(std::size_t size)
+    {
+        auto& stacks = get_stack_cache().stacks_;
+        for (auto it = stacks.rbegin(); it != stacks.rend(); ++it)
+        {
+            if (it->second == size)
+            {
+                void* stack = it->first;
+                stacks.erase(std::next(it).base());
+                stack_cache_reuse_count.fetch_add(1, std::memory_order_relaxed);
+                return stack;
+            }
+        }
+        return alloc_stack(size);
+    }
+
+    bool cache_stack(void* stack, std::size_t size) noexcept
+    {
+        auto& stacks = get_stack_cache().stacks_;
+        if (stacks.size() < stack_cache_size)
+        {
+            try
+            {
+                stacks.emplace_back(stack, size);
+                stack_cache_release_count.fetch_add(
+                    1, std::memory_order_relaxed);
+                return true;
+            }
+            catch (...)
+            {
+                // the stack stays with its owner
+            }
+        }
+        return false;
+    }
+
+    std::int64_t get_stack_cache_release_count(bool reset) noexcept
+    {
+        return reset ? stack_cache_release_count.exchange(0) :
+                       stack_cache_release_count.load();
+    }
+
+    std::int64_t get_stack_cache_reuse_count(bool reset) noexcept
+    {
+        return reset ? stack_cache_reuse_count.exchange(0) :
+                       stack_cache_reuse_count.load();
+    }
 }    // namespace hpx::threads::coroutines::detail::posix
 
 #endif
@@ -158,14 +158,18 @@ namespace hpx::lcos::detail {
     ///////////////////////////////////////////////////////////////////////////
     struct post_policy_spawner
     {
+        // the schedule hint of the launch policy, hints referring to the
+        // local worker thread are resolved on the thread that makes the
+        // future ready
+        threads::thread_schedule_hint hint;
+
         template <typename F>
         void operator()(F&& f, hpx::threads::thread_description desc,
             threads::thread_id_ref_type& id) const
         {
             threads::thread_init_data data(
                 threads::make_thread_function_nullary(HPX_FORWARD(F, f)),
-                HPX_MOVE(desc), threads::thread_priority::default_,
-                threads::thread_schedule_hint(),
+                HPX_MOVE(desc), threads::thread_priority::default_, hint,
                 threads::thread_stacksize::default_,
                 threads::thread_schedule_state::pending);
 
@@ -202,7 +206,7 @@ namespace hpx::lcos::detail {
             new shared_state(init_no_addref{}, HPX_FORWARD(F, f)), false);
 
         static_cast<shared_state*>(p.get())->template attach<true>(
-            HPX_FORWARD(Future, future), spawner_type{},
+            HPX_FORWARD(Future, future), spawner_type{policy.hint()},
             HPX_FORWARD(Policy, policy));
 
         return p;
@@ -243,7 +247,7 @@ namespace hpx::lcos::detail {
             p.release(), false);
 
         static_cast<shared_state*>(r.get())->template attach<true>(
-            HPX_FORWARD(Future, future), spawner_type{},
+            HPX_FORWARD(Future, future), spawner_type{policy.hint()},
             HPX_FORWARD(Policy, policy));
 
         return r;
@@ -285,7 +289,7 @@ namespace hpx::lcos::detail {
             p.release(), false);
 
         static_cast<shared_state*>(r.get())->template attach<false>(
-            HPX_FORWARD(Future, future), spawner_type{},
+            HPX_FORWARD(Future, future), spawner_type{policy.hint()},
             HPX_FORWARD(Policy, policy));
 
         return r;
@@ -0,0 +1,236 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/autotuning_chunk_size.hpp
+/// \page hpx::execution::experimental::autotuning_chunk_size
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assertion/source_location.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // The tuning state shared by all autotuning_chunk_size objects that
+        // were created with the same key.
+        class autotuning_entry;
+
+        HPX_CORE_EXPORT std::shared_ptr<autotuning_entry> get_autotuning_entry(
+            std::string const& key);
+
+        HPX_CORE_EXPORT std::string const& get_autotuning_key(
+            autotuning_entry const& entry) noexcept;
+
+        // Open a new measurement for the calling thread if none is active,
+        // returns the ticket identifying it (or zero)
+        HPX_CORE_EXPORT std::uint64_t autotuning_begin(
+            autotuning_entry& entry) noexcept;
+
+        // Select the number of cores to use for the given number of
+        // iterations, starts the timer if a measurement is active
+        HPX_CORE_EXPORT std::size_t autotuning_processing_units_count(
+            autotuning_entry& entry, std::size_t max_cores,
+            std::size_t count) noexcept;
+
+        HPX_CORE_EXPORT std::size_t autotuning_get_chunk_size(
+            autotuning_entry& entry, std::size_t cores,
+            std::size_t count) noexcept;
+
+        // Record the execution time of the measurement identified by the
+        // given ticket
+        HPX_CORE_EXPORT void autotuning_end(
+            autotuning_entry& entry, std::uint64_t ticket) noexcept;
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into chunks whose size and number of cores
+    /// are learned from the previous invocations of the algorithms using the
+    /// same key. By default, the key is the source location at which the
+    /// executor parameters object was created, i.e. the call site of the
+    /// algorithm. All objects using the same key share one tuning table.
+    ///
+    /// The input sizes are grouped into power-of-two buckets. For each bucket
+    /// a set of configurations (a number of cores times a number of chunks per
+    /// core) is measured a few times each, afterwards the fastest one is used.
+    /// Every 64th invocation one of the other configurations is measured
+    /// again, which allows to follow changes of the system load. At most one
+    /// invocation per key is measured at any point in time, all other
+    /// (concurrent) invocations use the best configuration known so far.
+    ///
+    /// \note One object should not be used by several concurrently running
+    ///       synchronous algorithms, copies of it can.
+    ///
+    /// The learned tables can be stored using \a save_autotuning_table and
+    /// reloaded in later runs of the application using
+    /// \a load_autotuning_table.
+    ///
+    struct autotuning_chunk_size
+    {
+#if defined(HPX_HAVE_CXX20_SOURCE_LOCATION) || defined(HPX_COMPUTE_DOXYGEN)
+        /// Construct an \a autotuning_chunk_size executor parameters object
+        /// that is keyed by the given source location
+        ///
+        /// \param loc  [in] The source location identifying the tuning
+        ///             table, defaults to the place the object is created at.
+        ///
+        explicit autotuning_chunk_size(
+            hpx::source_location const& loc = hpx::source_location::current())
+          : entry_(detail::get_autotuning_entry(make_key(loc)))
+        {
+        }
+#else
+        /// Construct an \a autotuning_chunk_size executor parameters object
+        /// that is keyed by the given source location, use
+        /// HPX_CURRENT_SOURCE_LOCATION() to create it.
+        ///
+        /// \note Default constructed objects all share one tuning table as
+        ///       the location of the call site is not available before C++20.
+        ///
+        explicit autotuning_chunk_size(hpx::source_location const& loc)
+          : entry_(detail::get_autotuning_entry(make_key(loc)))
+        {
+        }
+
+        autotuning_chunk_size()
+          : entry_(detail::get_autotuning_entry("<default>"))
+        {
+        }
+#endif
+
+        /// Construct an \a autotuning_chunk_size executor parameters object
+        /// that is keyed by the given annotation
+        ///
+        /// \param annotation [in] The name identifying the tuning table, it
+        ///                   should not contain tabs or newlines.
+        ///
+        explicit autotuning_chunk_size(std::string const& annotation)
+          : entry_(detail::get_autotuning_entry(annotation))
+        {
+        }
+
+        /// Return the key identifying the tuning table of this object
+        std::string const& key() const noexcept
+        {
+            return detail::get_autotuning_key(*entry_);
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::execution::experimental::mark_begin_execution_t,
+            autotuning_chunk_size const& this_, Executor&&) noexcept
+        {
+            this_.ticket_ = detail::autotuning_begin(*this_.entry_);
+        }
+
+        // select the number of cores for this invocation
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::execution::experimental::processing_units_count_t,
+            autotuning_chunk_size const& this_, Executor&& exec,
+            hpx::chrono::steady_duration const& duration =
+                hpx::chrono::null_duration,
+            std::size_t num_tasks = 0)
+        {
+            std::size_t const available_pus =
+                hpx::execution::experimental::processing_units_count(
+                    exec, duration, num_tasks);
+            return detail::autotuning_processing_units_count(
+                *this_.entry_, available_pus, num_tasks);
+        }
+
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::execution::experimental::get_chunk_size_t,
+            autotuning_chunk_size const& this_, Executor& /* exec */,
+            hpx::chrono::steady_duration const&, std::size_t cores,
+            std::size_t count) noexcept
+        {
+            return detail::autotuning_get_chunk_size(
+                *this_.entry_, cores, count);
+        }
+
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::execution::experimental::mark_end_execution_t,
+            autotuning_chunk_size const& this_, Executor&&) noexcept
+        {
+            if (this_.ticket_ != 0)
+            {
+                detail::autotuning_end(*this_.entry_, this_.ticket_);
+                this_.ticket_ = 0;
+            }
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        static std::string make_key(hpx::source_location const& loc)
+        {
+            return std::string(loc.file_name()) + ":" +
+                std::to_string(loc.line());
+        }
+
+        friend class hpx::serialization::access;
+
+        HPX_CORE_EXPORT void load(
+            hpx::serialization::input_archive& ar, unsigned int);
+        HPX_CORE_EXPORT void save(
+            hpx::serialization::output_archive& ar, unsigned int) const;
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::shared_ptr<detail::autotuning_entry> entry_;
+
+        // identifies the measurement started by this object, if any
+        mutable std::uint64_t ticket_ = 0;
+        /// \endcond
+    };
+
+    /// Write the tuning tables of all keys to the given file. The file is a
+    /// text file holding one line per key, input size bucket and measured
+    /// configuration.
+    ///
+    /// \returns false if the file could not be written.
+    ///
+    HPX_CORE_EXPORT bool save_autotuning_table(std::string const& filename);
+
+    /// Read tuning tables from the given file, which has been written by
+    /// \a save_autotuning_table. All configurations found in the file are
+    /// considered to be measured, i.e. the algorithms start off using the
+    /// best known configuration. Tables measured for a different number of
+    /// cores are discarded on first use.
+    ///
+    /// \returns false if the file could not be read.
+    ///
+    HPX_CORE_EXPORT bool load_autotuning_table(std::string const& filename);
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::autotuning_chunk_size> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace hpx::execution::experimental
@@ -0,0 +1,486 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/autotuning_chunk_size.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hpx::execution::experimental::detail {
+
+    namespace {
+
+        // number of measurements per configuration before the best one is
+        // selected
+        constexpr std::uint32_t num_samples = 3;
+
+        // every n-th invocation re-measures one of the other configurations
+        constexpr std::uint64_t remeasure_interval = 64;
+
+        // weight of a new measurement once all configurations are explored
+        constexpr double ema_weight = 0.25;
+
+        // measurements that were not finished after this time are abandoned
+        // (e.g. if the algorithm has thrown an exception)
+        constexpr std::uint64_t trial_timeout = 1000000000;    // ns
+
+        constexpr std::size_t chunks_per_core[] = {1, 2, 4, 8, 16};
+
+        // index of the power-of-two bucket for the given input size
+        std::size_t bucket_index(std::size_t count) noexcept
+        {
+            std::size_t index = 0;
+            while (count > 1)
+            {
+                count >>= 1;
+                ++index;
+            }
+            return index;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    class autotuning_entry
+    {
+    public:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        struct configuration
+        {
+            std::size_t cores;
+            std::size_t chunks_per_core;
+            double ns_per_item = 0.0;
+            std::uint32_t samples = 0;
+        };
+
+        struct bucket
+        {
+            // configurations are valid for this number of cores only
+            std::size_t max_cores = 0;
+            std::vector<configuration> configurations;
+            std::size_t best = npos;
+            std::uint64_t invocations = 0;
+            std::size_t next_remeasure = 0;
+
+            void reset(std::size_t cores)
+            {
+                max_cores = cores;
+                configurations.clear();
+                best = npos;
+                invocations = 0;
+                next_remeasure = 0;
+
+                // start off with the default partitioning (4 chunks per
+                // core on all cores)
+                configurations.push_back(configuration{cores, 4});
+                for (std::size_t c = cores; c != 0; c /= 2)
+                {
+                    for (std::size_t cpc : chunks_per_core)
+                    {
+                        if (c != cores || cpc != 4)
+                        {
+                            configurations.push_back(configuration{c, cpc});
+                        }
+                    }
+                }
+            }
+
+            // select the configuration to measure next
+            std::size_t select() noexcept
+            {
+                for (std::size_t i = 0; i != configurations.size(); ++i)
+                {
+                    if (configurations[i].samples < num_samples)
+                    {
+                        return i;
+                    }
+                }
+
+                if (++invocations % remeasure_interval == 0)
+                {
+                    std::size_t const i = next_remeasure;
+                    next_remeasure = (i + 1) % configurations.size();
+                    return i;
+                }
+                return best;
+            }
+
+            void record(std::size_t i, double ns_per_item) noexcept
+            {
+                configuration& c = configurations[i];
+                if (c.samples < num_samples)
+                {
+                    ++c.samples;
+                    c.ns_per_item +=
+                        (ns_per_item - c.ns_per_item) / c.samples;
+                }
+                else
+                {
+                    c.ns_per_item += ema_weight * (ns_per_item - c.ns_per_item);
+                }
+                update_best();
+            }
+
+            void update_best() noexcept
+            {
+                best = npos;
+                for (std::size_t i = 0; i != configurations.size(); ++i)
+                {
+                    configuration const& c = configurations[i];
+                    if (c.samples != 0 &&
+                        (best == npos ||
+                            c.ns_per_item < configurations[best].ns_per_item))
+                    {
+                        best = i;
+                    }
+                }
+            }
+        };
+
+        explicit autotuning_entry(std::string key)
+          : key_(HPX_MOVE(key))
+        {
+        }
+
+        std::string const& key() const noexcept
+        {
+            return key_;
+        }
+
+        std::uint64_t begin() noexcept
+        {
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+
+            std::lock_guard<hpx::spinlock> l(mtx_);
+            if (trial_ticket_ != 0 && now - trial_begin_ < trial_timeout)
+            {
+                return 0;    // another invocation is being measured
+            }
+
+            trial_ticket_ = ++last_ticket_;
+            trial_owner_ = hpx::threads::get_self_id();
+            trial_begin_ = now;
+            trial_bucket_ = npos;
+            trial_configuration_ = npos;
+            return trial_ticket_;
+        }
+
+        std::size_t processing_units_count(
+            std::size_t max_cores, std::size_t count) noexcept
+        {
+            if (count == 0 || max_cores == 0)
+            {
+                return max_cores;
+            }
+
+            std::size_t const index = bucket_index(count);
+            auto const self = hpx::threads::get_self_id();
+
+            std::lock_guard<hpx::spinlock> l(mtx_);
+            bucket& b = buckets_[index];
+            if (b.max_cores != max_cores)
+            {
+                b.reset(max_cores);
+            }
+
+            if (trial_ticket_ != 0 && trial_owner_ == self)
+            {
+                if (trial_configuration_ == npos)
+                {
+                    // start measuring this invocation
+                    trial_bucket_ = index;
+                    trial_configuration_ = b.select();
+                    trial_count_ = count;
+                    trial_begin_ = hpx::chrono::high_resolution_clock::now();
+                }
+                if (trial_bucket_ == index &&
+                    trial_configuration_ < b.configurations.size())
+                {
+                    return b.configurations[trial_configuration_].cores;
+                }
+            }
+
+            return b.best == npos ? max_cores :
+                                    b.configurations[b.best].cores;
+        }
+
+        std::size_t get_chunk_size(
+            std::size_t cores, std::size_t count) noexcept
+        {
+            std::size_t cpc = 4;
+            if (count != 0)
+            {
+                std::size_t const index = bucket_index(count);
+                auto const self = hpx::threads::get_self_id();
+
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                bucket const& b = buckets_[index];
+                if (trial_ticket_ != 0 && trial_owner_ == self &&
+                    trial_bucket_ == index &&
+                    trial_configuration_ < b.configurations.size())
+                {
+                    cpc = b.configurations[trial_configuration_]
+                              .chunks_per_core;
+                }
+                else if (b.best != npos)
+                {
+                    cpc = b.configurations[b.best].chunks_per_core;
+                }
+            }
+
+            std::size_t const num_chunks = (cores == 0 ? 1 : cores) * cpc;
+            return (count + num_chunks - 1) / num_chunks;
+        }
+
+        void end(std::uint64_t ticket) noexcept
+        {
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+
+            std::lock_guard<hpx::spinlock> l(mtx_);
+            if (ticket != trial_ticket_)
+            {
+                return;    // this measurement was abandoned
+            }
+
+            // the bucket might have been reset in the meantime
+            if (trial_configuration_ != npos &&
+                trial_configuration_ <
+                    buckets_[trial_bucket_].configurations.size())
+            {
+                buckets_[trial_bucket_].record(trial_configuration_,
+                    static_cast<double>(now - trial_begin_) /
+                        static_cast<double>(trial_count_));
+            }
+
+            trial_ticket_ = 0;
+            trial_owner_ = hpx::threads::invalid_thread_id;
+        }
+
+        template <typename F>
+        void for_each_configuration(F&& f)
+        {
+            std::lock_guard<hpx::spinlock> l(mtx_);
+            for (std::size_t i = 0; i != buckets_.size(); ++i)
+            {
+                for (configuration const& c : buckets_[i].configurations)
+                {
+                    if (c.samples != 0)
+                    {
+                        f(i, buckets_[i].max_cores, c);
+                    }
+                }
+            }
+        }
+
+        void load(std::size_t index, std::size_t max_cores, std::size_t cores,
+            std::size_t cpc, double ns_per_item)
+        {
+            if (index >= buckets_.size())
+            {
+                return;
+            }
+
+            std::lock_guard<hpx::spinlock> l(mtx_);
+            bucket& b = buckets_[index];
+            if (b.max_cores != max_cores)
+            {
+                b.reset(max_cores);
+            }
+
+            for (configuration& c : b.configurations)
+            {
+                if (c.cores == cores && c.chunks_per_core == cpc)
+                {
+                    c.ns_per_item = ns_per_item;
+                    c.samples = num_samples;
+                    b.update_best();
+                    return;
+                }
+            }
+
+            b.configurations.push_back(
+                configuration{cores, cpc, ns_per_item, num_samples});
+            b.update_best();
+        }
+
+    private:
+        std::string const key_;
+
+        hpx::spinlock mtx_;
+        std::array<bucket, std::numeric_limits<std::size_t>::digits> buckets_;
+
+        // the invocation currently being measured
+        std::uint64_t last_ticket_ = 0;
+        std::uint64_t trial_ticket_ = 0;
+        hpx::threads::thread_id_type trial_owner_;
+        std::uint64_t trial_begin_ = 0;
+        std::size_t trial_bucket_ = npos;
+        std::size_t trial_configuration_ = npos;
+        std::size_t trial_count_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        struct autotuning_registry
+        {
+            std::mutex mtx_;
+            std::unordered_map<std::string, std::shared_ptr<autotuning_entry>>
+                entries_;
+        };
+
+        autotuning_registry& get_registry()
+        {
+            static autotuning_registry registry;
+            return registry;
+        }
+    }    // namespace
+
+    std::shared_ptr<autotuning_entry> get_autotuning_entry(
+        std::string const& key)
+    {
+        autotuning_registry& registry = get_registry();
+
+        std::lock_guard<std::mutex> l(registry.mtx_);
+        auto it = registry.entries_.find(key);
+        if (it == registry.entries_.end())
+        {
+            it = registry.entries_
+                     .emplace(key, std::make_shared<autotuning_entry>(key))
+                     .first;
+        }
+        return it->second;
+    }
+
+    std::string const& get_autotuning_key(
+        autotuning_entry const& entry) noexcept
+    {
+        return entry.key();
+    }
+
+    std::uint64_t autotuning_begin(autotuning_entry& entry) noexcept
+    {
+        return entry.begin();
+    }
+
+    std::size_t autotuning_processing_units_count(autotuning_entry& entry,
+        std::size_t max_cores, std::size_t count) noexcept
+    {
+        return entry.processing_units_count(max_cores, count);
+    }
+
+    std::size_t autotuning_get_chunk_size(
+        autotuning_entry& entry, std::size_t cores, std::size_t count) noexcept
+    {
+        return entry.get_chunk_size(cores, count);
+    }
+
+    void autotuning_end(autotuning_entry& entry, std::uint64_t ticket) noexcept
+    {
+        entry.end(ticket);
+    }
+}    // namespace hpx::execution::experimental::detail
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    void autotuning_chunk_size::load(
+        hpx::serialization::input_archive& ar, unsigned int)
+    {
+        std::string key;
+        ar >> key;
+        entry_ = detail::get_autotuning_entry(key);
+        ticket_ = 0;
+    }
+
+    void autotuning_chunk_size::save(
+        hpx::serialization::output_archive& ar, unsigned int) const
+    {
+        ar << detail::get_autotuning_key(*entry_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every line of the file holds (separated by tabs): the key, the index of
+    // the input size bucket, the number of cores the table was measured for,
+    // the number of cores and chunks per core of the configuration, and the
+    // measured time per iteration in nanoseconds.
+    bool save_autotuning_table(std::string const& filename)
+    {
+        std::vector<std::shared_ptr<detail::autotuning_entry>> entries;
+        {
+            detail::autotuning_registry& registry = detail::get_registry();
+            std::lock_guard<std::mutex> l(registry.mtx_);
+            entries.reserve(registry.entries_.size());
+            for (auto const& e : registry.entries_)
+            {
+                entries.push_back(e.second);
+            }
+        }
+
+        std::ofstream out(filename);
+        if (!out)
+        {
+            return false;
+        }
+
+        for (auto const& e : entries)
+        {
+            e->for_each_configuration(
+                [&](std::size_t index, std::size_t max_cores,
+                    detail::autotuning_entry::configuration const& c) {
+                    out << e->key() << '\t' << index << '\t' << max_cores
+                        << '\t' << c.cores << '\t' << c.chunks_per_core
+                        << '\t' << c.ns_per_item << '\n';
+                });
+        }
+        return static_cast<bool>(out);
+    }
+
+    bool load_autotuning_table(std::string const& filename)
+    {
+        std::ifstream in(filename);
+        if (!in)
+        {
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(in, line))
+        {
+            std::istringstream fields(line);
+
+            std::string key;
+            std::size_t index = 0, max_cores = 0, cores = 0, cpc = 0;
+            double ns_per_item = 0.0;
+            if (!std::getline(fields, key, '\t') ||
+                !(fields >> index >> max_cores >> cores >> cpc >>
+                    ns_per_item) ||
+                cores == 0 || cpc == 0)
+            {
+                return false;
+            }
+
+            detail::get_autotuning_entry(key)->load(
+                index, max_cores, cores, cpc, ns_per_item);
+        }
+        return true;
+    }
+}    // namespace hpx::execution::experimental
@@ -0,0 +1,174 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "foreach_tests.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+void test_autotuning_executor_parameters()
+{
+    typedef std::random_access_iterator_tag iterator_tag;
+    {
+        hpx::execution::experimental::autotuning_chunk_size p;
+        auto policy = hpx::execution::par.with(p);
+        test_for_each(policy, iterator_tag());
+    }
+
+    {
+        hpx::execution::experimental::autotuning_chunk_size p;
+        auto policy = hpx::execution::par(hpx::execution::task).with(p);
+        test_for_each_async(policy, iterator_tag());
+    }
+
+    hpx::execution::parallel_executor par_exec;
+
+    {
+        hpx::execution::experimental::autotuning_chunk_size p;
+        auto policy = hpx::execution::par.on(par_exec).with(p);
+        test_for_each(policy, iterator_tag());
+    }
+
+    {
+        hpx::execution::experimental::autotuning_chunk_size p;
+        auto policy =
+            hpx::execution::par(hpx::execution::task).on(par_exec).with(p);
+        test_for_each_async(policy, iterator_tag());
+    }
+}
+
+void test_autotuning_executor_parameters_ref()
+{
+    typedef std::random_access_iterator_tag iterator_tag;
+
+    {
+        hpx::execution::experimental::autotuning_chunk_size p;
+        test_for_each(hpx::execution::par.with(std::ref(p)), iterator_tag());
+    }
+
+    {
+        hpx::execution::experimental::autotuning_chunk_size p;
+        test_for_each_async(
+            hpx::execution::par(hpx::execution::task).with(std::ref(p)),
+            iterator_tag());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// run the same call site often enough for all configurations to be measured,
+// every invocation has to visit all elements exactly once
+void test_autotuning_converges()
+{
+    hpx::execution::experimental::autotuning_chunk_size p(
+        std::string("autotuning_converges"));
+    HPX_TEST_EQ(p.key(), std::string("autotuning_converges"));
+
+    std::vector<std::size_t> c(10007);
+    for (int i = 0; i != 500; ++i)
+    {
+        std::atomic<std::size_t> count(0);
+        hpx::for_each(hpx::execution::par.with(p), c.begin(), c.end(),
+            [&](std::size_t& v) {
+                ++v;
+                ++count;
+            });
+        HPX_TEST_EQ(count.load(), c.size());
+
+        hpx::for_each(hpx::execution::par(hpx::execution::task).with(p),
+            c.begin(), c.end(), [](std::size_t& v) { ++v; })
+            .get();
+    }
+
+    HPX_TEST(std::all_of(
+        c.begin(), c.end(), [](std::size_t v) { return v == 1000; }));
+}
+
+void test_autotuning_table()
+{
+    std::string const filename =
+        (hpx::filesystem::temp_directory_path() /
+            ("hpx_autotuning_" + std::to_string(std::rand()) + ".txt"))
+            .string();
+
+    HPX_TEST(hpx::execution::experimental::save_autotuning_table(filename));
+
+    // the converged table from above has to be part of the file
+    {
+        std::ifstream in(filename);
+        std::string line;
+        bool found = false;
+        while (std::getline(in, line))
+        {
+            found = found || line.rfind("autotuning_converges\t", 0) == 0;
+        }
+        HPX_TEST(found);
+    }
+
+    HPX_TEST(hpx::execution::experimental::load_autotuning_table(filename));
+    HPX_TEST(!hpx::execution::experimental::load_autotuning_table(
+        filename + ".does_not_exist"));
+
+    hpx::filesystem::remove(filename);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_autotuning_executor_parameters();
+    test_autotuning_executor_parameters_ref();
+    test_autotuning_converges();
+    test_autotuning_table();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
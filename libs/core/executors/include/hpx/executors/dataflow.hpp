@@ -240,6 +240,14 @@ namespace hpx::lcos::detail {
         template <typename Futures_>
         void finalize(hpx::detail::async_policy policy, Futures_&& futures)
         {
+            // work-first: run the function directly on the thread that has
+            // made the last input ready
+            if (hpx::detail::has_work_first_policy(policy))
+            {
+                finalize(launch::sync, HPX_FORWARD(Futures_, futures));
+                return;
+            }
+
             detail::dataflow_finalization<dataflow_type> this_f_(this);
 
             hpx::execution::parallel_policy_executor<launch::async_policy> exec{
@@ -309,11 +317,16 @@ namespace hpx::lcos::detail {
             }
             else if (policy == launch::fork)
             {
-                finalize(launch::fork, HPX_FORWARD(Futures_, futures));
+                finalize(hpx::detail::fork_policy(policy.priority(),
+                             policy.stacksize(), policy.hint()),
+                    HPX_FORWARD(Futures_, futures));
             }
             else
             {
-                finalize(launch::async, HPX_FORWARD(Futures_, futures));
+                // keep the priority and schedule hint given by the caller
+                finalize(hpx::detail::async_policy(policy.priority(),
+                             policy.stacksize(), policy.hint()),
+                    HPX_FORWARD(Futures_, futures));
             }
         }
 
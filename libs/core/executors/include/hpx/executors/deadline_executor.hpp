@@ -0,0 +1,252 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/executors/deadline_executor.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/execution/executors/default_parameters.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/functional/deferred_call.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/packaged_task.hpp>
+#include <hpx/modules/concepts.hpp>
+#include <hpx/threading_base/detail/get_default_pool.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <chrono>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a deadline_executor creates execution agents which have to finish
+    /// by the given deadline. Schedulers supporting deadlines (see
+    /// --hpx:queuing=local-deadline) run those execution agents in the order
+    /// of their deadlines (earliest deadline first) before any other work.
+    /// All other schedulers ignore the deadline. Execution agents created by
+    /// an execution agent with a deadline inherit the deadline. An execution
+    /// agent with a deadline that waits for a future passes its deadline on to
+    /// the execution agent producing the value of the future (priority
+    /// inheritance).
+    ///
+    /// This executor conforms to the concepts of a TwoWayExecutor, and a
+    /// NonBlockingOneWayExecutor.
+    class deadline_executor
+    {
+    public:
+        /// Associate the parallel_execution_tag executor tag type as a default
+        /// with this executor.
+        using execution_category = parallel_execution_tag;
+
+        /// Associate the default_parameters executor parameters type as a
+        /// default with this executor.
+        using executor_parameters_type = default_parameters;
+
+        /// Create a new deadline executor
+        explicit deadline_executor(
+            hpx::chrono::steady_time_point const& deadline,
+            threads::thread_priority priority =
+                threads::thread_priority::default_,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize::default_,
+            threads::thread_schedule_hint schedulehint = {}) noexcept
+          : pool_(nullptr)
+          , deadline_(deadline.value())
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , schedulehint_(schedulehint)
+        {
+        }
+
+        explicit deadline_executor(threads::thread_pool_base* pool,
+            hpx::chrono::steady_time_point const& deadline,
+            threads::thread_priority priority =
+                threads::thread_priority::default_,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize::default_,
+            threads::thread_schedule_hint schedulehint = {}) noexcept
+          : pool_(pool)
+          , deadline_(deadline.value())
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , schedulehint_(schedulehint)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(deadline_executor const& rhs) const noexcept
+        {
+            return pool_ == rhs.pool_ && deadline_ == rhs.deadline_ &&
+                priority_ == rhs.priority_ && stacksize_ == rhs.stacksize_ &&
+                schedulehint_ == rhs.schedulehint_;
+        }
+
+        bool operator!=(deadline_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        [[nodiscard]] deadline_executor const& context() const noexcept
+        {
+            return *this;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+
+        // property implementations
+        friend deadline_executor tag_invoke(
+            hpx::execution::experimental::with_deadline_t,
+            deadline_executor const& exec,
+            hpx::chrono::steady_time_point const& deadline) noexcept
+        {
+            auto exec_with_deadline = exec;
+            exec_with_deadline.deadline_ = deadline.value();
+            return exec_with_deadline;
+        }
+
+        friend constexpr std::chrono::steady_clock::time_point tag_invoke(
+            hpx::execution::experimental::get_deadline_t,
+            deadline_executor const& exec) noexcept
+        {
+            return exec.deadline_;
+        }
+
+        friend deadline_executor tag_invoke(
+            hpx::execution::experimental::with_priority_t,
+            deadline_executor const& exec,
+            threads::thread_priority priority) noexcept
+        {
+            auto exec_with_priority = exec;
+            exec_with_priority.priority_ = priority;
+            return exec_with_priority;
+        }
+
+        friend constexpr threads::thread_priority tag_invoke(
+            hpx::execution::experimental::get_priority_t,
+            deadline_executor const& exec) noexcept
+        {
+            return exec.priority_;
+        }
+
+        friend deadline_executor tag_invoke(
+            hpx::execution::experimental::with_stacksize_t,
+            deadline_executor const& exec,
+            threads::thread_stacksize stacksize) noexcept
+        {
+            auto exec_with_stacksize = exec;
+            exec_with_stacksize.stacksize_ = stacksize;
+            return exec_with_stacksize;
+        }
+
+        friend constexpr threads::thread_stacksize tag_invoke(
+            hpx::execution::experimental::get_stacksize_t,
+            deadline_executor const& exec) noexcept
+        {
+            return exec.stacksize_;
+        }
+
+        friend deadline_executor tag_invoke(
+            hpx::execution::experimental::with_hint_t,
+            deadline_executor const& exec,
+            threads::thread_schedule_hint hint) noexcept
+        {
+            auto exec_with_hint = exec;
+            exec_with_hint.schedulehint_ = hint;
+            return exec_with_hint;
+        }
+
+        friend constexpr threads::thread_schedule_hint tag_invoke(
+            hpx::execution::experimental::get_hint_t,
+            deadline_executor const& exec) noexcept
+        {
+            return exec.schedulehint_;
+        }
+
+        // NonBlockingOneWayExecutor interface
+        template <typename F, typename... Ts>
+        void post_impl(F&& f, Ts&&... ts) const
+        {
+            hpx::threads::thread_description desc(f);
+
+            // run_as_child doesn't make sense if we _post_ a tasks
+            auto hint = schedulehint_;
+            hint.runs_as_child_mode(hpx::threads::thread_execution_hint::none);
+
+            threads::thread_init_data data(
+                threads::make_thread_function_nullary(hpx::util::deferred_call(
+                    HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...)),
+                desc, priority_, hint, stacksize_,
+                threads::thread_schedule_state::pending);
+            data.deadline = deadline_;
+
+            threads::register_work(data,
+                pool_ ? pool_ : threads::detail::get_self_or_default_pool());
+        }
+
+        template <typename F, typename... Ts>
+        friend void tag_invoke(hpx::parallel::execution::post_t,
+            deadline_executor const& exec, F&& f, Ts&&... ts)
+        {
+            exec.post_impl(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // TwoWayExecutor interface
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::async_execute_t,
+            deadline_executor const& exec, F&& f, Ts&&... ts)
+        {
+            using result_type =
+                hpx::util::detail::invoke_deferred_result_t<F, Ts...>;
+
+            hpx::packaged_task<result_type()> task(hpx::util::deferred_call(
+                HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...));
+            hpx::future<result_type> result = task.get_future();
+
+            exec.post_impl(HPX_MOVE(task));
+            return result;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        threads::thread_pool_base* pool_;
+        std::chrono::steady_clock::time_point deadline_;
+        threads::thread_priority priority_;
+        threads::thread_stacksize stacksize_;
+        threads::thread_schedule_hint schedulehint_;
+        /// \endcond
+    };
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_one_way_executor<deadline_executor> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_never_blocking_one_way_executor<deadline_executor>
+      : std::true_type
+    {
+    };
+
+    template <>
+    struct is_two_way_executor<deadline_executor> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace hpx::execution::experimental
@@ -226,6 +226,12 @@ namespace hpx::lcos::detail {
     HPX_CORE_EXPORT void handle_on_completed(
         future_data_refcnt_base::completed_callback_vector_type&& on_completed);
 
+    // Pass the deadline of the calling thread (if any) on to the given thread
+    // which produces the value the calling thread is about to wait for
+    // (priority inheritance).
+    HPX_CORE_EXPORT void inherit_deadline(
+        threads::thread_data* producer) noexcept;
+
     template <>
     struct HPX_CORE_EXPORT future_data_base<traits::detail::future_data_void>
       : future_data_refcnt_base
@@ -865,12 +871,14 @@ namespace hpx::lcos::detail {
         task_base()
           : base_type()
           , started_(false)
+          , runner_(nullptr)
         {
         }
 
         explicit task_base(init_no_addref no_addref) noexcept
           : base_type(no_addref)
           , started_(false)
+          , runner_(nullptr)
         {
         }
 
@@ -895,6 +903,7 @@ namespace hpx::lcos::detail {
 
             // attempt to directly execute thread
             this->execute_thread();
+            this->inherit_deadline();
             return this->base_type::get_result_void(ec);
         }
 
@@ -908,6 +917,7 @@ namespace hpx::lcos::detail {
 
             // attempt to directly execute thread
             this->execute_thread();
+            this->inherit_deadline();
             return this->base_type::wait(ec);
         }
 
@@ -922,6 +932,7 @@ namespace hpx::lcos::detail {
 
             // attempt to directly execute thread
             this->execute_thread();
+            this->inherit_deadline();
             return this->base_type::wait_until(abs_time, ec);
         }
 
@@ -951,6 +962,27 @@ namespace hpx::lcos::detail {
             }
         }
 
+        // pass the deadline of the calling thread on to the thread running
+        // this task, if the calling thread is about to block on the result
+        void inherit_deadline() noexcept
+        {
+            if (runner_.load(std::memory_order_relaxed) == nullptr ||
+                this->is_ready())
+            {
+                return;
+            }
+
+            // the runner sets the result while holding the lock, it is still
+            // alive as long as the result is not available
+            std::lock_guard<mutex_type> l(mtx_);
+            threads::thread_data* runner =
+                runner_.load(std::memory_order_relaxed);
+            if (runner != nullptr && !this->is_ready(std::memory_order_relaxed))
+            {
+                detail::inherit_deadline(runner);
+            }
+        }
+
     public:
         // run synchronously
         void run()
@@ -971,7 +1003,10 @@ namespace hpx::lcos::detail {
     protected:
         static void run_impl(future_base_type this_)
         {
+            this_->runner_.store(
+                threads::get_self_id_data(), std::memory_order_relaxed);
             this_->do_run();
+            this_->runner_.store(nullptr, std::memory_order_relaxed);
         }
 
     public:
@@ -993,6 +1028,9 @@ namespace hpx::lcos::detail {
 
     protected:
         std::atomic<bool> started_;
+
+        // the thread running this task
+        std::atomic<threads::thread_data*> runner_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1058,7 +1096,10 @@ namespace hpx::lcos::detail {
         static void run_impl(future_base_type this_)
         {
             reset_id r(*this_);
+            this_->runner_.store(
+                threads::get_self_id_data(), std::memory_order_relaxed);
             this_->do_run();
+            this_->runner_.store(nullptr, std::memory_order_relaxed);
         }
 
     public:
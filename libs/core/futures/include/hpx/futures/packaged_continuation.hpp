@@ -331,7 +331,11 @@ namespace hpx::lcos::detail {
                 [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
                     policy = HPX_FORWARD(Policy, policy),
                     spawner = HPX_FORWARD(Spawner, spawner)]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    // work-first continuations run directly on the thread
+                    // that made the future ready, the recursion depth is
+                    // limited by handle_on_completed
+                    if (hpx::detail::has_async_policy(policy) &&
+                        !hpx::detail::has_work_first_policy(policy))
                     {
                         this_->template async<Unwrap>(
                             HPX_MOVE(state), HPX_FORWARD(Spawner, spawner));
@@ -19,6 +19,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/memory.hpp>
+#include <hpx/threading_base/thread_data.hpp>
 
 #include <cstddef>
 #include <exception>
@@ -319,6 +320,18 @@ namespace hpx::lcos::detail {
         handle_on_completed_impl(HPX_MOVE(on_completed));
     }
 
+    void inherit_deadline(threads::thread_data* producer) noexcept
+    {
+        threads::thread_data const* self = threads::get_self_id_data();
+        if (self != nullptr && self != producer && self->has_deadline() &&
+            producer->inherit_deadline(self->get_deadline()))
+        {
+            LTM_(debug).format("inherit_deadline: thread({}) inherited the "
+                               "deadline of thread({})",
+                producer, self);
+        }
+    }
+
     // Set the callback which needs to be invoked when the future becomes ready.
     // If the future is ready the function will be invoked immediately.
     void future_data_base<traits::detail::future_data_void>::set_on_completed(
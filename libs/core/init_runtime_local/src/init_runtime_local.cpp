@@ -243,6 +243,11 @@ namespace hpx {
                 threads::coroutines::detail::posix::use_guard_pages =
                     cmdline.rtcfg_.use_stack_guard_pages();
 #endif
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+                threads::coroutines::detail::posix::stack_cache_size =
+                    cmdline.rtcfg_.get_stack_cache_size();
+#endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
                 {
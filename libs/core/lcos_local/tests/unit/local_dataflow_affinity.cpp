@@ -0,0 +1,182 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::threads::thread_execution_hint;
+using hpx::threads::thread_placement_hint;
+using hpx::threads::thread_schedule_hint;
+using hpx::threads::thread_schedule_hint_mode;
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::launch::async_policy make_policy(
+    thread_schedule_hint_mode mode, thread_execution_hint runs_as_child)
+{
+    return hpx::launch::async_policy(hpx::threads::thread_priority::default_,
+        hpx::threads::thread_stacksize::default_,
+        thread_schedule_hint(
+            mode, 0, thread_placement_hint::none, runs_as_child));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// hints referring to the calling worker thread are bound to it
+void test_resolve_local_hint()
+{
+    auto* scheduler = hpx::threads::get_self_id_data()->get_scheduler_base();
+
+    thread_schedule_hint hint(thread_schedule_hint_mode::local_thread, 0);
+    scheduler->resolve_local_schedule_hint(hint);
+    HPX_TEST(hint.mode == thread_schedule_hint_mode::thread);
+    HPX_TEST_EQ(static_cast<std::size_t>(hint.hint),
+        hpx::get_local_worker_thread_num());
+
+    thread_schedule_hint numa_hint(thread_schedule_hint_mode::local_numa, 0);
+    scheduler->resolve_local_schedule_hint(numa_hint);
+    HPX_TEST(numa_hint.mode == thread_schedule_hint_mode::numa);
+    HPX_TEST_EQ(static_cast<std::size_t>(numa_hint.hint),
+        scheduler->get_numa_domain(hpx::get_local_worker_thread_num()));
+
+    // other hints are left alone
+    thread_schedule_hint thread_hint(thread_schedule_hint_mode::thread, 1);
+    scheduler->resolve_local_schedule_hint(thread_hint);
+    HPX_TEST(thread_hint ==
+        thread_schedule_hint(thread_schedule_hint_mode::thread, 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// work-first continuations run on the thread that made their input ready
+void test_work_first_then()
+{
+    auto const policy = make_policy(thread_schedule_hint_mode::local_thread,
+        thread_execution_hint::run_as_child);
+
+    hpx::promise<int> p;
+    hpx::future<std::pair<int, hpx::threads::thread_id_type>> r =
+        p.get_future().then(policy, [](hpx::future<int>&& f) {
+            return std::make_pair(f.get(), hpx::threads::get_self_id());
+        });
+
+    hpx::threads::thread_id_type producer;
+    hpx::async([&] {
+        producer = hpx::threads::get_self_id();
+        p.set_value(42);
+    }).get();
+
+    auto const result = r.get();
+    HPX_TEST_EQ(result.first, 42);
+    HPX_TEST(result.second == producer);
+}
+
+void test_work_first_dataflow()
+{
+    auto const policy = make_policy(thread_schedule_hint_mode::local_thread,
+        thread_execution_hint::run_as_child);
+
+    hpx::promise<int> p;
+    hpx::future<std::pair<int, hpx::threads::thread_id_type>> r =
+        hpx::dataflow(
+            policy,
+            [](hpx::future<int>&& f1, hpx::future<int>&& f2) {
+                return std::make_pair(
+                    f1.get() + f2.get(), hpx::threads::get_self_id());
+            },
+            hpx::make_ready_future(1), p.get_future());
+
+    hpx::threads::thread_id_type producer;
+    hpx::async([&] {
+        producer = hpx::threads::get_self_id();
+        p.set_value(41);
+    }).get();
+
+    auto const result = r.get();
+    HPX_TEST_EQ(result.first, 42);
+    HPX_TEST(result.second == producer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a stencil-style dependency chain has to compute the same result for all
+// hint modes
+std::uint64_t stencil_chain(hpx::launch policy)
+{
+    constexpr std::size_t np = 16;
+    constexpr std::size_t nt = 100;
+
+    std::vector<hpx::shared_future<std::uint64_t>> current;
+    for (std::size_t i = 0; i != np; ++i)
+    {
+        current.push_back(hpx::make_ready_future(std::uint64_t(i)));
+    }
+
+    auto op = [](hpx::shared_future<std::uint64_t> const& l,
+                  hpx::shared_future<std::uint64_t> const& m,
+                  hpx::shared_future<std::uint64_t> const& r) {
+        return (l.get() + 2 * m.get() + r.get()) % 1000003;
+    };
+
+    for (std::size_t t = 0; t != nt; ++t)
+    {
+        std::vector<hpx::shared_future<std::uint64_t>> next;
+        for (std::size_t i = 0; i != np; ++i)
+        {
+            next.push_back(hpx::dataflow(policy, op,
+                current[(i + np - 1) % np], current[i],
+                current[(i + 1) % np]));
+        }
+        current = std::move(next);
+    }
+
+    std::uint64_t sum = 0;
+    for (auto& f : current)
+    {
+        sum += f.get();
+    }
+    return sum;
+}
+
+void test_stencil_chain()
+{
+    std::uint64_t const expected = stencil_chain(hpx::launch::async);
+
+    for (auto mode : {thread_schedule_hint_mode::local_thread,
+             thread_schedule_hint_mode::local_numa})
+    {
+        for (auto runs_as_child :
+            {thread_execution_hint::none, thread_execution_hint::run_as_child})
+        {
+            hpx::launch const policy(make_policy(mode, runs_as_child));
+            HPX_TEST_EQ(stencil_chain(policy), expected);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_resolve_local_hint();
+    test_work_first_then();
+    test_work_first_dataflow();
+    test_stencil_chain();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -83,6 +83,7 @@ namespace hpx::util {
         void const* lock, register_lock_data* data = nullptr) noexcept;
     HPX_CORE_EXPORT bool unregister_lock(void const* lock) noexcept;
     HPX_CORE_EXPORT void verify_no_locks();
+    HPX_CORE_EXPORT bool has_registered_locks() noexcept;
     HPX_CORE_EXPORT void force_error_on_lock();
     HPX_CORE_EXPORT void enable_lock_detection() noexcept;
     HPX_CORE_EXPORT void disable_lock_detection() noexcept;
@@ -255,6 +256,10 @@ namespace hpx::util {
         return true;
     }
     constexpr inline void verify_no_locks() noexcept {}
+    constexpr inline bool has_registered_locks() noexcept
+    {
+        return false;
+    }
     constexpr inline void force_error_on_lock() noexcept {}
     constexpr inline void enable_lock_detection() noexcept {}
     constexpr inline void disable_lock_detection() noexcept {}
@@ -314,6 +314,25 @@ namespace hpx::util {
         }
     }
 
+    // return whether this HPX-thread holds any registered (not ignored) locks
+    bool has_registered_locks() noexcept
+    {
+        using detail::register_locks;
+
+        if (!register_locks::lock_detection_enabled_)
+            return false;
+
+        try
+        {
+            return detail::some_locks_are_not_ignored(
+                register_locks::get_lock_map());
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
     void force_error_on_lock()
     {
         // For now just do the same as during suspension. We can't reliably
@@ -91,6 +91,10 @@ namespace hpx::util {
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Get the maximum time (in milliseconds) reference count requests are
+        // buffered before being sent
+        std::size_t get_agas_max_pending_refcnt_delay() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(
@@ -112,6 +116,12 @@ namespace hpx::util {
         bool use_stack_guard_pages() const;
 #endif
 
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+        // return the number of stacks cached per OS thread
+        std::size_t get_stack_cache_size() const;
+#endif
+
         // return trace_depth for stack-backtraces
         std::size_t trace_depth() const;
 
@@ -173,6 +173,7 @@ namespace hpx::util {
                 HPX_PP_EXPAND(HPX_IDLE_BACKOFF_TIME_MAX)) "}",
 #endif
             "default_scheduler_mode = ${HPX_DEFAULT_SCHEDULER_MODE}",
+            "time_slice = ${HPX_TIME_SLICE:0}",
 
         /// If HPX_HAVE_ATTACH_DEBUGGER_ON_TEST_FAILURE is set,
         /// then apply the test-failure value as default.
@@ -196,6 +197,22 @@ namespace hpx::util {
             "[hpx.on_startup]",
             "wait_on_latch = ${HPX_ON_STARTUP_WAIT_ON_LATCH}",
 
+            // admission control for new work (disabled by default)
+            "[hpx.admission]",
+            "limit = ${HPX_ADMISSION_LIMIT:0}",
+            "policy = ${HPX_ADMISSION_POLICY:suspend}",
+
+            // sampling profiler (enabled by --hpx:profile)
+            "[hpx.profile]",
+            "destination = ${HPX_PROFILE_DESTINATION}",
+            "frequency = ${HPX_PROFILE_FREQUENCY:997}",
+            "buffer_size = ${HPX_PROFILE_BUFFER_SIZE:1024}",
+
+            // task tracer (enabled by --hpx:trace)
+            "[hpx.trace]",
+            "destination = ${HPX_TRACE_DESTINATION}",
+            "buffer_size = ${HPX_TRACE_BUFFER_SIZE:65536}",
+
 #if defined(HPX_HAVE_NETWORKING)
             // by default, enable networking
             "[hpx.parcel]",
@@ -214,6 +231,7 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "cache_size = ${HPX_STACK_CACHE_SIZE:16}",
 #endif
 
             "[hpx.threadpools]",
@@ -304,6 +322,8 @@ namespace hpx::util {
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "max_pending_refcnt_delay = "
+            "${HPX_AGAS_MAX_PENDING_REFCNT_DELAY:10}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
@@ -920,6 +940,17 @@ namespace hpx::util {
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::size_t runtime_configuration::get_agas_max_pending_refcnt_delay()
+        const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "max_pending_refcnt_delay", 10);
+        }
+        return 10;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
@@ -1101,6 +1132,20 @@ namespace hpx::util {
     }
 #endif
 
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+    std::size_t runtime_configuration::get_stack_cache_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "cache_size", 16);
+        }
+        return 16;    // default is 16
+    }
+#endif
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
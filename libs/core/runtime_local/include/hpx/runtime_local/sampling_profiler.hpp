@@ -0,0 +1,65 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file sampling_profiler.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+/// In-process sampling profiler for HPX worker threads. Each registered
+/// worker OS thread is periodically interrupted (SIGPROF, based on the CPU
+/// time consumed by that thread). The signal handler records the description
+/// (annotation) of the HPX thread currently running on the worker together
+/// with a stack backtrace. The samples are aggregated by a background thread
+/// and can be written as 'folded stacks' (one line per unique stack, see
+/// https://github.com/brendangregg/FlameGraph), where the task description
+/// forms the root frame of each stack.
+///
+/// The profiler is enabled using the command line option --hpx:profile or
+/// the configuration setting hpx.profile.destination.
+namespace hpx::util::sampling_profiler {
+
+    /// Start the sampling profiler. Only OS threads registered after this
+    /// function was called will be sampled.
+    ///
+    /// \param frequency   The sampling frequency (in Hz, based on the CPU
+    ///                    time consumed by a thread).
+    /// \param buffer_size The number of samples each thread can record before
+    ///                    they are aggregated.
+    HPX_CORE_EXPORT void start(
+        std::size_t frequency, std::size_t buffer_size = 1024);
+
+    /// Stop the sampling profiler, all samples recorded so far are kept.
+    HPX_CORE_EXPORT void stop();
+
+    /// Return whether the sampling profiler is currently active
+    HPX_CORE_EXPORT bool is_active() noexcept;
+
+    /// Start sampling the calling OS thread (does nothing if the profiler is
+    /// not active).
+    HPX_CORE_EXPORT void register_thread();
+
+    /// Stop sampling the calling OS thread.
+    HPX_CORE_EXPORT void unregister_thread();
+
+    /// Return the number of samples recorded so far
+    HPX_CORE_EXPORT std::size_t get_sample_count();
+
+    /// Write all samples recorded so far to the given stream using the
+    /// folded stacks format.
+    HPX_CORE_EXPORT void write_folded_stacks(std::ostream& os);
+
+    /// Write all samples recorded so far to the given file using the folded
+    /// stacks format.
+    ///
+    /// \returns false if the file could not be written.
+    HPX_CORE_EXPORT bool write_folded_stacks(std::string const& filename);
+}    // namespace hpx::util::sampling_profiler
@@ -12,6 +12,8 @@
 #include <hpx/runtime_local/interval_timer.hpp>
 #include <hpx/runtime_local/shutdown_function.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
 
@@ -135,15 +137,12 @@ namespace hpx::util::detail {
         {
             is_started_ = false;
 
-            if (timerid_)
+            if (timer_)
             {
-                error_code ec(
-                    throwmode::lightweight);    // avoid throwing on error
-                threads::set_thread_state(timerid_.noref(),
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::abort,
-                    threads::thread_priority::boost, true, ec);
-                timerid_.reset();
+                // disarm the timer, this releases its reference to the
+                // scheduled thread right away
+                timer_->cancel();
+                timer_.reset();
             }
             if (id_)
             {
@@ -159,7 +158,7 @@ namespace hpx::util::detail {
         }
 
         HPX_ASSERT(id_ == nullptr);
-        HPX_ASSERT(timerid_ == nullptr);
+        HPX_ASSERT(timer_ == nullptr);
         return false;
     }
 
@@ -228,7 +227,7 @@ namespace hpx::util::detail {
             }
 
             id_.reset();
-            timerid_.reset();
+            timer_.reset();
             is_started_ = false;
 
             bool result;
@@ -294,29 +293,20 @@ namespace hpx::util::detail {
             return;
         }
 
-        // schedule this thread to be run after the given amount of seconds
-        threads::thread_id_ref_type const timerid = threads::set_thread_state(
-            id.noref(), std::chrono::microseconds(microsecs_),
+        // schedule this thread to be run after the given amount of seconds,
+        // the timer is kept here to be able to disarm it when the interval
+        // timer is stopped
+        auto timer = std::make_unique<threads::detail::timer_entry>(id,
             threads::thread_schedule_state::pending,
             threads::thread_restart_state::signaled,
-            threads::thread_priority::boost, true, ec);
-
-        if (ec)
-        {
-            is_terminated_ = true;
-            is_started_ = false;
-
-            // abort the newly created thread
-            threads::set_thread_state(id.noref(),
-                threads::thread_schedule_state::pending,
-                threads::thread_restart_state::abort,
-                threads::thread_priority::boost, true, ec);
-
-            return;
-        }
-
-        id_ = id;
-        timerid_ = timerid;
+            threads::thread_priority::boost, true);
+        threads::get_thread_id_data(id)->get_scheduler_base()->schedule_timer(
+            *timer,
+            std::chrono::steady_clock::now() +
+                std::chrono::microseconds(microsecs_));
+
+        id_ = HPX_MOVE(id);
+        timer_ = HPX_MOVE(timer);
         is_started_ = true;
     }
 }    // namespace hpx::util::detail
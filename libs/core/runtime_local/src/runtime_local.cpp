@@ -27,6 +27,7 @@
 #include <hpx/runtime_local/os_thread_type.hpp>
 #include <hpx/runtime_local/runtime_local.hpp>
 #include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/runtime_local/sampling_profiler.hpp>
 #include <hpx/runtime_local/shutdown_function.hpp>
 #include <hpx/runtime_local/startup_function.hpp>
 #include <hpx/runtime_local/state.hpp>
@@ -34,6 +35,7 @@
 #include <hpx/runtime_local/thread_mapper.hpp>
 #include <hpx/static_reinit/static_reinit.hpp>
 #include <hpx/thread_support/set_thread_name.hpp>
+#include <hpx/thread_pools/task_tracer.hpp>
 #include <hpx/threading_base/external_timer.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
@@ -485,6 +487,29 @@ namespace hpx {
             // this initializes the used_processing_units_ mask
             thread_manager_->init();
 
+            // start the sampling profiler before any of the worker threads
+            // is launched, if requested
+            if (!hpx::util::get_entry_as<std::string>(
+                    rtcfg_, "hpx.profile.destination", "")
+                     .empty())
+            {
+                util::sampling_profiler::start(
+                    hpx::util::get_entry_as<std::size_t>(
+                        rtcfg_, "hpx.profile.frequency", 997),
+                    hpx::util::get_entry_as<std::size_t>(
+                        rtcfg_, "hpx.profile.buffer_size", 1024));
+            }
+
+            // start recording the execution of HPX threads, if requested
+            if (!hpx::util::get_entry_as<std::string>(
+                    rtcfg_, "hpx.trace.destination", "")
+                     .empty())
+            {
+                threads::task_tracer::start(
+                    hpx::util::get_entry_as<std::size_t>(
+                        rtcfg_, "hpx.trace.buffer_size", 65536));
+            }
+
             // copy over all startup functions registered so far
             for (startup_function_type& f :
                 detail::global_pre_startup_functions())
@@ -537,6 +562,39 @@ namespace hpx {
 #ifdef HPX_HAVE_IO_POOL
         io_pool_->stop();
 #endif
+
+        // write the samples collected by the sampling profiler, if enabled
+        if (util::sampling_profiler::is_active())
+        {
+            util::sampling_profiler::stop();
+
+            std::string const destination =
+                hpx::util::get_entry_as<std::string>(
+                    rtcfg_, "hpx.profile.destination", "");
+            if (!util::sampling_profiler::write_folded_stacks(destination))
+            {
+                std::cerr << "hpx::runtime: could not write sampling profile "
+                             "to: "
+                          << destination << std::endl;
+            }
+        }
+
+        // write the events recorded by the task tracer, if enabled
+        if (threads::task_tracer::is_active())
+        {
+            threads::task_tracer::stop();
+
+            std::string const destination =
+                hpx::util::get_entry_as<std::string>(
+                    rtcfg_, "hpx.trace.destination", "");
+            if (!threads::task_tracer::write_chrome_trace(destination,
+                    hpx::util::get_entry_as<std::uint32_t>(
+                        rtcfg_, "hpx.locality", 0)))
+            {
+                std::cerr << "hpx::runtime: could not write task trace to: "
+                          << destination << std::endl;
+            }
+        }
         LRT_(debug).format("~runtime_local(finished)");
 
         LPROGRESS_;
@@ -1950,6 +2008,10 @@ namespace hpx {
             util::external_timer::register_thread(name);
 #endif
 
+        // sample all worker threads, if the sampling profiler is enabled
+        if (type == runtime_local::os_thread_type::worker_thread)
+            util::sampling_profiler::register_thread();
+
         // call thread-specific user-supplied on_start handler
         if (on_start_func_)
         {
@@ -2001,6 +2063,8 @@ namespace hpx {
             on_stop_func_(global_thread_num, global_thread_num, "", context);
         }
 
+        util::sampling_profiler::unregister_thread();
+
         // reset PAPI support
         thread_support_->unregister_thread();
 
@@ -0,0 +1,570 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/debugging/backtrace.hpp>
+#include <hpx/runtime_local/sampling_profiler.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#if defined(_POSIX_VERSION)
+#define HPX_HAVE_SAMPLING_PROFILER
+#include <dlfcn.h>
+#include <signal.h>
+#include <sys/time.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+#endif
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx::util::sampling_profiler {
+
+    namespace {
+
+        // maximal number of frames recorded per sample
+        constexpr std::size_t max_frames = 32;
+
+        // number of frames belonging to the signal handler itself (the
+        // handler and the signal trampoline)
+        constexpr std::size_t skipped_frames = 2;
+
+        constexpr char const* scheduler_description = "<hpx-scheduler>";
+        constexpr char const* unknown_description = "<unknown>";
+
+        struct sample
+        {
+            char const* description_;
+            std::size_t address_;
+            std::size_t num_frames_;
+            void* frames_[max_frames];
+        };
+
+        // Single producer (the signal handler running on the sampled thread),
+        // single consumer (the aggregating thread) ring buffer of samples.
+        struct thread_samples
+        {
+            explicit thread_samples(std::size_t size)
+              : samples_(size)
+            {
+            }
+
+            std::vector<sample> samples_;
+            std::atomic<std::size_t> head_ = 0;
+            std::atomic<std::size_t> tail_ = 0;
+            std::atomic<std::size_t> dropped_ = 0;
+#if defined(HPX_HAVE_SAMPLING_PROFILER) && defined(__linux__)
+            timer_t timer_{};
+            bool has_timer_ = false;
+#endif
+        };
+
+        // aggregated samples: description, address, and frames (leaf first)
+        using stack_type = std::vector<std::uintptr_t>;
+
+        struct profiler_data
+        {
+            std::mutex mtx_;
+            std::vector<std::unique_ptr<thread_samples>> threads_;
+            std::map<stack_type, std::size_t> stacks_;
+            std::size_t num_samples_ = 0;
+            std::size_t num_dropped_ = 0;
+
+            std::size_t frequency_ = 0;
+            std::size_t buffer_size_ = 0;
+            std::atomic<bool> active_ = false;
+
+            std::thread aggregator_;
+            std::condition_variable cond_;
+            bool stop_aggregator_ = false;
+
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+            struct sigaction prev_action_ = {};
+#endif
+
+            ~profiler_data()
+            {
+                if (aggregator_.joinable())
+                {
+                    {
+                        std::lock_guard<std::mutex> l(mtx_);
+                        stop_aggregator_ = true;
+                    }
+                    cond_.notify_all();
+                    aggregator_.join();
+                }
+            }
+        };
+
+        profiler_data& get_profiler_data()
+        {
+            static profiler_data data;
+            return data;
+        }
+
+        // samples of the current OS thread (nullptr if not registered)
+        thread_local thread_samples* current_samples = nullptr;
+
+        // move all pending samples of the given thread to the aggregated
+        // stacks, has to be called with the profiler lock held
+        void aggregate(profiler_data& d, thread_samples& s)
+        {
+            std::size_t const tail = s.tail_.load(std::memory_order_relaxed);
+            std::size_t const head = s.head_.load(std::memory_order_acquire);
+
+            std::size_t const size = s.samples_.size();
+            for (std::size_t i = tail; i != head; ++i)
+            {
+                sample const& smp = s.samples_[i % size];
+
+                stack_type stack;
+                stack.reserve(smp.num_frames_ + 2);
+                stack.push_back(
+                    reinterpret_cast<std::uintptr_t>(smp.description_));
+                stack.push_back(smp.address_);
+                for (std::size_t f = 0; f != smp.num_frames_; ++f)
+                {
+                    stack.push_back(
+                        reinterpret_cast<std::uintptr_t>(smp.frames_[f]));
+                }
+                ++d.stacks_[HPX_MOVE(stack)];
+            }
+
+            s.tail_.store(head, std::memory_order_release);
+
+            d.num_samples_ += head - tail;
+            d.num_dropped_ +=
+                s.dropped_.exchange(0, std::memory_order_relaxed);
+        }
+
+        void aggregate_all(profiler_data& d)
+        {
+            for (auto const& s : d.threads_)
+            {
+                aggregate(d, *s);
+            }
+        }
+
+        void run_aggregator()
+        {
+            profiler_data& d = get_profiler_data();
+
+            std::unique_lock<std::mutex> l(d.mtx_);
+            while (!d.stop_aggregator_)
+            {
+                d.cond_.wait_for(l, std::chrono::milliseconds(100));
+                aggregate_all(d);
+            }
+        }
+
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+        // This is executed inside the signal handler, only async-signal-safe
+        // operations are allowed. Allocations are avoided by using the
+        // pre-allocated ring buffer of the interrupted thread.
+        void on_sigprof(int, siginfo_t*, void*) noexcept
+        {
+            thread_samples* const s = current_samples;
+            if (s == nullptr)
+                return;
+
+            int const saved_errno = errno;
+
+            std::size_t const head = s->head_.load(std::memory_order_relaxed);
+            if (head - s->tail_.load(std::memory_order_acquire) ==
+                s->samples_.size())
+            {
+                // the aggregator did not keep up
+                s->dropped_.fetch_add(1, std::memory_order_relaxed);
+                errno = saved_errno;
+                return;
+            }
+
+            sample& smp = s->samples_[head % s->samples_.size()];
+            smp.description_ = scheduler_description;
+            smp.address_ = 0;
+            smp.num_frames_ = 0;
+
+            if (threads::thread_data const* thrd =
+                    threads::get_self_id_data();
+                thrd != nullptr)
+            {
+                threads::thread_description desc;
+                smp.description_ = unknown_description;
+                if (thrd->try_get_description(desc) && desc)
+                {
+                    if (desc.kind() ==
+                        threads::thread_description::data_type_description)
+                    {
+                        smp.description_ = desc.get_description();
+                    }
+                    else
+                    {
+                        smp.description_ = nullptr;
+                        smp.address_ = desc.get_address();
+                    }
+                }
+            }
+
+#if defined(HPX_HAVE_STACKTRACES)
+            smp.num_frames_ =
+                util::stack_trace::trace(smp.frames_, max_frames);
+#endif
+
+            s->head_.store(head + 1, std::memory_order_release);
+
+            errno = saved_errno;
+        }
+
+        std::string get_symbol_name(void* address)
+        {
+            Dl_info info = {nullptr, nullptr, nullptr, nullptr};
+            if (dladdr(address, &info) != 0 && info.dli_sname != nullptr)
+            {
+#if defined(__GNUC__)
+                int status = 0;
+                char* demangled = abi::__cxa_demangle(
+                    info.dli_sname, nullptr, nullptr, &status);
+                if (demangled != nullptr)
+                {
+                    std::string result(demangled);
+                    std::free(demangled);
+                    return result;
+                }
+#endif
+                return info.dli_sname;
+            }
+
+            std::ostringstream strm;
+            strm << address;
+            if (info.dli_fname != nullptr)
+            {
+                strm << " [" << info.dli_fname << "]";
+            }
+            return strm.str();
+        }
+#else
+        std::string get_symbol_name(void* address)
+        {
+            std::ostringstream strm;
+            strm << address;
+            return strm.str();
+        }
+#endif
+
+        // the folded stacks format uses ';' as a frame separator and the last
+        // space as the separator of the sample count
+        std::string sanitize(std::string name)
+        {
+            for (char& c : name)
+            {
+                if (c == ';' || c == '\n' || c == '\r')
+                    c = '_';
+            }
+            return name;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void start(std::size_t frequency, std::size_t buffer_size)
+    {
+        profiler_data& d = get_profiler_data();
+
+        std::lock_guard<std::mutex> l(d.mtx_);
+        if (d.active_.load(std::memory_order_relaxed))
+            return;
+
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+        d.frequency_ = frequency != 0 ? frequency : 1;
+        d.buffer_size_ = buffer_size != 0 ? buffer_size : 1;
+
+        struct sigaction action = {};
+        action.sa_sigaction = &on_sigprof;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(SIGPROF, &action, &d.prev_action_) != 0)
+        {
+            std::cerr << "hpx::util::sampling_profiler::start: could not "
+                         "install signal handler for SIGPROF, profiling is "
+                         "disabled\n";
+            return;
+        }
+
+#if !defined(__linux__)
+        // there is no way to deliver the signal to a particular thread, use a
+        // process-wide timer instead (the signal will be delivered to one of
+        // the threads consuming CPU time)
+        itimerval timer{};
+        timer.it_interval.tv_sec = 0;
+        timer.it_interval.tv_usec =
+            static_cast<suseconds_t>((std::max)(1000000 / d.frequency_,
+                static_cast<std::size_t>(1)));
+        timer.it_value = timer.it_interval;
+        setitimer(ITIMER_PROF, &timer, nullptr);
+#endif
+
+        d.stop_aggregator_ = false;
+        d.aggregator_ = std::thread(&run_aggregator);
+
+        d.active_.store(true, std::memory_order_release);
+#else
+        HPX_UNUSED(frequency);
+        HPX_UNUSED(buffer_size);
+        std::cerr << "hpx::util::sampling_profiler::start: the sampling "
+                     "profiler is not supported on this platform\n";
+#endif
+    }
+
+    void stop()
+    {
+        profiler_data& d = get_profiler_data();
+
+        std::unique_lock<std::mutex> l(d.mtx_);
+        if (!d.active_.load(std::memory_order_relaxed))
+            return;
+
+        d.active_.store(false, std::memory_order_release);
+
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+#if defined(__linux__)
+        for (auto const& s : d.threads_)
+        {
+            if (s->has_timer_)
+            {
+                timer_delete(s->timer_);
+                s->has_timer_ = false;
+            }
+        }
+#else
+        itimerval timer{};
+        setitimer(ITIMER_PROF, &timer, nullptr);
+#endif
+        sigaction(SIGPROF, &d.prev_action_, nullptr);
+#endif
+
+        d.stop_aggregator_ = true;
+        d.cond_.notify_all();
+
+        std::thread aggregator = HPX_MOVE(d.aggregator_);
+        l.unlock();
+
+        if (aggregator.joinable())
+            aggregator.join();
+
+        l.lock();
+        aggregate_all(d);
+    }
+
+    bool is_active() noexcept
+    {
+        return get_profiler_data().active_.load(std::memory_order_acquire);
+    }
+
+    void register_thread()
+    {
+        profiler_data& d = get_profiler_data();
+        if (!d.active_.load(std::memory_order_acquire) ||
+            current_samples != nullptr)
+        {
+            return;
+        }
+
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+#if defined(HPX_HAVE_STACKTRACES)
+        // the first stack unwind may allocate memory, make sure this does not
+        // happen inside the signal handler
+        void* frames[max_frames];
+        [[maybe_unused]] std::size_t const num_frames =
+            util::stack_trace::trace(frames, max_frames);
+#endif
+
+        auto samples = std::make_unique<thread_samples>(d.buffer_size_);
+
+        std::lock_guard<std::mutex> l(d.mtx_);
+        current_samples = samples.get();
+
+#if defined(__linux__)
+        // sample based on the CPU time consumed by this thread only
+        sigevent sev{};
+        sev.sigev_notify = SIGEV_THREAD_ID;
+        sev.sigev_signo = SIGPROF;
+#if defined(sigev_notify_thread_id)
+        sev.sigev_notify_thread_id = static_cast<pid_t>(syscall(SYS_gettid));
+#else
+        sev._sigev_un._tid = static_cast<pid_t>(syscall(SYS_gettid));
+#endif
+        if (timer_create(CLOCK_THREAD_CPUTIME_ID, &sev, &samples->timer_) == 0)
+        {
+            std::uint64_t const period = 1000000000ull / d.frequency_;
+
+            itimerspec spec{};
+            spec.it_interval.tv_sec =
+                static_cast<time_t>(period / 1000000000ull);
+            spec.it_interval.tv_nsec =
+                static_cast<long>(period % 1000000000ull);
+            spec.it_value = spec.it_interval;
+
+            samples->has_timer_ =
+                timer_settime(samples->timer_, 0, &spec, nullptr) == 0;
+            if (!samples->has_timer_)
+            {
+                timer_delete(samples->timer_);
+            }
+        }
+#endif
+
+        d.threads_.push_back(HPX_MOVE(samples));
+#endif
+    }
+
+    void unregister_thread()
+    {
+        thread_samples* const s = current_samples;
+        if (s == nullptr)
+            return;
+
+        profiler_data& d = get_profiler_data();
+
+        std::lock_guard<std::mutex> l(d.mtx_);
+
+#if defined(HPX_HAVE_SAMPLING_PROFILER) && defined(__linux__)
+        if (s->has_timer_)
+        {
+            timer_delete(s->timer_);
+            s->has_timer_ = false;
+        }
+#endif
+
+        // no more samples will be recorded for this thread
+        current_samples = nullptr;
+        aggregate(d, *s);
+
+        for (auto it = d.threads_.begin(); it != d.threads_.end(); ++it)
+        {
+            if (it->get() == s)
+            {
+                d.threads_.erase(it);
+                break;
+            }
+        }
+    }
+
+    std::size_t get_sample_count()
+    {
+        profiler_data& d = get_profiler_data();
+
+        std::lock_guard<std::mutex> l(d.mtx_);
+        aggregate_all(d);
+        return d.num_samples_;
+    }
+
+    void write_folded_stacks(std::ostream& os)
+    {
+        profiler_data& d = get_profiler_data();
+
+        std::lock_guard<std::mutex> l(d.mtx_);
+        aggregate_all(d);
+
+        std::map<std::uintptr_t, std::string> symbols;
+        auto symbol = [&](std::uintptr_t address) -> std::string const& {
+            auto it = symbols.find(address);
+            if (it == symbols.end())
+            {
+                it = symbols
+                         .emplace(address,
+                             sanitize(get_symbol_name(
+                                 reinterpret_cast<void*>(address))))
+                         .first;
+            }
+            return it->second;
+        };
+
+        // fold identical stacks after symbolization
+        std::map<std::string, std::size_t> folded;
+        for (auto const& [stack, count] : d.stacks_)
+        {
+            HPX_ASSERT(stack.size() >= 2);
+
+            std::string line;
+            if (stack[0] != 0)
+            {
+                line = sanitize(reinterpret_cast<char const*>(stack[0]));
+            }
+            else
+            {
+                line = symbol(stack[1]);
+            }
+
+            // frames are recorded leaf first, the folded format expects the
+            // root first
+            std::size_t const first = 2 + skipped_frames;
+            for (std::size_t i = stack.size(); i > first; --i)
+            {
+                // all but the innermost frame hold return addresses, look up
+                // the calling instruction instead
+                std::uintptr_t address = stack[i - 1];
+                if (i - 1 != first && address != 0)
+                    --address;
+
+                line += ';';
+                line += symbol(address);
+            }
+
+            folded[HPX_MOVE(line)] += count;
+        }
+
+        for (auto const& [line, count] : folded)
+        {
+            os << line << ' ' << count << '\n';
+        }
+
+        if (d.num_dropped_ != 0)
+        {
+            std::cerr << "hpx::util::sampling_profiler: dropped "
+                      << d.num_dropped_
+                      << " samples (consider increasing "
+                         "hpx.profile.buffer_size)\n";
+        }
+    }
+
+    bool write_folded_stacks(std::string const& filename)
+    {
+        std::ofstream out(filename);
+        if (!out)
+            return false;
+
+        write_folded_stacks(out);
+        return static_cast<bool>(out);
+    }
+}    // namespace hpx::util::sampling_profiler
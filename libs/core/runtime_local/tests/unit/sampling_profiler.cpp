@@ -0,0 +1,79 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+std::string const destination = "sampling_profiler_test.folded";
+
+double busy_work()
+{
+    hpx::scoped_annotation annotate("sampling_profiler_busy_work");
+
+    // consume enough CPU time for a couple of samples to be taken
+    double result = 0.0;
+    hpx::chrono::high_resolution_timer const t;
+    while (t.elapsed() < 0.2)
+    {
+        for (int i = 0; i != 1000; ++i)
+        {
+            result += static_cast<double>(i) * 0.5;
+        }
+    }
+    return result;
+}
+
+int hpx_main()
+{
+    HPX_TEST(hpx::util::sampling_profiler::is_active());
+
+    std::vector<hpx::future<double>> futures;
+    for (std::size_t i = 0; i != hpx::get_num_worker_threads(); ++i)
+    {
+        futures.push_back(hpx::async(&busy_work));
+    }
+    hpx::wait_all(futures);
+
+#if defined(__linux__)
+    HPX_TEST_LT(
+        std::size_t(0), hpx::util::sampling_profiler::get_sample_count());
+
+    std::ostringstream strm;
+    hpx::util::sampling_profiler::write_folded_stacks(strm);
+    HPX_TEST(!strm.str().empty());
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    HPX_TEST_NEQ(
+        strm.str().find("sampling_profiler_busy_work"), std::string::npos);
+#endif
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.profile.destination=" + destination,
+        "hpx.profile.frequency=1000"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    // the profile is written when the runtime is destroyed
+    HPX_TEST(!hpx::util::sampling_profiler::is_active());
+    std::remove(destination.c_str());
+
+    return hpx::util::report_errors();
+}
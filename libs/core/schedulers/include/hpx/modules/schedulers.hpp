@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 
 #include <hpx/schedulers/background_scheduler.hpp>
+#include <hpx/schedulers/local_deadline_queue_scheduler.hpp>
 #include <hpx/schedulers/local_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/local_queue_scheduler.hpp>
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
@@ -0,0 +1,378 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/schedulers/local_priority_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::policies {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // A queue of threads ordered by their deadlines (earliest deadline
+        // first). Threads with equal deadlines are returned in the order they
+        // were added.
+        class deadline_queue
+        {
+            using mutex_type = hpx::util::detail::spinlock;
+
+            struct entry
+            {
+                std::chrono::steady_clock::rep deadline;
+                std::uint64_t sequence;
+                thread_id_ref_type thrd;
+            };
+
+            // std::push_heap/std::pop_heap maintain a max-heap, the entry
+            // with the earliest deadline has to compare greatest
+            struct later_deadline
+            {
+                bool operator()(
+                    entry const& lhs, entry const& rhs) const noexcept
+                {
+                    return lhs.deadline > rhs.deadline ||
+                        (lhs.deadline == rhs.deadline &&
+                            lhs.sequence > rhs.sequence);
+                }
+            };
+
+        public:
+            deadline_queue() = default;
+
+            void push(thread_id_ref_type thrd)
+            {
+                auto const deadline = get_thread_id_data(thrd)
+                                          ->get_deadline()
+                                          .time_since_epoch()
+                                          .count();
+
+                std::lock_guard<mutex_type> l(mtx_);
+                heap_.push_back(entry{deadline, sequence_++, HPX_MOVE(thrd)});
+                std::push_heap(heap_.begin(), heap_.end(), later_deadline{});
+                size_.store(heap_.size(), std::memory_order_release);
+            }
+
+            bool pop(thread_id_ref_type& thrd)
+            {
+                if (empty())
+                {
+                    return false;
+                }
+
+                std::lock_guard<mutex_type> l(mtx_);
+                if (heap_.empty())
+                {
+                    return false;
+                }
+
+                std::pop_heap(heap_.begin(), heap_.end(), later_deadline{});
+                thrd = HPX_MOVE(heap_.back().thrd);
+                heap_.pop_back();
+                size_.store(heap_.size(), std::memory_order_release);
+                return true;
+            }
+
+            [[nodiscard]] bool empty() const noexcept
+            {
+                return size_.load(std::memory_order_acquire) == 0;
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept
+            {
+                return size_.load(std::memory_order_acquire);
+            }
+
+        private:
+            mutable mutex_type mtx_;
+            std::vector<entry> heap_;
+            std::uint64_t sequence_ = 0;
+            std::atomic<std::size_t> size_ = 0;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_deadline_queue_scheduler extends the
+    /// local_priority_queue_scheduler by one additional queue per OS thread
+    /// holding all threads that were created with a deadline (see
+    /// thread_init_data::deadline). Those threads are executed in the order of
+    /// their deadlines (earliest deadline first) before any other work,
+    /// including work stolen from other OS threads. Threads without a
+    /// deadline are handled exactly as by the local_priority_queue_scheduler.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = lockfree_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_priority_queue_scheduler_terminated_queue>
+    class local_deadline_queue_scheduler
+      : public local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>
+    {
+        using base_type = local_priority_queue_scheduler<Mutex,
+            PendingQueuing, StagedQueuing, TerminatedQueuing>;
+
+    public:
+        using init_parameter_type = typename base_type::init_parameter_type;
+
+        explicit local_deadline_queue_scheduler(
+            init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , deadline_queues_(init.num_queues_)
+        {
+        }
+
+        static std::string_view get_scheduler_name()
+        {
+            return "local_deadline_queue_scheduler";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* id,
+            error_code& ec) override
+        {
+            if (data.deadline == no_deadline ||
+                data.initial_state != thread_schedule_state::pending)
+            {
+                base_type::create_thread(data, id, ec);
+                return;
+            }
+
+            // create the thread object right away without scheduling it, it
+            // will be put into the deadline queue instead
+            data.run_now = true;
+            data.initial_state = thread_schedule_state::pending_do_not_schedule;
+
+            thread_id_ref_type thrd;
+            base_type::create_thread(data, &thrd, ec);
+            if (ec)
+            {
+                return;
+            }
+
+            // the base class has bound the thread to the selected OS thread
+            HPX_ASSERT(
+                data.schedulehint.mode == thread_schedule_hint_mode::thread);
+            std::size_t const num_thread =
+                static_cast<std::size_t>(data.schedulehint.hint);
+
+            LTM_(debug)
+                .format("local_deadline_queue_scheduler::create_thread, "
+                        "deadline queue: pool({}), scheduler({}), "
+                        "worker_thread({}), thread({})",
+                    *this->get_parent_pool(), *this, num_thread, thrd)
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+                .format(", description({})", data.description)
+#endif
+                ;
+
+            if (id)
+            {
+                *id = thrd;
+            }
+            deadline_queues_[num_thread].data_.push(HPX_MOVE(thrd));
+        }
+
+        // Return the next thread to be executed, return false if none is
+        // available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing)
+        {
+            HPX_ASSERT(num_thread < this->num_queues_);
+
+            if (deadline_queues_[num_thread].data_.pop(thrd))
+            {
+                return true;
+            }
+
+            // threads with a deadline are stolen before any other work is
+            // looked at
+            if (running && enable_stealing)
+            {
+                for (std::size_t const idx :
+                    this->victim_threads_[num_thread].data_)
+                {
+                    HPX_ASSERT(idx != num_thread);
+                    if (deadline_queues_[idx].data_.pop(thrd))
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return base_type::get_next_thread(
+                num_thread, running, thrd, enable_stealing);
+        }
+
+        // Schedule the passed thread
+        void schedule_thread(threads::thread_id_ref_type thrd,
+            threads::thread_schedule_hint schedulehint,
+            bool allow_fallback = false,
+            thread_priority priority = thread_priority::default_) override
+        {
+            if (!get_thread_id_data(thrd)->has_deadline())
+            {
+                base_type::schedule_thread(
+                    HPX_MOVE(thrd), schedulehint, allow_fallback, priority);
+                return;
+            }
+
+            schedule_deadline_thread(
+                HPX_MOVE(thrd), schedulehint, allow_fallback);
+        }
+
+        void schedule_thread_last(threads::thread_id_ref_type thrd,
+            threads::thread_schedule_hint schedulehint,
+            bool allow_fallback = false,
+            thread_priority priority = thread_priority::default_) override
+        {
+            // threads with equal deadlines are executed in FIFO order anyways
+            if (!get_thread_id_data(thrd)->has_deadline())
+            {
+                base_type::schedule_thread_last(
+                    HPX_MOVE(thrd), schedulehint, allow_fallback, priority);
+                return;
+            }
+
+            schedule_deadline_thread(
+                HPX_MOVE(thrd), schedulehint, allow_fallback);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // This returns the current length of the queues (work items and new
+        // items)
+        std::int64_t get_queue_length(std::size_t num_thread) const override
+        {
+            std::int64_t count = base_type::get_queue_length(num_thread);
+            if (static_cast<std::size_t>(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < this->num_queues_);
+                return count +
+                    static_cast<std::int64_t>(
+                        deadline_queues_[num_thread].data_.size());
+            }
+
+            for (auto const& q : deadline_queues_)
+            {
+                count += static_cast<std::int64_t>(q.data_.size());
+            }
+            return count;
+        }
+
+        // Queries whether a given core is idle
+        bool is_core_idle(std::size_t num_thread) const override
+        {
+            if (num_thread < this->num_queues_ &&
+                !deadline_queues_[num_thread].data_.empty())
+            {
+                return false;
+            }
+            return base_type::is_core_idle(num_thread);
+        }
+
+        // This is a function which gets called periodically by the thread
+        // manager to allow for maintenance tasks to be executed in the
+        // scheduler. Returns true if the OS thread calling this function has to
+        // be terminated (i.e. no more work has to be done).
+        bool wait_or_add_new(std::size_t num_thread, bool running,
+            std::int64_t& idle_loop_count, bool enable_stealing,
+            std::size_t& added, thread_id_ref_type* next_thrd = nullptr)
+        {
+            bool const result = base_type::wait_or_add_new(num_thread, running,
+                idle_loop_count, enable_stealing, added, next_thrd);
+            if (0 != added)
+            {
+                return result;
+            }
+
+            // don't let the OS thread exit as long as there are threads with
+            // a deadline waiting to be executed
+            if (!deadline_queues_[num_thread].data_.empty())
+            {
+                return false;
+            }
+
+            if (running && enable_stealing)
+            {
+                for (std::size_t const idx :
+                    this->victim_threads_[num_thread].data_)
+                {
+                    if (!deadline_queues_[idx].data_.empty())
+                    {
+                        return false;
+                    }
+                }
+            }
+            return result;
+        }
+
+    private:
+        void schedule_deadline_thread(threads::thread_id_ref_type thrd,
+            threads::thread_schedule_hint schedulehint, bool allow_fallback)
+        {
+            // NOTE: This scheduler ignores NUMA hints.
+            auto num_thread = static_cast<std::size_t>(-1);
+            if (schedulehint.mode == thread_schedule_hint_mode::thread)
+            {
+                num_thread = schedulehint.hint;
+            }
+            else
+            {
+                allow_fallback = false;
+            }
+
+            if (static_cast<std::size_t>(-1) == num_thread)
+            {
+                num_thread = this->curr_queue_++ % this->num_queues_;
+            }
+            else if (num_thread >= this->num_queues_)
+            {
+                num_thread %= this->num_queues_;
+            }
+
+            num_thread = this->select_active_pu(num_thread, allow_fallback);
+
+            [[maybe_unused]] auto const* thrdptr = get_thread_id_data(thrd);
+            LTM_(debug).format(
+                "local_deadline_queue_scheduler::schedule_thread, "
+                "deadline queue: pool({}), scheduler({}), worker_thread({}), "
+                "thread({}), description({})",
+                *this->get_parent_pool(), *this, num_thread,
+                thrdptr->get_thread_id(), thrdptr->get_description());
+
+            deadline_queues_[num_thread].data_.push(HPX_MOVE(thrd));
+        }
+
+        std::vector<util::cache_line_data<detail::deadline_queue>>
+            deadline_queues_;
+    };
+}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
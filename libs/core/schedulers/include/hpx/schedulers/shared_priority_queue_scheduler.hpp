@@ -274,6 +274,14 @@ namespace hpx::threads::policies {
                 ->cleanup_terminated(local_num, delete_all);
         }
 
+        // ------------------------------------------------------------
+        // the NUMA domains are the ones used for the thread queues
+        std::size_t get_numa_domain(
+            std::size_t num_thread) const noexcept override
+        {
+            return num_thread < num_workers_ ? d_lookup_[num_thread] : 0;
+        }
+
         // ------------------------------------------------------------
         bool cleanup_terminated(
             std::size_t /* thread_num */, bool delete_all) override
@@ -0,0 +1,176 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/executors/deadline_executor.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using hpx::execution::experimental::deadline_executor;
+
+using time_point = std::chrono::steady_clock::time_point;
+
+///////////////////////////////////////////////////////////////////////////////
+// a policy creating threads which are not run as children of the thread
+// waiting for them
+hpx::launch::async_policy make_policy()
+{
+    return hpx::launch::async_policy(hpx::threads::thread_priority::default_,
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_hint(
+            hpx::threads::thread_schedule_hint_mode::none, 0,
+            hpx::threads::thread_placement_hint::none,
+            hpx::threads::thread_execution_hint::none));
+}
+
+time_point get_self_deadline()
+{
+    return hpx::threads::get_self_id_data()->get_deadline();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// threads with a deadline run before all other threads, in the order of their
+// deadlines
+void test_earliest_deadline_first()
+{
+    std::vector<int> order;
+    std::vector<hpx::future<void>> futures;
+
+    for (int i = 0; i != 10; ++i)
+    {
+        futures.push_back(
+            hpx::async(make_policy(), [&order, i] { order.push_back(i); }));
+    }
+
+    time_point const now = std::chrono::steady_clock::now();
+    for (int i : {13, 11, 12, 10})
+    {
+        deadline_executor exec(now + std::chrono::seconds(i));
+        futures.push_back(
+            hpx::async(exec, [&order, i] { order.push_back(i); }));
+    }
+
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(order.size(), std::size_t(14));
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST_EQ(order[i], 10 + i);
+    }
+    for (int i = 4; i != 14; ++i)
+    {
+        HPX_TEST_EQ(order[i], i - 4);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// threads created by a thread with a deadline inherit its deadline
+void test_deadline_creation()
+{
+    time_point const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    deadline_executor exec(deadline);
+
+    HPX_TEST(hpx::execution::experimental::get_deadline(exec) == deadline);
+
+    auto f = hpx::async(exec, [] {
+        return std::make_pair(get_self_deadline(),
+            hpx::async(make_policy(), &get_self_deadline).get());
+    });
+
+    auto const result = f.get();
+    HPX_TEST(result.first == deadline);
+    HPX_TEST(result.second == deadline);
+
+    // threads created without a deadline don't have one
+    HPX_TEST(hpx::async(make_policy(), &get_self_deadline).get() ==
+        hpx::threads::no_deadline);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a thread waiting for the result of a thread with a later deadline passes
+// its deadline on to that thread
+void test_deadline_inheritance()
+{
+    bool started = false;
+    hpx::future<time_point> producer = hpx::async(make_policy(), [&started] {
+        started = true;
+        for (int i = 0;
+             i != 100000 && get_self_deadline() == hpx::threads::no_deadline;
+             ++i)
+        {
+            hpx::this_thread::yield();
+        }
+        return get_self_deadline();
+    });
+
+    while (!started)
+    {
+        hpx::this_thread::yield();
+    }
+
+    time_point const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    deadline_executor exec(deadline);
+
+    time_point const inherited =
+        hpx::async(exec, [&producer] { return producer.get(); }).get();
+    HPX_TEST(inherited == deadline);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_earliest_deadline_first();
+    test_deadline_creation();
+    test_deadline_inheritance();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using scheduler_type =
+        hpx::threads::policies::local_deadline_queue_scheduler<>;
+
+    // use a single thread to make the order of execution deterministic
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=1"};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            [](hpx::threads::thread_pool_init_parameters thread_pool_init,
+                hpx::threads::policies::thread_queue_init_parameters
+                    thread_queue_init)
+                -> std::unique_ptr<hpx::threads::thread_pool_base> {
+                scheduler_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, std::size_t(-1),
+                    thread_queue_init);
+                std::unique_ptr<scheduler_type> scheduler(
+                    new scheduler_type(init));
+
+                return std::make_unique<
+                    hpx::threads::detail::scheduled_thread_pool<
+                        scheduler_type>>(
+                    std::move(scheduler), thread_pool_init);
+            });
+    };
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
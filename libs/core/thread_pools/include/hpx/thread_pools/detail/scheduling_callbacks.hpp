@@ -27,21 +27,31 @@ namespace hpx::threads::detail {
             std::size_t max_background_threads =
                 (std::numeric_limits<std::size_t>::max)(),
             std::size_t max_idle_loop_count = HPX_IDLE_LOOP_COUNT_MAX,
-            std::size_t max_busy_loop_count = HPX_BUSY_LOOP_COUNT_MAX)
+            std::size_t max_busy_loop_count = HPX_BUSY_LOOP_COUNT_MAX,
+            std::uint64_t time_slice = 0)
           : outer_(HPX_MOVE(outer))
           , inner_(HPX_MOVE(inner))
           , background_(HPX_MOVE(background))
           , max_background_threads_(max_background_threads)
           , max_idle_loop_count_(max_idle_loop_count)
           , max_busy_loop_count_(max_busy_loop_count)
+          , time_slice_(time_slice)
         {
         }
 
         callback_type outer_;
         callback_type inner_;
         background_callback_type background_;
+
+        // invoked once per iteration of the scheduling loop to resume thread
+        // creators suspended by the admission control
+        callback_type admission_;
         std::size_t const max_background_threads_;
         std::int64_t const max_idle_loop_count_;
         std::int64_t const max_busy_loop_count_;
+
+        // length of the time slice granted to each HPX thread (in
+        // nanoseconds), zero disables time slicing
+        std::uint64_t const time_slice_;
     };
 }    // namespace hpx::threads::detail
@@ -21,8 +21,8 @@ namespace hpx::threads::detail {
         scheduling_counters(std::int64_t& executed_threads,
             std::int64_t& executed_thread_phases, std::int64_t& tfunc_time,
             std::int64_t& exec_time, std::int64_t& idle_loop_count,
-            std::int64_t& busy_loop_count, bool& is_active,
-            std::int64_t& background_work_duration,
+            std::int64_t& busy_loop_count, std::int64_t& forced_yields,
+            bool& is_active, std::int64_t& background_work_duration,
             std::int64_t& background_send_duration,
             std::int64_t& background_receive_duration) noexcept
           : executed_threads_(executed_threads)
@@ -31,6 +31,7 @@ namespace hpx::threads::detail {
           , exec_time_(exec_time)
           , idle_loop_count_(idle_loop_count)
           , busy_loop_count_(busy_loop_count)
+          , forced_yields_(forced_yields)
           , background_work_duration_(background_work_duration)
           , background_send_duration_(background_send_duration)
           , background_receive_duration_(background_receive_duration)
@@ -44,6 +45,7 @@ namespace hpx::threads::detail {
         std::int64_t& exec_time_;
         std::int64_t& idle_loop_count_;
         std::int64_t& busy_loop_count_;
+        std::int64_t& forced_yields_;
         std::int64_t& background_work_duration_;
         std::int64_t& background_send_duration_;
         std::int64_t& background_receive_duration_;
@@ -55,13 +57,15 @@ namespace hpx::threads::detail {
         scheduling_counters(std::int64_t& executed_threads,
             std::int64_t& executed_thread_phases, std::int64_t& tfunc_time,
             std::int64_t& exec_time, std::int64_t& idle_loop_count,
-            std::int64_t& busy_loop_count, bool& is_active) noexcept
+            std::int64_t& busy_loop_count, std::int64_t& forced_yields,
+            bool& is_active) noexcept
           : executed_threads_(executed_threads)
           , executed_thread_phases_(executed_thread_phases)
           , tfunc_time_(tfunc_time)
           , exec_time_(exec_time)
           , idle_loop_count_(idle_loop_count)
           , busy_loop_count_(busy_loop_count)
+          , forced_yields_(forced_yields)
           , is_active_(is_active)
         {
         }
@@ -72,6 +76,7 @@ namespace hpx::threads::detail {
         std::int64_t& exec_time_;
         std::int64_t& idle_loop_count_;
         std::int64_t& busy_loop_count_;
+        std::int64_t& forced_yields_;
         bool& is_active_;
     };
 #endif    // HPX_HAVE_BACKGROUND_THREAD_COUNTERS
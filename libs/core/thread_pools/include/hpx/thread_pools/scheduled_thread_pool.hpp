@@ -18,6 +18,7 @@
 #include <hpx/threading_base/network_background_callback.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/thread_support/spinlock.hpp>
 #include <hpx/topology/cpu_mask.hpp>
 
 #include <atomic>
@@ -290,6 +291,10 @@ namespace hpx::threads::detail {
 
         std::int64_t get_idle_loop_count(std::size_t num, bool reset) override;
         std::int64_t get_busy_loop_count(std::size_t num, bool reset) override;
+        std::int64_t get_forced_yield_count(
+            std::size_t num, bool reset) override;
+        std::int64_t get_throttled_spawn_count(
+            std::size_t num, bool reset) override;
         std::int64_t get_scheduler_utilization() const override;
 
     protected:
@@ -298,6 +303,12 @@ namespace hpx::threads::detail {
         void resume_internal(bool blocking, error_code& ec);
         void suspend_internal(error_code& ec);
 
+        // admission control
+        bool must_throttle(thread_init_data const& data) const noexcept;
+        bool throttle(
+            thread_init_data& data, bool may_run_inline, error_code& ec);
+        void resume_throttled();
+
         void remove_processing_unit_internal(
             std::size_t virt_core, error_code& = hpx::throws);
         void add_processing_unit_internal(std::size_t virt_core,
@@ -392,6 +403,16 @@ namespace hpx::threads::detail {
             std::int64_t idle_loop_counts_;
             std::int64_t busy_loop_counts_;
 
+            // number of HPX threads which yielded because their time slice
+            // expired
+            std::int64_t forced_yields_;
+            std::int64_t reset_forced_yields_;
+
+            // number of HPX threads created by this worker thread whose
+            // creation was throttled by the admission control
+            std::int64_t throttled_spawns_;
+            std::int64_t reset_throttled_spawns_;
+
             // scheduler utilization data
             bool tasks_active_;
         };
@@ -407,6 +428,22 @@ namespace hpx::threads::detail {
         std::size_t max_idle_loop_count_;
         std::size_t max_busy_loop_count_;
         std::size_t shutdown_check_count_;
+        std::uint64_t time_slice_;
+
+        // admission control, an admission limit of zero disables it
+        std::size_t admission_limit_;
+        admission_policy admission_policy_;
+
+        // throttled thread creations on threads not belonging to this pool
+        std::atomic<std::int64_t> external_throttled_spawns_;
+        std::int64_t reset_external_throttled_spawns_;
+
+        // thread creators suspended by the admission control, those are not
+        // part of the queue length and are resumed by the scheduling loop
+        // once the queues have drained below the admission limit
+        hpx::util::detail::spinlock throttled_mtx_;
+        std::vector<thread_id_ref_type> throttled_;
+        std::atomic<std::size_t> num_throttled_;
     };
 }    // namespace hpx::threads::detail
 
@@ -14,6 +14,7 @@
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/detail/invoke.hpp>
 #include <hpx/functional/experimental/scope_exit.hpp>
+#include <hpx/futures/detail/execute_thread.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/schedulers.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
@@ -40,6 +41,7 @@
 #include <exception>
 #include <functional>
 #include <iosfwd>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -93,6 +95,12 @@ namespace hpx::threads::detail {
       , max_idle_loop_count_(init.max_idle_loop_count_)
       , max_busy_loop_count_(init.max_busy_loop_count_)
       , shutdown_check_count_(init.shutdown_check_count_)
+      , time_slice_(init.time_slice_)
+      , admission_limit_(init.admission_limit_)
+      , admission_policy_(init.admission_policy_)
+      , external_throttled_spawns_(0)
+      , reset_external_throttled_spawns_(0)
+      , num_throttled_(0)
     {
         sched_->set_parent_pool(this);
     }
@@ -111,6 +119,10 @@ namespace hpx::threads::detail {
             }
             threads_.clear();
         }
+
+        // timers still armed hold references to threads, those have to be
+        // released while the scheduler is still fully alive
+        sched_->Scheduler::clear_timers();
     }
 
     template <typename Scheduler>
@@ -265,6 +277,9 @@ namespace hpx::threads::detail {
                     }
                 }
                 threads_.clear();
+
+                // none of the remaining timers will fire anymore
+                sched_->Scheduler::clear_timers();
             }
         }
     }
@@ -514,6 +529,7 @@ namespace hpx::threads::detail {
                     counter_data.tfunc_times_, counter_data.exec_times_,
                     counter_data.idle_loop_counts_,
                     counter_data.busy_loop_counts_,
+                    counter_data.forced_yields_,
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
                     counter_data.tasks_active_,
@@ -529,7 +545,15 @@ namespace hpx::threads::detail {
                         &policies::scheduler_base::idle_callback, sched_.get(),
                         thread_num),
                     nullptr, nullptr, max_background_threads_,
-                    max_idle_loop_count_, max_busy_loop_count_);
+                    max_idle_loop_count_, max_busy_loop_count_,
+                    time_slice_ * 1000);    // microseconds to nanoseconds
+
+                if (admission_limit_ != 0 &&
+                    admission_policy_ != admission_policy::reject)
+                {
+                    callbacks.admission_ = util::deferred_call(    //-V107
+                        &scheduled_thread_pool::resume_throttled, this);
+                }
 
                 if (get_scheduler()->has_scheduler_mode(
                         policies::scheduler_mode::do_background_work) &&
@@ -626,6 +650,14 @@ namespace hpx::threads::detail {
                 hpx::threads::thread_execution_hint::none);
         }
 
+        // the caller needs the id of the new thread, thus it can't be run
+        // inline
+        if (admission_limit_ != 0 && must_throttle(data) &&
+            !throttle(data, false, ec))
+        {
+            return;
+        }
+
         detail::create_thread(sched_.get(), data, id, ec);    //-V601
 
         // update statistics
@@ -655,6 +687,12 @@ namespace hpx::threads::detail {
                 hpx::threads::thread_execution_hint::none);
         }
 
+        if (admission_limit_ != 0 && must_throttle(data) &&
+            !throttle(data, true, ec))
+        {
+            return invalid_thread_id;
+        }
+
         thread_id_ref_type id =
             detail::create_work(sched_.get(), data, ec);    //-V601
 
@@ -692,6 +730,186 @@ namespace hpx::threads::detail {
             nullptr, true, ec);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Admission control is applied to new work only, threads with elevated
+    // priorities (which are mostly created by the runtime itself) are always
+    // admitted.
+    template <typename Scheduler>
+    bool scheduled_thread_pool<Scheduler>::must_throttle(
+        thread_init_data const& data) const noexcept
+    {
+        return data.initial_state == thread_schedule_state::pending &&
+            (data.priority == thread_priority::default_ ||
+                data.priority == thread_priority::normal ||
+                data.priority == thread_priority::low) &&
+            sched_->Scheduler::get_queue_length(
+                static_cast<std::size_t>(-1)) >=
+            static_cast<std::int64_t>(admission_limit_);
+    }
+
+    // Returns whether the new thread has to be created, i.e. whether it was
+    // neither run inline nor rejected.
+    template <typename Scheduler>
+    bool scheduled_thread_pool<Scheduler>::throttle(
+        thread_init_data& data, bool may_run_inline, error_code& ec)
+    {
+        // account for the throttled thread creation
+        std::size_t const local_thread_num = detail::get_local_thread_num_tss();
+        if (detail::get_thread_pool_num_tss() == id_.index() &&
+            local_thread_num < counter_data_.size())
+        {
+            ++counter_data_[local_thread_num].throttled_spawns_;
+        }
+        else
+        {
+            ++external_throttled_spawns_;
+        }
+
+        // only stackful HPX threads can run the new work inline or can be
+        // suspended, all other threads create the new thread right away
+        threads::thread_data const* self = get_self_id_data();
+        bool const can_suspend = self != nullptr && !self->is_stackless();
+
+        switch (admission_policy_)
+        {
+        case admission_policy::run_inline:
+            if (can_suspend && may_run_inline &&
+                sched_->Scheduler::supports_direct_execution() &&
+                hpx::this_thread::has_sufficient_stack_space())
+            {
+                LTM_(debug).format("thread_pool<Scheduler>::throttle: {} "
+                                   "runs new work inline",
+                    id_.name());
+
+                // The new work is created as a child of the creating thread
+                // and is executed directly, the same way futures execute
+                // their child tasks. This way it runs in the context of its
+                // own thread (thread id, exit callbacks, lock verification).
+                data.schedulehint.runs_as_child_mode(
+                    hpx::threads::thread_execution_hint::run_as_child);
+
+                thread_id_ref_type id =
+                    detail::create_work(sched_.get(), data, ec);    //-V601
+                if (id)
+                {
+                    ++tasks_scheduled_;
+
+                    // the new thread is run by a worker thread if it was
+                    // picked up before it could be executed directly
+                    detail::execute_thread(HPX_MOVE(id));
+                }
+                return false;
+            }
+
+            // threads that can't be run inline have to wait for capacity
+            [[fallthrough]];
+
+        case admission_policy::suspend:
+            if (can_suspend)
+            {
+                LTM_(debug).format("thread_pool<Scheduler>::throttle: {} "
+                                   "suspends creating thread",
+                    id_.name());
+
+                // Suspended (as opposed to pending) threads are not counted
+                // in the queue length, otherwise throttled creators would keep
+                // the pool saturated. The scheduling loop resumes the waiting
+                // threads once the queues have drained (see
+                // resume_throttled).
+                thread_id_type const self_id = get_self_id();
+                do
+                {
+                    {
+                        std::lock_guard<hpx::util::detail::spinlock> l(
+                            throttled_mtx_);
+                        throttled_.emplace_back(self_id);
+                        ++num_throttled_;
+                    }
+
+                    // make sure to not leave a stale entry behind if the
+                    // thread was woken up by something else (interruption,
+                    // abort)
+                    auto on_exit = hpx::experimental::scope_exit([&] {
+                        std::lock_guard<hpx::util::detail::spinlock> l(
+                            throttled_mtx_);
+                        auto const it =
+                            std::find_if(throttled_.begin(), throttled_.end(),
+                                [&](thread_id_ref_type const& id) {
+                                    return id.noref() == self_id;
+                                });
+                        if (it != throttled_.end())
+                        {
+                            throttled_.erase(it);
+                            --num_throttled_;
+                        }
+                    });
+
+                    hpx::this_thread::suspend(thread_schedule_state::suspended,
+                        "thread_pool<Scheduler>::throttle");
+
+                } while (sched_->Scheduler::get_queue_length(
+                             static_cast<std::size_t>(-1)) >=
+                    static_cast<std::int64_t>(admission_limit_));
+            }
+            return true;
+
+        case admission_policy::reject:
+            HPX_THROWS_IF(ec, hpx::error::thread_resource_error,
+                "thread_pool<Scheduler>::throttle",
+                "thread pool {} has reached its admission limit of {} queued "
+                "threads, the new thread was rejected",
+                id_.name(), admission_limit_);
+            return false;
+        }
+
+        return true;
+    }
+
+    // Resumes as many of the suspended thread creators as the admission limit
+    // currently permits, this is called by the scheduling loop of every worker
+    // thread.
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::resume_throttled()
+    {
+        if (num_throttled_.load(std::memory_order_acquire) == 0)
+        {
+            return;
+        }
+
+        std::int64_t const queue_length =
+            sched_->Scheduler::get_queue_length(static_cast<std::size_t>(-1));
+        auto const admission_limit =
+            static_cast<std::int64_t>(admission_limit_);
+        if (queue_length >= admission_limit)
+        {
+            return;
+        }
+
+        std::vector<thread_id_ref_type> resumed;
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(throttled_mtx_);
+
+            auto const count = (std::min)(
+                static_cast<std::size_t>(admission_limit - queue_length),
+                throttled_.size());
+
+            resumed.assign(std::make_move_iterator(throttled_.begin()),
+                std::make_move_iterator(throttled_.begin() + count));
+            throttled_.erase(throttled_.begin(), throttled_.begin() + count);
+            num_throttled_ -= count;
+        }
+
+        // the creator might not have suspended yet, set_thread_state retries
+        // in this case
+        for (thread_id_ref_type const& id : resumed)
+        {
+            error_code ec(throwmode::lightweight);
+            threads::set_thread_state(id.noref(),
+                thread_schedule_state::pending, thread_restart_state::signaled,
+                thread_priority::default_, true, ec);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // performance counters
     template <typename InIter, typename OutIter, typename ProjSrc,
@@ -1836,6 +2054,90 @@ namespace hpx::threads::detail {
         return counter_data_[num].busy_loop_counts_;
     }
 
+    template <typename Scheduler>
+    std::int64_t scheduled_thread_pool<Scheduler>::get_forced_yield_count(
+        std::size_t num, bool reset)
+    {
+        std::int64_t forced_yields;
+        std::int64_t reset_forced_yields;
+
+        if (num != static_cast<std::size_t>(-1))
+        {
+            forced_yields = counter_data_[num].forced_yields_;
+            reset_forced_yields = counter_data_[num].reset_forced_yields_;
+
+            if (reset)
+                counter_data_[num].reset_forced_yields_ = forced_yields;
+        }
+        else
+        {
+            forced_yields = accumulate_projected(counter_data_.begin(),
+                counter_data_.end(), static_cast<std::int64_t>(0),
+                &scheduling_counter_data::forced_yields_);
+            reset_forced_yields = accumulate_projected(counter_data_.begin(),
+                counter_data_.end(), static_cast<std::int64_t>(0),
+                &scheduling_counter_data::reset_forced_yields_);
+
+            if (reset)
+            {
+                copy_projected(counter_data_.begin(), counter_data_.end(),
+                    counter_data_.begin(),
+                    &scheduling_counter_data::forced_yields_,
+                    &scheduling_counter_data::reset_forced_yields_);
+            }
+        }
+
+        HPX_ASSERT(forced_yields >= reset_forced_yields);
+
+        return forced_yields - reset_forced_yields;
+    }
+
+    template <typename Scheduler>
+    std::int64_t scheduled_thread_pool<Scheduler>::get_throttled_spawn_count(
+        std::size_t num, bool reset)
+    {
+        std::int64_t throttled_spawns;
+        std::int64_t reset_throttled_spawns;
+
+        if (num != static_cast<std::size_t>(-1))
+        {
+            throttled_spawns = counter_data_[num].throttled_spawns_;
+            reset_throttled_spawns = counter_data_[num].reset_throttled_spawns_;
+
+            if (reset)
+                counter_data_[num].reset_throttled_spawns_ = throttled_spawns;
+        }
+        else
+        {
+            std::int64_t const external_throttled_spawns =
+                external_throttled_spawns_.load(std::memory_order_relaxed);
+
+            throttled_spawns = accumulate_projected(counter_data_.begin(),
+                                   counter_data_.end(),
+                                   static_cast<std::int64_t>(0),
+                                   &scheduling_counter_data::throttled_spawns_) +
+                external_throttled_spawns;
+            reset_throttled_spawns =
+                accumulate_projected(counter_data_.begin(), counter_data_.end(),
+                    static_cast<std::int64_t>(0),
+                    &scheduling_counter_data::reset_throttled_spawns_) +
+                reset_external_throttled_spawns_;
+
+            if (reset)
+            {
+                copy_projected(counter_data_.begin(), counter_data_.end(),
+                    counter_data_.begin(),
+                    &scheduling_counter_data::throttled_spawns_,
+                    &scheduling_counter_data::reset_throttled_spawns_);
+                reset_external_throttled_spawns_ = external_throttled_spawns;
+            }
+        }
+
+        HPX_ASSERT(throttled_spawns >= reset_throttled_spawns);
+
+        return throttled_spawns - reset_throttled_spawns;
+    }
+
     template <typename Scheduler>
     std::int64_t scheduled_thread_pool<Scheduler>::get_scheduler_utilization()
         const
@@ -15,7 +15,9 @@
 #include <hpx/thread_pools/detail/scheduling_callbacks.hpp>
 #include <hpx/thread_pools/detail/scheduling_counters.hpp>
 #include <hpx/thread_pools/detail/scheduling_log.hpp>
+#include <hpx/thread_pools/task_tracer.hpp>
 #include <hpx/threading_base/detail/switch_status.hpp>
+#include <hpx/threading_base/detail/time_slice.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -166,6 +168,7 @@ namespace hpx::threads::detail {
                     idle_loop_count > params.max_idle_loop_count_ / 2;
             }
 
+            bool idle = false;
             if (HPX_LIKELY(thrd ||
                     scheduler.get_next_thread(
                         num_thread, running, thrd, enable_stealing)))
@@ -239,6 +242,19 @@ namespace hpx::threads::detail {
                                             idle_rate.collect_exec_time(ts);
                                         });
 #endif
+                                // grant the thread a new time slice, threads
+                                // exceeding it yield at their next safe point
+                                if (params.time_slice_ != 0)
+                                {
+                                    start_time_slice(params.time_slice_);
+                                }
+
+                                if (HPX_UNLIKELY(task_tracer::is_active()))
+                                {
+                                    task_tracer::detail::on_run(
+                                        num_thread, thrdptr);
+                                }
+
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are
                                 // resuming the thread and have to restore any
@@ -267,6 +283,17 @@ namespace hpx::threads::detail {
 #else
                                 thrd_stat = (*thrdptr)(context_storage);
 #endif
+                                if (HPX_UNLIKELY(task_tracer::is_active()))
+                                {
+                                    task_tracer::detail::on_return(
+                                        thrdptr, thrd_stat.get_previous());
+                                }
+
+                                if (params.time_slice_ != 0 &&
+                                    test_and_reset_forced_yield())
+                                {
+                                    ++counters.forced_yields_;
+                                }
                             }
 
                             detail::write_state_log(scheduler, num_thread, thrd,
@@ -405,6 +432,11 @@ namespace hpx::threads::detail {
                     ++counters.executed_threads_;
 #endif
                     HPX_ASSERT(!thrdptr->runs_as_child());
+
+                    // the stack of the terminated thread is handed to the
+                    // next thread run for the first time on this worker
+                    // thread, regardless of who drops the last reference
+                    thrdptr->unbind_stack();
                     thrd = thread_id_type();
                 }
             }
@@ -413,6 +445,7 @@ namespace hpx::threads::detail {
             else
             {
                 ++idle_loop_count;
+                idle = true;
 
                 next_thrd = thread_id_ref_type();
                 if (scheduler.wait_or_add_new(num_thread, running,
@@ -523,6 +556,20 @@ namespace hpx::threads::detail {
                 idle_loop_count = 0;
             }
 
+            // resume the threads whose timed suspension has expired, idle
+            // worker threads fire the expired timers of all workers
+            if (scheduler.poll_timers(num_thread, idle))
+            {
+                idle_loop_count = 0;
+            }
+
+            // let thread creators proceed which were throttled by the
+            // admission control
+            if (!params.admission_.empty())
+            {
+                params.admission_();
+            }
+
             // something went badly wrong, give up
             if (HPX_UNLIKELY(this_state.load(std::memory_order_relaxed) ==
                     hpx::state::terminating))
@@ -0,0 +1,93 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_tracer.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+/// Low-overhead tracer recording the execution of HPX threads. While active,
+/// every worker thread records an event whenever an HPX thread starts running,
+/// is resumed, suspends, yields, terminates, or has been stolen from another
+/// worker thread. The events are stored in a ring buffer per worker thread
+/// (older events are overwritten) and can be written as a Chrome trace (JSON
+/// trace event format), which can be inspected using chrome://tracing or the
+/// Perfetto UI (https://ui.perfetto.dev).
+///
+/// The tracer is enabled using the command line option --hpx:trace or the
+/// configuration setting hpx.trace.destination.
+namespace hpx::threads::task_tracer {
+
+    enum class event_type : std::uint8_t
+    {
+        begin = 0,      ///< an HPX thread is run for the first time
+        resume = 1,     ///< a suspended HPX thread is resumed
+        suspend = 2,    ///< an HPX thread has been suspended
+        yield = 3,      ///< an HPX thread yielded and is pending again
+        end = 4,        ///< an HPX thread has terminated
+        steal = 5       ///< an HPX thread is resumed on another worker
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        HPX_CORE_EXPORT extern std::atomic<bool> tracing_enabled;
+
+        // called by the scheduling loop before an HPX thread is executed
+        HPX_CORE_EXPORT void on_run(
+            std::size_t num_thread, thread_data const* thrd);
+
+        // called by the scheduling loop after an HPX thread has returned
+        HPX_CORE_EXPORT void on_return(
+            thread_data const* thrd, thread_schedule_state state);
+    }    // namespace detail
+    /// \endcond
+
+    /// Return whether the task tracer is currently recording events
+    HPX_FORCEINLINE bool is_active() noexcept
+    {
+        return detail::tracing_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Start recording events.
+    ///
+    /// \param buffer_size The number of events each worker thread keeps, older
+    ///                    events are overwritten.
+    HPX_CORE_EXPORT void start(std::size_t buffer_size = 65536);
+
+    /// Stop recording events, all events recorded so far are kept.
+    HPX_CORE_EXPORT void stop();
+
+    /// Discard all events recorded so far
+    HPX_CORE_EXPORT void reset();
+
+    /// Return the number of events currently stored
+    HPX_CORE_EXPORT std::size_t get_event_count();
+
+    /// Write all events recorded so far to the given stream using the Chrome
+    /// trace event format. This can be called while events are recorded.
+    ///
+    /// \param process_id The process id to use in the trace (usually the
+    ///                   locality id of the current process).
+    HPX_CORE_EXPORT void write_chrome_trace(
+        std::ostream& os, std::uint32_t process_id = 0);
+
+    /// Write all events recorded so far to the given file using the Chrome
+    /// trace event format.
+    ///
+    /// \returns false if the file could not be written.
+    HPX_CORE_EXPORT bool write_chrome_trace(
+        std::string const& filename, std::uint32_t process_id = 0);
+}    // namespace hpx::threads::task_tracer
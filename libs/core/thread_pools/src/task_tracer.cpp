@@ -0,0 +1,400 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/thread_pools/task_tracer.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace hpx::threads::task_tracer {
+
+    namespace detail {
+
+        std::atomic<bool> tracing_enabled(false);
+    }    // namespace detail
+
+    namespace {
+
+        struct event
+        {
+            std::uint64_t timestamp_;
+            std::uintptr_t thread_id_;
+            std::uintptr_t parent_id_;    // begin events only
+            char const* description_;     // nullptr if address_ is used
+            std::size_t address_;         // steal: the previous worker
+            event_type type_;
+        };
+
+        // events recorded by one worker thread, the lock is contended only
+        // while the events are written
+        struct worker_events
+        {
+            worker_events(std::size_t worker, std::size_t size)
+              : worker_(worker)
+              , events_(size)
+            {
+            }
+
+            std::size_t const worker_;
+            hpx::util::detail::spinlock mtx_;
+            std::vector<event> events_;
+            std::size_t count_ = 0;    // overall number of recorded events
+        };
+
+        struct tracer_data
+        {
+            std::mutex mtx_;
+            std::vector<std::unique_ptr<worker_events>> workers_;
+            std::size_t buffer_size_ = 65536;
+        };
+
+        tracer_data& get_tracer_data()
+        {
+            static tracer_data data;
+            return data;
+        }
+
+        thread_local worker_events* current_events = nullptr;
+
+        worker_events& get_worker_events()
+        {
+            if (HPX_LIKELY(current_events != nullptr))
+                return *current_events;
+
+            tracer_data& d = get_tracer_data();
+
+            std::lock_guard<std::mutex> l(d.mtx_);
+            d.workers_.push_back(std::make_unique<worker_events>(
+                hpx::get_worker_thread_num(), d.buffer_size_));
+
+            current_events = d.workers_.back().get();
+            return *current_events;
+        }
+
+        void record(event const& e)
+        {
+            worker_events& w = get_worker_events();
+
+            std::lock_guard<hpx::util::detail::spinlock> l(w.mtx_);
+            w.events_[w.count_++ % w.events_.size()] = e;
+        }
+
+        void set_description(event& e, thread_data const* thrd)
+        {
+            threads::thread_description const desc = thrd->get_description();
+            if (desc.kind() ==
+                threads::thread_description::data_type_description)
+            {
+                e.description_ = desc.get_description();
+                e.address_ = 0;
+            }
+            else
+            {
+                e.description_ = nullptr;
+                e.address_ = desc.get_address();
+            }
+        }
+
+        // return a snapshot of the events of the given worker (oldest first)
+        std::vector<event> get_events(worker_events& w)
+        {
+            std::vector<event> events;
+
+            std::lock_guard<hpx::util::detail::spinlock> l(w.mtx_);
+
+            std::size_t const size = w.events_.size();
+            std::size_t const first = w.count_ > size ? w.count_ - size : 0;
+
+            events.reserve(w.count_ - first);
+            for (std::size_t i = first; i != w.count_; ++i)
+            {
+                events.push_back(w.events_[i % size]);
+            }
+            return events;
+        }
+
+        void write_escaped(std::ostream& os, char const* str)
+        {
+            for (/**/; *str != '\0'; ++str)
+            {
+                char const c = *str;
+                if (c == '"' || c == '\\')
+                {
+                    os << '\\' << c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    os << ' ';
+                }
+                else
+                {
+                    os << c;
+                }
+            }
+        }
+
+        void write_timestamp(std::ostream& os, std::uint64_t ns)
+        {
+            // the trace event format expects microseconds
+            os << ns / 1000 << '.' << std::setw(3) << std::setfill('0')
+               << ns % 1000 << std::setfill(' ');
+        }
+
+        void write_name(std::ostream& os, event const& e)
+        {
+            if (e.description_ != nullptr)
+            {
+                write_escaped(os, e.description_);
+            }
+            else
+            {
+                os << "0x" << std::hex << e.address_ << std::dec;
+            }
+        }
+
+        char const* get_event_name(event_type type) noexcept
+        {
+            switch (type)
+            {
+            case event_type::begin:
+                return "begin";
+            case event_type::resume:
+                return "resume";
+            case event_type::suspend:
+                return "suspend";
+            case event_type::yield:
+                return "yield";
+            case event_type::end:
+                return "end";
+            case event_type::steal:
+                return "steal";
+            }
+            return "<unknown>";
+        }
+    }    // namespace
+
+    namespace detail {
+
+        void on_run(std::size_t num_thread, thread_data const* thrd)
+        {
+            event e{hpx::chrono::high_resolution_clock::now(),
+                reinterpret_cast<std::uintptr_t>(thrd), 0, nullptr, 0,
+                event_type::begin};
+
+            // the last worker is recorded whenever a thread is suspended
+            std::size_t const last_worker = thrd->get_last_worker_thread_num();
+            if (last_worker == static_cast<std::size_t>(-1))
+            {
+                e.parent_id_ = reinterpret_cast<std::uintptr_t>(
+                    thrd->get_parent_thread_id().get());
+            }
+            else
+            {
+                if (last_worker != num_thread)
+                {
+                    record(event{e.timestamp_, e.thread_id_, 0, nullptr,
+                        last_worker, event_type::steal});
+                }
+                e.type_ = event_type::resume;
+            }
+
+            set_description(e, thrd);
+            record(e);
+        }
+
+        void on_return(thread_data const* thrd, thread_schedule_state state)
+        {
+            event e{hpx::chrono::high_resolution_clock::now(),
+                reinterpret_cast<std::uintptr_t>(thrd), 0, nullptr, 0,
+                event_type::suspend};
+
+            switch (state)
+            {
+            case thread_schedule_state::terminated:
+            case thread_schedule_state::deleted:
+                e.type_ = event_type::end;
+                break;
+
+            case thread_schedule_state::pending:
+            case thread_schedule_state::pending_boost:
+            case thread_schedule_state::pending_do_not_schedule:
+                e.type_ = event_type::yield;
+                break;
+
+            default:
+                break;
+            }
+
+            record(e);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void start(std::size_t buffer_size)
+    {
+        tracer_data& d = get_tracer_data();
+        {
+            std::lock_guard<std::mutex> l(d.mtx_);
+
+            d.buffer_size_ = buffer_size != 0 ? buffer_size : 1;
+            for (auto const& w : d.workers_)
+            {
+                std::lock_guard<hpx::util::detail::spinlock> ll(w->mtx_);
+                if (w->events_.size() != d.buffer_size_)
+                {
+                    w->events_.clear();
+                    w->events_.resize(d.buffer_size_);
+                    w->count_ = 0;
+                }
+            }
+        }
+        detail::tracing_enabled.store(true, std::memory_order_release);
+    }
+
+    void stop()
+    {
+        detail::tracing_enabled.store(false, std::memory_order_release);
+    }
+
+    void reset()
+    {
+        tracer_data& d = get_tracer_data();
+
+        std::lock_guard<std::mutex> l(d.mtx_);
+        for (auto const& w : d.workers_)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> ll(w->mtx_);
+            w->count_ = 0;
+        }
+    }
+
+    std::size_t get_event_count()
+    {
+        tracer_data& d = get_tracer_data();
+
+        std::size_t count = 0;
+
+        std::lock_guard<std::mutex> l(d.mtx_);
+        for (auto const& w : d.workers_)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> ll(w->mtx_);
+            count += (std::min)(w->count_, w->events_.size());
+        }
+        return count;
+    }
+
+    void write_chrome_trace(std::ostream& os, std::uint32_t process_id)
+    {
+        tracer_data& d = get_tracer_data();
+
+        std::lock_guard<std::mutex> l(d.mtx_);
+
+        os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+        bool first = true;
+        auto separator = [&]() -> std::ostream& {
+            if (!first)
+                os << ",";
+            first = false;
+            return os << "\n";
+        };
+
+        for (auto const& w : d.workers_)
+        {
+            std::size_t const tid = w->worker_;
+
+            separator() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":"
+                        << process_id << ",\"tid\":" << tid
+                        << ",\"args\":{\"name\":\"worker-thread#" << tid
+                        << "\"}}";
+
+            // pair the events of each run of an HPX thread into one complete
+            // event, unmatched events (from the beginning of the ring buffer
+            // or for threads still running) are skipped
+            event const* running = nullptr;
+            std::vector<event> const events = get_events(*w);
+            for (event const& e : events)
+            {
+                switch (e.type_)
+                {
+                case event_type::begin:
+                case event_type::resume:
+                    running = &e;
+                    break;
+
+                case event_type::steal:
+                    separator()
+                        << "{\"name\":\"steal\",\"cat\":\"hpx\",\"ph\":\"i\","
+                           "\"s\":\"t\",\"ts\":";
+                    write_timestamp(os, e.timestamp_);
+                    os << ",\"pid\":" << process_id << ",\"tid\":" << tid
+                       << ",\"args\":{\"id\":\"0x" << std::hex << e.thread_id_
+                       << std::dec << "\",\"from\":" << e.address_ << "}}";
+                    break;
+
+                case event_type::suspend:
+                case event_type::yield:
+                case event_type::end:
+                {
+                    if (running == nullptr ||
+                        running->thread_id_ != e.thread_id_)
+                    {
+                        running = nullptr;
+                        break;
+                    }
+
+                    separator() << "{\"name\":\"";
+                    write_name(os, *running);
+                    os << "\",\"cat\":\"hpx\",\"ph\":\"X\",\"ts\":";
+                    write_timestamp(os, running->timestamp_);
+                    os << ",\"dur\":";
+                    write_timestamp(os, e.timestamp_ - running->timestamp_);
+                    os << ",\"pid\":" << process_id << ",\"tid\":" << tid
+                       << ",\"args\":{\"id\":\"0x" << std::hex << e.thread_id_;
+                    if (running->type_ == event_type::begin)
+                    {
+                        os << "\",\"parent\":\"0x" << running->parent_id_;
+                    }
+                    os << std::dec << "\",\"start\":\""
+                       << get_event_name(running->type_) << "\",\"stop\":\""
+                       << get_event_name(e.type_) << "\"}}";
+
+                    running = nullptr;
+                    break;
+                }
+                }
+            }
+        }
+
+        os << "\n]}\n";
+    }
+
+    bool write_chrome_trace(
+        std::string const& filename, std::uint32_t process_id)
+    {
+        std::ofstream out(filename);
+        if (!out)
+            return false;
+
+        write_chrome_trace(out, process_id);
+        return static_cast<bool>(out);
+    }
+}    // namespace hpx::threads::task_tracer
@@ -0,0 +1,75 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/thread_pools.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+void yielding_task()
+{
+    hpx::scoped_annotation annotate("task_tracer_yielding_task");
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::this_thread::yield();
+    }
+}
+
+int hpx_main()
+{
+    namespace tracer = hpx::threads::task_tracer;
+
+    HPX_TEST(!tracer::is_active());
+
+    tracer::start(1024);
+    HPX_TEST(tracer::is_active());
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != 16; ++i)
+    {
+        futures.push_back(hpx::async(&yielding_task));
+    }
+    hpx::wait_all(futures);
+
+    tracer::stop();
+    HPX_TEST(!tracer::is_active());
+
+    std::size_t const count = tracer::get_event_count();
+    HPX_TEST_LT(std::size_t(0), count);
+
+    // no events are recorded while the tracer is stopped
+    hpx::async(&yielding_task).get();
+    HPX_TEST_EQ(count, tracer::get_event_count());
+
+    std::ostringstream strm;
+    tracer::write_chrome_trace(strm, 0);
+
+    std::string const trace = strm.str();
+    HPX_TEST_NEQ(trace.find("\"traceEvents\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"ph\":\"X\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"stop\":\"yield\""), std::string::npos);
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    HPX_TEST_NEQ(trace.find("task_tracer_yielding_task"), std::string::npos);
+#endif
+
+    tracer::reset();
+    HPX_TEST_EQ(tracer::get_event_count(), std::size_t(0));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,130 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+constexpr std::size_t admission_limit = 4;
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_throttled_spawn_count()
+{
+    return hpx::this_thread::get_pool()->get_throttled_spawn_count(
+        static_cast<std::size_t>(-1), false);
+}
+
+std::int64_t get_queue_length()
+{
+    return hpx::this_thread::get_pool()->get_queue_length(
+        static_cast<std::size_t>(-1), false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// creating a burst of threads suspends the creating thread whenever the pool
+// has reached its admission limit, all threads are still executed
+void test_burst()
+{
+    std::int64_t const throttled_spawns = get_throttled_spawn_count();
+
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        futures.push_back(hpx::async([&count] { ++count; }));
+
+        // the creating thread is suspended while the pool is saturated
+        HPX_TEST_LTE(get_queue_length(),
+            static_cast<std::int64_t>(admission_limit + 1));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(count.load(), std::size_t(100));
+    HPX_TEST_LT(throttled_spawns, get_throttled_spawn_count());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// more producers than the admission limit allows for, each of them spawning
+// nested tasks, throttled creators must not keep the pool saturated
+void test_nested_producers()
+{
+    constexpr std::size_t num_producers = 4 * admission_limit;
+    constexpr std::size_t num_tasks = 10;
+    constexpr std::size_t num_children = 10;
+
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> producers;
+    for (std::size_t i = 0; i != num_producers; ++i)
+    {
+        producers.push_back(hpx::async([&count] {
+            std::vector<hpx::future<void>> tasks;
+            for (std::size_t j = 0; j != num_tasks; ++j)
+            {
+                tasks.push_back(hpx::async([&count] {
+                    std::vector<hpx::future<void>> children;
+                    for (std::size_t k = 0; k != num_children; ++k)
+                    {
+                        children.push_back(hpx::async([&count] { ++count; }));
+                    }
+                    hpx::wait_all(children);
+                }));
+            }
+            hpx::wait_all(tasks);
+        }));
+    }
+    hpx::wait_all(producers);
+
+    HPX_TEST_EQ(count.load(), num_producers * num_tasks * num_children);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// threads with elevated priorities are always admitted
+void test_high_priority()
+{
+    std::int64_t const throttled_spawns = get_throttled_spawn_count();
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != 2 * admission_limit; ++i)
+    {
+        futures.push_back(hpx::async(
+            hpx::launch::async_policy(hpx::threads::thread_priority::high),
+            [] {}));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(throttled_spawns, get_throttled_spawn_count());
+}
+
+int hpx_main()
+{
+    test_burst();
+    test_nested_producers();
+    test_high_priority();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // use a single worker thread which allows for at most four queued threads
+    std::vector<std::string> const cfg = {"hpx.os_threads=1",
+        "hpx.admission.limit=" + std::to_string(admission_limit),
+        "hpx.admission.policy=suspend"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
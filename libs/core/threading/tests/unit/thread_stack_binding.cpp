@@ -0,0 +1,166 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Threads bind their stack when they run for the first time and release it
+// to the stack cache of the worker thread when they terminate. This verifies
+// that stacks are released and reused, and that stacks handed from terminated
+// threads to new threads are not shared with threads which are still alive.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#define HPX_TEST_STACK_CACHE
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(HPX_TEST_STACK_CACHE)
+///////////////////////////////////////////////////////////////////////////////
+// a terminated thread releases its stack to the cache of the worker thread
+// right away, even if the thread is still referenced, the next thread run for
+// the first time on the same worker thread reuses that stack
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+void record_stack(std::uintptr_t* address, hpx::threads::thread_id_ref_type* id)
+{
+    char marker = 0;
+    *address = reinterpret_cast<std::uintptr_t>(&marker);
+    *id = hpx::threads::get_self_id();
+}
+
+void test_stack_release()
+{
+    std::int64_t const released = posix::get_stack_cache_release_count(false);
+
+    std::uintptr_t first = 0;
+    hpx::threads::thread_id_ref_type first_id;
+    hpx::thread(&record_stack, &first, &first_id).join();
+
+    // the first thread is still referenced here
+    HPX_TEST(first_id);
+    HPX_TEST_LT(released, posix::get_stack_cache_release_count(false));
+
+    std::int64_t const reused = posix::get_stack_cache_reuse_count(false);
+
+    std::uintptr_t second = 0;
+    hpx::threads::thread_id_ref_type second_id;
+    hpx::thread(&record_stack, &second, &second_id).join();
+
+    HPX_TEST_LT(reused, posix::get_stack_cache_reuse_count(false));
+    HPX_TEST_EQ(first, second);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// a thread which is suspended while other threads start and terminate keeps
+// its stack
+std::uint64_t suspending_task(std::uint64_t value)
+{
+    // fill some part of the stack with a known pattern
+    std::uint64_t data[256];
+    for (std::size_t i = 0; i != 256; ++i)
+    {
+        data[i] = value + i;
+    }
+
+    // let other threads run on this worker thread
+    std::vector<hpx::future<std::uint64_t>> futures;
+    for (std::uint64_t i = 0; i != 4; ++i)
+    {
+        futures.push_back(hpx::async([i] { return i; }));
+    }
+    hpx::this_thread::yield();
+
+    std::uint64_t sum = 0;
+    for (auto& f : futures)
+    {
+        sum += f.get();
+    }
+    HPX_TEST_EQ(sum, std::uint64_t(6));
+
+    // the stack content must not have been changed
+    std::uint64_t result = 0;
+    for (std::size_t i = 0; i != 256; ++i)
+    {
+        HPX_TEST_EQ(data[i], value + i);
+        result += data[i];
+    }
+    return result;
+}
+
+void test_suspending_threads()
+{
+    std::vector<hpx::future<std::uint64_t>> futures;
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        futures.push_back(hpx::async(&suspending_task, i * 1000));
+    }
+
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), 256 * i * 1000 + 255 * 128);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// threads with different stack sizes don't share stacks
+std::uint64_t recurse(std::uint64_t depth)
+{
+    volatile char buffer[1024] = {};
+    if (depth == 0)
+    {
+        return buffer[0];
+    }
+    return 1 + recurse(depth - 1) + buffer[depth % 1024];
+}
+
+void test_stack_sizes()
+{
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::future<std::uint64_t> small = hpx::async(&recurse, 10);
+        hpx::future<std::uint64_t> large = hpx::async(
+            hpx::launch::async_policy(hpx::threads::thread_priority::default_,
+                hpx::threads::thread_stacksize::large),
+            &recurse, 1000);
+
+        HPX_TEST_EQ(small.get(), std::uint64_t(10));
+        HPX_TEST_EQ(large.get(), std::uint64_t(1000));
+    }
+}
+
+int hpx_main()
+{
+#if defined(HPX_TEST_STACK_CACHE)
+    test_stack_release();
+#endif
+    test_suspending_threads();
+    test_stack_sizes();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // use a single worker thread caching one stack only
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=1", "hpx.stacks.cache_size=1"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
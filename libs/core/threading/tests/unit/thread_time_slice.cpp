@@ -0,0 +1,117 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_forced_yield_count()
+{
+    return hpx::this_thread::get_pool()->get_forced_yield_count(
+        static_cast<std::size_t>(-1), false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a long running thread has to give a thread queued behind it on the same
+// worker thread a chance to run
+void test_yield_if_slice_expired()
+{
+    std::int64_t const forced_yields = get_forced_yield_count();
+
+    std::atomic<bool> done(false);
+    hpx::future<bool> f = hpx::async([&done] {
+        bool yielded = false;
+        for (std::size_t i = 0; i != 100000000 && !done.load(); ++i)
+        {
+            yielded = hpx::this_thread::yield_if_slice_expired() || yielded;
+        }
+        return yielded;
+    });
+    hpx::future<void> probe = hpx::async([&done] { done = true; });
+
+    HPX_TEST(f.get());
+    probe.get();
+
+    HPX_TEST(done.load());
+    HPX_TEST_LT(forced_yields, get_forced_yield_count());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// yield_if_slice_expired is not an interruption point, a pending interruption
+// request must not escape from it
+void test_interrupted_thread()
+{
+    std::atomic<bool> done(false);
+    std::atomic<bool> yielded(false);
+    hpx::thread t([&done, &yielded] {
+        while (!done.load())
+        {
+            if (hpx::this_thread::yield_if_slice_expired())
+            {
+                yielded = true;
+            }
+        }
+    });
+
+    while (!yielded.load())
+    {
+        hpx::this_thread::yield();
+    }
+
+    t.interrupt();
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::this_thread::yield();
+    }
+    done = true;
+
+    t.join();
+    HPX_TEST(yielded.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// yield_if_slice_expired does nothing outside of an HPX thread
+void test_outside_hpx_thread()
+{
+    bool yielded = true;
+    std::thread t(
+        [&yielded] { yielded = hpx::this_thread::yield_if_slice_expired(); });
+    t.join();
+
+    HPX_TEST(!yielded);
+}
+
+int hpx_main()
+{
+    test_yield_if_slice_expired();
+    test_interrupted_thread();
+    test_outside_hpx_thread();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // use a single worker thread and a time slice of 100 microseconds
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=1", "hpx.time_slice=100"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
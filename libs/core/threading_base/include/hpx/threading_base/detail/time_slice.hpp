@@ -0,0 +1,32 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstdint>
+
+namespace hpx::threads::detail {
+
+    /// Start a new time slice of the given length (in nanoseconds) for the
+    /// HPX thread about to be executed on the calling worker thread. A length
+    /// of zero disables time slicing, i.e. the time slice never expires.
+    HPX_CORE_EXPORT void start_time_slice(std::uint64_t length) noexcept;
+
+    /// Return whether the time slice of the HPX thread currently executed on
+    /// the calling worker thread has expired.
+    HPX_CORE_EXPORT bool time_slice_expired() noexcept;
+
+    /// Record that the HPX thread currently executed on the calling worker
+    /// thread is about to yield because its time slice has expired.
+    HPX_CORE_EXPORT void mark_forced_yield() noexcept;
+
+    /// Return whether the HPX thread last executed on the calling worker
+    /// thread has yielded because its time slice has expired, and reset that
+    /// state.
+    HPX_CORE_EXPORT bool test_and_reset_forced_yield() noexcept;
+}    // namespace hpx::threads::detail
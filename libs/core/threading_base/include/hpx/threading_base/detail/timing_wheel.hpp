@@ -0,0 +1,160 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::detail {
+
+    class timing_wheel;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A timed state change of a thread, armed in a \a timing_wheel. The
+    /// entry is disarmed when it is destroyed, an entry that was armed by the
+    /// caller therefore has to stay alive only as long as the caller is
+    /// interested in the timeout.
+    class HPX_CORE_EXPORT timer_entry
+    {
+    public:
+        timer_entry(thread_id_ref_type thrd, thread_schedule_state newstate,
+            thread_restart_state newstate_ex, thread_priority priority,
+            bool retry_on_active) noexcept;
+
+        timer_entry(timer_entry const&) = delete;
+        timer_entry(timer_entry&&) = delete;
+        timer_entry& operator=(timer_entry const&) = delete;
+        timer_entry& operator=(timer_entry&&) = delete;
+
+        ~timer_entry();
+
+        /// Disarm the timer, returns false if the timer is not armed anymore,
+        /// i.e. it has fired already or is about to fire.
+        bool cancel() noexcept;
+
+    private:
+        friend class timing_wheel;
+
+        // intrusive links of the slot this entry is stored in
+        timer_entry* prev_ = nullptr;
+        timer_entry* next_ = nullptr;
+
+        // the wheel this entry is armed in, nullptr if not armed
+        std::atomic<timing_wheel*> wheel_{nullptr};
+
+        std::uint64_t deadline_ = 0;    // in ticks of the wheel
+        std::uint32_t level_ = 0;
+        std::uint32_t slot_ = 0;
+        bool owned_by_wheel_ = false;
+
+        thread_id_ref_type thrd_;
+        thread_schedule_state newstate_;
+        thread_restart_state newstate_ex_;
+        thread_priority priority_;
+        bool retry_on_active_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A hierarchical timing wheel holding the timers armed on one worker
+    /// thread of a scheduler. Level k consists of 64 slots covering 64^k
+    /// ticks of one microsecond each, the six levels span about 19 hours.
+    /// Timers further in the future are parked in the last level and are
+    /// re-inserted whenever their slot comes up. Arming and canceling a timer
+    /// is O(1), expiring timers costs O(1) per timer plus a bit scan per
+    /// level.
+    ///
+    /// The wheel is polled by the scheduling loop of the owning worker
+    /// thread. Timers can be armed and canceled from any thread.
+    class HPX_CORE_EXPORT timing_wheel
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+
+        static constexpr std::size_t level_bits = 6;
+        static constexpr std::size_t slots_per_level = std::size_t(1)
+            << level_bits;
+        static constexpr std::size_t num_levels = 6;
+
+        timing_wheel();
+
+        timing_wheel(timing_wheel const&) = delete;
+        timing_wheel(timing_wheel&&) = delete;
+        timing_wheel& operator=(timing_wheel const&) = delete;
+        timing_wheel& operator=(timing_wheel&&) = delete;
+
+        ~timing_wheel();
+
+        /// Arm the given timer to fire at the given point in time.
+        void schedule(timer_entry& entry, clock_type::time_point abs_time);
+
+        /// Arm a timer that is owned by the wheel from now on. It is
+        /// destroyed after it has fired or when the wheel is destroyed.
+        void schedule(std::unique_ptr<timer_entry> entry,
+            clock_type::time_point abs_time);
+
+        /// Fire all expired timers on behalf of the given worker thread,
+        /// returns the number of timers that have fired.
+        std::size_t poll(std::size_t num_thread);
+
+        /// Disarm all timers without firing them. Timers owned by the wheel
+        /// are destroyed, releasing the references to their threads.
+        void clear() noexcept;
+
+        /// The earliest point in time at which one of the armed timers may
+        /// expire, clock_type::time_point::max() if none is armed.
+        clock_type::time_point next_expiry() const noexcept;
+
+        bool empty() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed) == 0;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        friend class timer_entry;
+
+        bool cancel(timer_entry& entry) noexcept;
+
+        std::uint64_t to_ticks(clock_type::time_point abs_time) const noexcept;
+
+        void schedule_locked(timer_entry& entry) noexcept;
+        void insert_locked(timer_entry& entry) noexcept;
+        void unlink_locked(timer_entry& entry) noexcept;
+        bool next_expiration_locked(std::uint64_t& deadline,
+            std::size_t& level, std::size_t& slot) const noexcept;
+        void update_next_expiry_locked() noexcept;
+
+        mutable hpx::util::detail::spinlock mtx_;
+
+        std::atomic<std::size_t> size_;
+        std::atomic<std::uint64_t> next_expiry_;
+
+        clock_type::time_point const epoch_;
+
+        // all timers expiring before this tick have fired
+        std::uint64_t now_;
+
+        std::uint64_t occupied_[num_levels];
+        timer_entry* slots_[num_levels][slots_per_level];
+    };
+}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -12,6 +12,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/threading_base/detail/timing_wheel.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -24,6 +25,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -242,6 +244,21 @@ namespace hpx::threads::policies {
 
         virtual void reset_thread_distribution() noexcept {}
 
+        // Return the NUMA domain the given worker thread belongs to as used
+        // by this scheduler for interpreting thread_schedule_hint_mode::numa.
+        virtual std::size_t get_numa_domain(
+            std::size_t /* num_thread */) const noexcept
+        {
+            return 0;
+        }
+
+        // Replace the hint modes referring to the calling worker thread
+        // (thread_schedule_hint_mode::local_thread and local_numa) with the
+        // corresponding thread or NUMA domain hint. If the calling thread is
+        // not a worker thread of this scheduler the hint is dropped.
+        void resolve_local_schedule_hint(
+            threads::thread_schedule_hint& schedulehint) const noexcept;
+
         std::ptrdiff_t get_stack_size(
             threads::thread_stacksize stacksize) const noexcept;
 
@@ -267,10 +284,43 @@ namespace hpx::threads::policies {
         void set_sycl_polling_functions(polling_function_ptr sycl_func,
             polling_work_count_function_ptr sycl_work_count_func);
         void clear_sycl_polling_function();
+        void set_io_polling_functions(polling_function_ptr io_func,
+            polling_work_count_function_ptr io_work_count_func);
+        void clear_io_polling_function();
 
         detail::polling_status custom_polling_function() const;
         std::size_t get_polling_work_count() const;
 
+        ///////////////////////////////////////////////////////////////////////
+        // Timed state changes of threads are kept in one timing wheel per
+        // worker thread. A timer is armed in the wheel of the calling worker
+        // thread if that belongs to this scheduler, otherwise in the wheel of
+        // the worker thread given by the hint.
+        void schedule_timer(threads::detail::timer_entry& entry,
+            std::chrono::steady_clock::time_point const& abs_time,
+            threads::thread_schedule_hint schedulehint =
+                threads::thread_schedule_hint());
+        void schedule_timer(std::unique_ptr<threads::detail::timer_entry> entry,
+            std::chrono::steady_clock::time_point const& abs_time,
+            threads::thread_schedule_hint schedulehint =
+                threads::thread_schedule_hint());
+
+        // Fire the expired timers of the given worker thread and of all
+        // suspended worker threads. Idle worker threads additionally fire the
+        // expired timers of all other (busy) worker threads. Returns whether
+        // any timer has fired.
+        bool poll_timers(std::size_t num_thread, bool idle = false);
+
+        // Disarm all timers without firing them, this releases the references
+        // to the threads held by the timers. This has to be called once the
+        // worker threads have been stopped, before the scheduler is
+        // destroyed.
+        void clear_timers() noexcept;
+
+        // return the number of armed timers
+        std::size_t get_timer_count(
+            std::size_t num_thread = std::size_t(-1)) const noexcept;
+
         // almost all schedulers support direct execution
         virtual bool supports_direct_execution() const noexcept
         {
@@ -278,6 +328,9 @@ namespace hpx::threads::policies {
         }
 
     protected:
+        std::size_t select_timing_wheel(
+            threads::thread_schedule_hint schedulehint) const noexcept;
+
         // the scheduler mode, protected from false sharing
         util::cache_line_data<std::atomic<scheduler_mode>> mode_;
 
@@ -312,12 +365,20 @@ namespace hpx::threads::policies {
         std::atomic<polling_function_ptr> polling_function_mpi_;
         std::atomic<polling_function_ptr> polling_function_cuda_;
         std::atomic<polling_function_ptr> polling_function_sycl_;
+        std::atomic<polling_function_ptr> polling_function_io_;
         std::atomic<polling_work_count_function_ptr>
             polling_work_count_function_mpi_;
         std::atomic<polling_work_count_function_ptr>
             polling_work_count_function_cuda_;
         std::atomic<polling_work_count_function_ptr>
             polling_work_count_function_sycl_;
+        std::atomic<polling_work_count_function_ptr>
+            polling_work_count_function_io_;
+
+        // the timers armed on each of the worker threads
+        std::vector<std::unique_ptr<threads::detail::timing_wheel>>
+            timing_wheels_;
+        std::atomic<std::size_t> suspended_pu_count_;
 
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
     public:
@@ -19,7 +19,9 @@
 namespace hpx::threads::detail {
 
     /// Set a timer to set the state of the given \a thread to the given
-    /// new value after it expired (at the given time)
+    /// new value after it expired (at the given time). The timer is armed in
+    /// the timing wheel of the given scheduler, no thread is created for it
+    /// and the returned thread id is always invalid.
     HPX_CORE_EXPORT thread_id_ref_type set_thread_state_timed(
         policies::scheduler_base* scheduler,
         hpx::chrono::steady_time_point const& abs_time,
@@ -28,9 +28,11 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <forward_list>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -49,6 +51,27 @@ namespace hpx::threads {
         using get_locality_id_type = std::uint32_t(hpx::error_code&);
         HPX_CORE_EXPORT void set_get_locality_id(get_locality_id_type* f);
         HPX_CORE_EXPORT std::uint32_t get_locality_id(hpx::error_code&);
+
+        ////////////////////////////////////////////////////////////////////////
+        // Debugging and introspection information of a thread which is not
+        // needed for scheduling it. It is allocated the first time any of its
+        // fields is modified.
+        struct thread_data_cold
+        {
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+            threads::thread_description lco_description_;
+#endif
+
+#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
+#ifdef HPX_HAVE_THREAD_FULLBACKTRACE_ON_SUSPENSION
+            char const* backtrace_ = nullptr;
+#else
+            util::backtrace const* backtrace_ = nullptr;
+#endif
+#endif
+            // Singly linked list (heap-allocated)
+            std::forward_list<hpx::function<void()>> exit_funcs_;
+        };
     }    // namespace detail
 
     ////////////////////////////////////////////////////////////////////////////
@@ -262,6 +285,12 @@ namespace hpx::threads {
         {
             return {"<unknown>"};
         }
+        static constexpr bool try_get_description(
+            threads::thread_description& desc) noexcept
+        {
+            desc = {"<unknown>"};
+            return true;
+        }
 
         static constexpr threads::thread_description
         get_lco_description() noexcept    //-V524
@@ -274,33 +303,54 @@ namespace hpx::threads {
             return {"<unknown>"};
         }
 #else
-        threads::thread_description get_description() const
+        threads::thread_description get_description() const noexcept
         {
-            std::lock_guard<hpx::util::detail::spinlock> l(
-                spinlock_pool::spinlock_for(this));
-            return description_;
+            threads::thread_description desc;
+            while (!try_read_description(description_, desc))
+            {
+                HPX_SMT_PAUSE;
+            }
+            return desc;
         }
         threads::thread_description set_description(
-            threads::thread_description value)
+            threads::thread_description value) noexcept
         {
-            std::lock_guard<hpx::util::detail::spinlock> l(
-                spinlock_pool::spinlock_for(this));
+            begin_description_update();
             std::swap(description_, value);
+            end_description_update();
             return value;
         }
 
-        threads::thread_description get_lco_description() const
+        // Retrieve the description without blocking, returns false if the
+        // description is currently being modified. This is safe to be called
+        // from inside a signal handler.
+        bool try_get_description(
+            threads::thread_description& desc) const noexcept
         {
-            std::lock_guard<hpx::util::detail::spinlock> l(
-                spinlock_pool::spinlock_for(this));
-            return lco_description_;
+            return try_read_description(description_, desc);
+        }
+
+        threads::thread_description get_lco_description() const noexcept
+        {
+            threads::thread_description desc;
+            detail::thread_data_cold const* cold = get_cold_data();
+            if (cold != nullptr)
+            {
+                while (!try_read_description(cold->lco_description_, desc))
+                {
+                    HPX_SMT_PAUSE;
+                }
+            }
+            return desc;
         }
         threads::thread_description set_lco_description(
             threads::thread_description value)
         {
-            std::lock_guard<hpx::util::detail::spinlock> l(
-                spinlock_pool::spinlock_for(this));
-            std::swap(lco_description_, value);
+            detail::thread_data_cold& cold = get_or_create_cold_data();
+
+            begin_description_update();
+            std::swap(cold.lco_description_, value);
+            end_description_update();
             return value;
         }
 #endif
@@ -385,15 +435,23 @@ namespace hpx::threads {
         {
             std::lock_guard<hpx::util::detail::spinlock> l(
                 spinlock_pool::spinlock_for(this));
-            return backtrace_;
+
+            detail::thread_data_cold const* cold = get_cold_data();
+            return cold != nullptr ? cold->backtrace_ : nullptr;
         }
         char const* set_backtrace(char const* value) noexcept
         {
+            detail::thread_data_cold* cold = get_cold_data_for(value);
+            if (cold == nullptr)
+            {
+                return nullptr;
+            }
+
             std::lock_guard<hpx::util::detail::spinlock> l(
                 spinlock_pool::spinlock_for(this));
 
-            char const* bt = backtrace_;
-            backtrace_ = value;
+            char const* bt = cold->backtrace_;
+            cold->backtrace_ = value;
             return bt;
         }
 #else
@@ -401,16 +459,24 @@ namespace hpx::threads {
         {
             std::lock_guard<hpx::util::detail::spinlock> l(
                 spinlock_pool::spinlock_for(this));
-            return backtrace_;
+
+            detail::thread_data_cold const* cold = get_cold_data();
+            return cold != nullptr ? cold->backtrace_ : nullptr;
         }
         util::backtrace const* set_backtrace(
             util::backtrace const* value) noexcept
         {
+            detail::thread_data_cold* cold = get_cold_data_for(value);
+            if (cold == nullptr)
+            {
+                return nullptr;
+            }
+
             std::lock_guard<hpx::util::detail::spinlock> l(
                 spinlock_pool::spinlock_for(this));
 
-            util::backtrace const* bt = backtrace_;
-            backtrace_ = value;
+            util::backtrace const* bt = cold->backtrace_;
+            cold->backtrace_ = value;
             return bt;
         }
 #endif
@@ -422,12 +488,13 @@ namespace hpx::threads {
                 spinlock_pool::spinlock_for(this));
 
             std::string bt;
-            if (0 != backtrace_)
+            detail::thread_data_cold const* cold = get_cold_data();
+            if (cold != nullptr && nullptr != cold->backtrace_)
             {
 #ifdef HPX_HAVE_THREAD_FULLBACKTRACE_ON_SUSPENSION
-                bt = *backtrace_;
+                bt = cold->backtrace_;
 #else
-                bt = backtrace_->trace();
+                bt = cold->backtrace_->trace();
 #endif
             }
             return bt;
@@ -443,41 +510,69 @@ namespace hpx::threads {
             priority_ = priority;
         }
 
+        // the deadline of this thread, no_deadline if it has none
+        std::chrono::steady_clock::time_point get_deadline() const noexcept
+        {
+            return std::chrono::steady_clock::time_point(
+                std::chrono::steady_clock::duration(
+                    deadline_.load(std::memory_order_relaxed)));
+        }
+        bool has_deadline() const noexcept
+        {
+            return get_deadline() != no_deadline;
+        }
+        void set_deadline(
+            std::chrono::steady_clock::time_point deadline) noexcept
+        {
+            deadline_.store(deadline.time_since_epoch().count(),
+                std::memory_order_relaxed);
+        }
+
+        // Move the deadline of this thread forward to the given one if that
+        // is earlier (priority inheritance), returns whether the deadline
+        // was changed.
+        bool inherit_deadline(
+            std::chrono::steady_clock::time_point deadline) noexcept
+        {
+            auto const rep = deadline.time_since_epoch().count();
+            auto current = deadline_.load(std::memory_order_relaxed);
+            while (rep < current)
+            {
+                if (deadline_.compare_exchange_weak(
+                        current, rep, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
-            std::lock_guard<hpx::util::detail::spinlock> l(
-                spinlock_pool::spinlock_for(this));
-            return requested_interrupt_;
+            return requested_interrupt_.load(std::memory_order_acquire);
         }
 
         bool interruption_enabled() const noexcept
         {
-            std::lock_guard<hpx::util::detail::spinlock> l(
-                spinlock_pool::spinlock_for(this));
-            return enabled_interrupt_;
+            return enabled_interrupt_.load(std::memory_order_acquire);
         }
 
         bool set_interruption_enabled(bool enable) noexcept
         {
-            std::lock_guard<hpx::util::detail::spinlock> l(
-                spinlock_pool::spinlock_for(this));
-            std::swap(enabled_interrupt_, enable);
-            return enable;
+            return enabled_interrupt_.exchange(
+                enable, std::memory_order_acq_rel);
         }
 
         void interrupt(bool flag = true)
         {
-            std::unique_lock<hpx::util::detail::spinlock> l(
-                spinlock_pool::spinlock_for(this));
-            if (flag && !enabled_interrupt_)
+            if (flag && !enabled_interrupt_.load(std::memory_order_acquire))
             {
-                l.unlock();
                 HPX_THROW_EXCEPTION(hpx::error::thread_not_interruptable,
                     "thread_data::interrupt",
                     "interrupts are disabled for this thread");
             }
-            requested_interrupt_ = flag;
+            requested_interrupt_.store(flag, std::memory_order_release);
         }
 
         bool interruption_point(bool throw_on_interrupt = true);
@@ -501,6 +596,11 @@ namespace hpx::threads {
 
         void destroy_thread() override;
 
+        // Hand the stack of a terminated thread to the stack cache of the
+        // calling OS thread, this has to be called by the worker thread that
+        // has observed the termination.
+        void unbind_stack() noexcept;
+
         constexpr policies::scheduler_base* get_scheduler_base() const noexcept
         {
             return scheduler_base_;
@@ -508,13 +608,17 @@ namespace hpx::threads {
 
         constexpr std::size_t get_last_worker_thread_num() const noexcept
         {
-            return last_worker_thread_num_;
+            return last_worker_thread_num_ ==
+                    (std::numeric_limits<std::uint32_t>::max)() ?
+                static_cast<std::size_t>(-1) :
+                last_worker_thread_num_;
         }
 
         void set_last_worker_thread_num(
             std::size_t last_worker_thread_num) noexcept
         {
-            last_worker_thread_num_ = last_worker_thread_num;
+            last_worker_thread_num_ =
+                static_cast<std::uint32_t>(last_worker_thread_num);
         }
 
         constexpr std::ptrdiff_t get_stack_size() const noexcept
@@ -606,54 +710,136 @@ namespace hpx::threads {
         void rebind_base(thread_init_data& init_data);
 
     private:
-        mutable std::atomic<thread_state> current_state_;
+        // the cold data block, nullptr if it was not allocated yet
+        detail::thread_data_cold const* get_cold_data() const noexcept
+        {
+            return cold_.load(std::memory_order_acquire);
+        }
+        detail::thread_data_cold& get_or_create_cold_data() const;
 
-        ///////////////////////////////////////////////////////////////////////
-        // Debugging/logging information
-#ifdef HPX_HAVE_THREAD_DESCRIPTION
-        threads::thread_description description_;
-        threads::thread_description lco_description_;
-#endif
+#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
+        // Resetting the backtrace doesn't need the cold data block. As the
+        // backtrace is a debugging aid only, it is dropped if the cold data
+        // block can't be allocated.
+        detail::thread_data_cold* get_cold_data_for(
+            void const* value) const noexcept
+        {
+            detail::thread_data_cold* cold =
+                cold_.load(std::memory_order_acquire);
+            if (cold != nullptr || value == nullptr)
+            {
+                return cold;
+            }
 
-#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-        std::uint32_t parent_locality_id_;
-        thread_id_type parent_thread_id_;
-        std::size_t parent_thread_phase_;
+            try
+            {
+                return &get_or_create_cold_data();
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
 #endif
 
-#ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
-        mutable thread_schedule_state marked_state_;
-#endif
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+        // The descriptions are protected by a sequence counter: readers never
+        // block and retry if the descriptions were modified concurrently,
+        // writers mark the counter as odd while modifying the descriptions.
+        void begin_description_update() const noexcept
+        {
+            std::uint32_t version =
+                description_version_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                if ((version & 1) == 0 &&
+                    description_version_.compare_exchange_weak(version,
+                        version + 1, std::memory_order_acquire,
+                        std::memory_order_relaxed))
+                {
+                    break;
+                }
+                HPX_SMT_PAUSE;
+                version = description_version_.load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+        }
 
-#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
-#ifdef HPX_HAVE_THREAD_FULLBACKTRACE_ON_SUSPENSION
-        char const* backtrace_;
-#else
-        util::backtrace const* backtrace_;
-#endif
+        void end_description_update() const noexcept
+        {
+            description_version_.fetch_add(1, std::memory_order_release);
+        }
+
+        bool try_read_description(threads::thread_description const& src,
+            threads::thread_description& dest) const noexcept
+        {
+            std::uint32_t const version =
+                description_version_.load(std::memory_order_acquire);
+            if ((version & 1) != 0)
+            {
+                return false;
+            }
+
+            dest = src;
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return version ==
+                description_version_.load(std::memory_order_relaxed);
+        }
 #endif
+
         ///////////////////////////////////////////////////////////////////////
-        thread_priority priority_;
+        // Data used while scheduling the thread, this is kept on the first
+        // cache line of the object (together with the vtable pointer and the
+        // reference count of the base class, 16 bytes). The members up to
+        // requested_interrupt_ occupy exactly 64 bytes on 64 bit platforms.
+        mutable std::atomic<thread_state> current_state_;
 
-        bool requested_interrupt_;
-        bool enabled_interrupt_;
-        bool ran_exit_funcs_;
+        // reference to scheduler which created/manages this thread
+        policies::scheduler_base* scheduler_base_;
+        void* queue_;
+
+        std::ptrdiff_t stacksize_;
+
+        // support deadline aware scheduling
+        std::atomic<std::chrono::steady_clock::rep> deadline_;
+
+        // (std::numeric_limits<std::uint32_t>::max)() if the thread has not
+        // run yet
+        std::uint32_t last_worker_thread_num_;
+
+        thread_priority priority_;
         bool const is_stackless_;
 
         // support scoped child execution
         std::atomic<bool> runs_as_child_;
 
-        // Singly linked list (heap-allocated)
-        std::forward_list<hpx::function<void()>> exit_funcs_;
+        std::atomic<bool> requested_interrupt_;
 
-        // reference to scheduler which created/manages this thread
-        policies::scheduler_base* scheduler_base_;
-        std::size_t last_worker_thread_num_;
-
-        std::ptrdiff_t stacksize_;
+        ///////////////////////////////////////////////////////////////////////
+        // Data rarely used while scheduling the thread
         thread_stacksize stacksize_enum_;
+        std::atomic<bool> enabled_interrupt_;
+        bool ran_exit_funcs_;
 
-        void* queue_;
+        ///////////////////////////////////////////////////////////////////////
+        // Debugging/logging information
+        mutable std::atomic<detail::thread_data_cold*> cold_;
+
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+        mutable std::atomic<std::uint32_t> description_version_;
+        threads::thread_description description_;
+#endif
+
+#ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
+        mutable thread_schedule_state marked_state_;
+#endif
+
+#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
+        std::uint32_t parent_locality_id_;
+        thread_id_type parent_thread_id_;
+        std::size_t parent_thread_phase_;
+#endif
 
     public:
 #if defined(HPX_HAVE_APEX)
@@ -156,6 +156,13 @@ namespace hpx::threads {
             HPX_ASSERT(coroutine_.is_ready());
         }
 
+        // Terminated threads don't hold on to their stack, a new stack is
+        // bound when the thread object is reused and run for the first time.
+        void unbind_stack() noexcept
+        {
+            coroutine_.unbind_stack();
+        }
+
         thread_data_stackful(thread_init_data& init_data, void* queue,
             std::ptrdiff_t stacksize, thread_id_addref addref)
           : thread_data(init_data, queue, stacksize, false, addref)
@@ -649,6 +649,21 @@ namespace hpx::this_thread {
     HPX_CORE_EXPORT threads::thread_pool_base* get_pool(
         error_code& ec = throws);
 
+    /// The function \a yield_if_slice_expired returns control to the thread
+    /// manager if the time slice granted to the current thread has expired
+    /// (see the configuration setting hpx.time_slice), allowing other threads
+    /// to run. Otherwise it returns immediately. Long running threads should
+    /// call this function at points where it is safe for them to be
+    /// suspended.
+    ///
+    /// \returns Whether the current thread was suspended.
+    ///
+    /// \note Does nothing if called outside of a stackful HPX-thread or
+    ///       while the current thread holds registered locks (see
+    ///       hpx.lock_detection). This is not an interruption point, pending
+    ///       interruption requests are not handled by this function.
+    HPX_CORE_EXPORT bool yield_if_slice_expired() noexcept;
+
     /// \cond NOINTERNAL
     // returns the remaining available stack space
     HPX_CORE_EXPORT std::ptrdiff_t get_available_stack_space() noexcept;
@@ -15,6 +15,7 @@
 #include <hpx/threading_base/external_timer.hpp>
 #endif
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <utility>
@@ -24,6 +25,11 @@
 
 namespace hpx::threads {
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// The deadline of threads that don't have one
+    inline constexpr std::chrono::steady_clock::time_point no_deadline =
+        (std::chrono::steady_clock::time_point::max)();
+
     ///////////////////////////////////////////////////////////////////////////
     class thread_init_data
     {
@@ -46,6 +52,7 @@ namespace hpx::threads {
           , stacksize(thread_stacksize::default_)
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
+          , deadline(no_deadline)
           , scheduler_base(nullptr)
         {
             if (initial_state == thread_schedule_state::staged)
@@ -65,6 +72,7 @@ namespace hpx::threads {
             stacksize = rhs.stacksize;
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
+            deadline = rhs.deadline;
             scheduler_base = rhs.scheduler_base;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = HPX_MOVE(rhs.description);
@@ -104,6 +112,7 @@ namespace hpx::threads {
           , stacksize(rhs.stacksize)
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
+          , deadline(rhs.deadline)
           , scheduler_base(rhs.scheduler_base)
         {
         }
@@ -138,6 +147,7 @@ namespace hpx::threads {
           , stacksize(stacksize_)
           , initial_state(initial_state_)
           , run_now(run_now_)
+          , deadline(no_deadline)
           , scheduler_base(scheduler_base_)
         {
             if (initial_state == thread_schedule_state::staged)
@@ -170,6 +180,10 @@ namespace hpx::threads {
         thread_schedule_state initial_state;
         bool run_now;
 
+        // the point in time the thread should have run by, threads with a
+        // deadline are preferred by deadline aware schedulers
+        std::chrono::steady_clock::time_point deadline;
+
         policies::scheduler_base* scheduler_base;
     };
 }    // namespace hpx::threads
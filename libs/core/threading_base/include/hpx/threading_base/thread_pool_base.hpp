@@ -60,6 +60,24 @@ namespace hpx::threads {
     };
     /// \endcond
 
+    /// The admission policy of a thread pool defines what happens to new work
+    /// created while the number of threads queued in the pool has reached the
+    /// admission limit of the pool (see hpx.admission.limit).
+    enum class admission_policy : std::uint8_t
+    {
+        /// Run the new work directly on the creating HPX thread.
+        run_inline = 0,
+        /// Suspend the creating HPX thread until the number of queued threads
+        /// has dropped below the admission limit.
+        suspend = 1,
+        /// Reject the new work by reporting
+        /// hpx::error::thread_resource_error.
+        reject = 2
+    };
+
+    HPX_CORE_EXPORT char const* get_admission_policy_name(
+        admission_policy policy) noexcept;
+
     struct thread_pool_init_parameters
     {
         std::string const& name_;
@@ -75,6 +93,9 @@ namespace hpx::threads {
         std::size_t max_idle_loop_count_;
         std::size_t max_busy_loop_count_;
         std::size_t shutdown_check_count_;
+        std::uint64_t time_slice_;
+        std::size_t admission_limit_;
+        admission_policy admission_policy_;
 
         thread_pool_init_parameters(std::string const& name, std::size_t index,
             policies::scheduler_mode mode, std::size_t num_threads,
@@ -87,7 +108,9 @@ namespace hpx::threads {
             std::size_t max_background_threads = static_cast<std::size_t>(-1),
             std::size_t max_idle_loop_count = HPX_IDLE_LOOP_COUNT_MAX,
             std::size_t max_busy_loop_count = HPX_BUSY_LOOP_COUNT_MAX,
-            std::size_t shutdown_check_count = 10)
+            std::size_t shutdown_check_count = 10,
+            std::uint64_t time_slice = 0, std::size_t admission_limit = 0,
+            admission_policy policy = admission_policy::suspend)
           : name_(name)
           , index_(index)
           , mode_(mode)
@@ -100,6 +123,9 @@ namespace hpx::threads {
           , max_idle_loop_count_(max_idle_loop_count)
           , max_busy_loop_count_(max_busy_loop_count)
           , shutdown_check_count_(shutdown_check_count)
+          , time_slice_(time_slice)
+          , admission_limit_(admission_limit)
+          , admission_policy_(policy)
         {
         }
     };
@@ -437,6 +463,22 @@ namespace hpx::threads {
         virtual std::int64_t get_busy_loop_count(
             std::size_t num, bool reset) = 0;
 
+        // number of HPX threads that have yielded because their time slice
+        // has expired (see hpx.time_slice)
+        virtual std::int64_t get_forced_yield_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        // number of HPX threads whose creation was throttled because the
+        // admission limit of the pool was reached (see hpx.admission.limit)
+        virtual std::int64_t get_throttled_spawn_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         virtual bool enumerate_threads(
             hpx::function<bool(thread_id_type)> const& /*f*/,
@@ -78,11 +78,22 @@ namespace hpx::threads::detail {
             {
                 data.priority = thread_priority::high_recursive;
             }
+
+            // work created on behalf of a thread with a deadline has to be
+            // done by that deadline as well
+            if (data.deadline == no_deadline)
+            {
+                data.deadline =
+                    get_thread_id_data(threads::get_self_id())->get_deadline();
+            }
         }
 
         if (data.priority == thread_priority::default_)
             data.priority = thread_priority::normal;
 
+        // hints referring to the calling worker thread are bound now
+        scheduler->resolve_local_schedule_hint(data.schedulehint);
+
         // create the new thread
         scheduler->create_thread(data, &id, ec);
 
@@ -88,6 +88,14 @@ namespace hpx::threads::detail {
             {
                 data.priority = thread_priority::high_recursive;
             }
+
+            // work created on behalf of a thread with a deadline has to be
+            // done by that deadline as well
+            if (data.deadline == no_deadline)
+            {
+                data.deadline =
+                    get_thread_id_data(self->get_thread_id())->get_deadline();
+            }
         }
 
         // create the new thread
@@ -102,6 +110,9 @@ namespace hpx::threads::detail {
             thread_priority::bound == data.priority ||
             thread_priority::boost == data.priority);
 
+        // hints referring to the calling worker thread are bound now
+        scheduler->resolve_local_schedule_hint(data.schedulehint);
+
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
 
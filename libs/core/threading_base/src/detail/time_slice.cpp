@@ -0,0 +1,59 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/detail/time_slice.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <cstdint>
+#include <limits>
+
+namespace hpx::threads::detail {
+
+    namespace {
+
+        struct time_slice_data
+        {
+            std::uint64_t end = (std::numeric_limits<std::uint64_t>::max)();
+            bool forced_yield = false;
+        };
+
+        time_slice_data& time_slice_tss() noexcept
+        {
+            thread_local time_slice_data time_slice_tss_;
+            return time_slice_tss_;
+        }
+    }    // namespace
+
+    void start_time_slice(std::uint64_t length) noexcept
+    {
+        time_slice_tss().end = length == 0 ?
+            (std::numeric_limits<std::uint64_t>::max)() :
+            hpx::chrono::high_resolution_clock::now() + length;
+    }
+
+    bool time_slice_expired() noexcept
+    {
+        std::uint64_t const end = time_slice_tss().end;
+
+        // avoid querying the clock if time slicing is disabled
+        return end != (std::numeric_limits<std::uint64_t>::max)() &&
+            hpx::chrono::high_resolution_clock::now() >= end;
+    }
+
+    void mark_forced_yield() noexcept
+    {
+        time_slice_tss().forced_yield = true;
+    }
+
+    bool test_and_reset_forced_yield() noexcept
+    {
+        auto& data = time_slice_tss();
+        bool const result = data.forced_yield;
+        data.forced_yield = false;
+        return result;
+    }
+}    // namespace hpx::threads::detail
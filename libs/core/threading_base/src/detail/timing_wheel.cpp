@@ -0,0 +1,415 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/timing_wheel.hpp>
+#include <hpx/threading_base/set_thread_state.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::detail {
+
+    namespace {
+
+        // v must not be zero
+        inline std::size_t count_trailing_zeros(std::uint64_t v) noexcept
+        {
+            HPX_ASSERT(v != 0);
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_ctzll(v));
+#else
+            std::size_t n = 0;
+            while ((v & 1) == 0)
+            {
+                v >>= 1;
+                ++n;
+            }
+            return n;
+#endif
+        }
+
+        constexpr std::uint64_t no_expiry =
+            (std::numeric_limits<std::uint64_t>::max)();
+
+        // the state change of an expired timer, applied after the lock of
+        // the wheel has been released
+        struct expired_timer
+        {
+            thread_id_ref_type thrd;
+            thread_schedule_state newstate;
+            thread_restart_state newstate_ex;
+            thread_priority priority;
+            bool retry_on_active;
+        };
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_entry::timer_entry(thread_id_ref_type thrd,
+        thread_schedule_state newstate, thread_restart_state newstate_ex,
+        thread_priority priority, bool retry_on_active) noexcept
+      : thrd_(HPX_MOVE(thrd))
+      , newstate_(newstate)
+      , newstate_ex_(newstate_ex)
+      , priority_(priority)
+      , retry_on_active_(retry_on_active)
+    {
+    }
+
+    timer_entry::~timer_entry()
+    {
+        cancel();
+    }
+
+    bool timer_entry::cancel() noexcept
+    {
+        timing_wheel* wheel = wheel_.load(std::memory_order_acquire);
+        return wheel != nullptr && wheel->cancel(*this);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    timing_wheel::timing_wheel()
+      : size_(0)
+      , next_expiry_(no_expiry)
+      , epoch_(clock_type::now())
+      , now_(0)
+      , occupied_{}
+      , slots_{}
+    {
+    }
+
+    timing_wheel::~timing_wheel()
+    {
+        clear();
+    }
+
+    void timing_wheel::clear() noexcept
+    {
+        // the owned entries are destroyed only after the lock has been
+        // released, dropping the last reference to a thread destroys it
+        timer_entry* owned = nullptr;
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+            for (std::size_t level = 0; level != num_levels; ++level)
+            {
+                for (timer_entry*& head : slots_[level])
+                {
+                    timer_entry* entry = head;
+                    head = nullptr;
+
+                    while (entry != nullptr)
+                    {
+                        timer_entry* next = entry->next_;
+                        entry->prev_ = nullptr;
+                        entry->next_ = nullptr;
+                        entry->wheel_.store(nullptr, std::memory_order_release);
+                        if (entry->owned_by_wheel_)
+                        {
+                            entry->next_ = owned;
+                            owned = entry;
+                        }
+                        entry = next;
+                    }
+                }
+                occupied_[level] = 0;
+            }
+
+            size_.store(0, std::memory_order_relaxed);
+            next_expiry_.store(no_expiry, std::memory_order_relaxed);
+        }
+
+        while (owned != nullptr)
+        {
+            timer_entry* next = owned->next_;
+            delete owned;
+            owned = next;
+        }
+    }
+
+    std::uint64_t timing_wheel::to_ticks(
+        clock_type::time_point abs_time) const noexcept
+    {
+        // round up, timers never fire early
+        if (abs_time <= epoch_)
+            return 0;
+
+        return static_cast<std::uint64_t>(
+            std::chrono::ceil<std::chrono::microseconds>(abs_time - epoch_)
+                .count());
+    }
+
+    void timing_wheel::schedule(
+        timer_entry& entry, clock_type::time_point abs_time)
+    {
+        std::uint64_t const deadline = to_ticks(abs_time);
+
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+        HPX_ASSERT(entry.wheel_.load(std::memory_order_relaxed) == nullptr);
+
+        entry.deadline_ = deadline;
+        schedule_locked(entry);
+    }
+
+    void timing_wheel::schedule(
+        std::unique_ptr<timer_entry> entry, clock_type::time_point abs_time)
+    {
+        std::uint64_t const deadline = to_ticks(abs_time);
+
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+        HPX_ASSERT(entry->wheel_.load(std::memory_order_relaxed) == nullptr);
+
+        entry->deadline_ = deadline;
+        entry->owned_by_wheel_ = true;
+        schedule_locked(*entry.release());
+    }
+
+    void timing_wheel::schedule_locked(timer_entry& entry) noexcept
+    {
+        entry.wheel_.store(this, std::memory_order_relaxed);
+        insert_locked(entry);
+
+        size_.store(size_.load(std::memory_order_relaxed) + 1,
+            std::memory_order_relaxed);
+        update_next_expiry_locked();
+    }
+
+    bool timing_wheel::cancel(timer_entry& entry) noexcept
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+        // the entry may have expired concurrently
+        if (entry.wheel_.load(std::memory_order_relaxed) != this)
+            return false;
+
+        unlink_locked(entry);
+        entry.wheel_.store(nullptr, std::memory_order_relaxed);
+
+        size_.store(size_.load(std::memory_order_relaxed) - 1,
+            std::memory_order_relaxed);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // An entry is placed on the lowest level on which its deadline is in the
+    // same rotation as the current time, i.e. the level of the most
+    // significant bit in which both differ.
+    void timing_wheel::insert_locked(timer_entry& entry) noexcept
+    {
+        std::uint64_t const deadline = (std::max)(entry.deadline_, now_);
+        std::uint64_t const masked = (deadline ^ now_) | (slots_per_level - 1);
+
+        std::size_t level = 0;
+        while (level != num_levels - 1 &&
+            (masked >> (level_bits * (level + 1))) != 0)
+        {
+            ++level;
+        }
+
+        std::size_t const slot =
+            (deadline >> (level_bits * level)) & (slots_per_level - 1);
+
+        entry.level_ = static_cast<std::uint32_t>(level);
+        entry.slot_ = static_cast<std::uint32_t>(slot);
+
+        timer_entry*& head = slots_[level][slot];
+        entry.prev_ = nullptr;
+        entry.next_ = head;
+        if (head != nullptr)
+        {
+            head->prev_ = &entry;
+        }
+        head = &entry;
+
+        occupied_[level] |= std::uint64_t(1) << slot;
+    }
+
+    void timing_wheel::unlink_locked(timer_entry& entry) noexcept
+    {
+        timer_entry*& head = slots_[entry.level_][entry.slot_];
+
+        if (entry.prev_ != nullptr)
+        {
+            entry.prev_->next_ = entry.next_;
+        }
+        else
+        {
+            HPX_ASSERT(head == &entry);
+            head = entry.next_;
+        }
+
+        if (entry.next_ != nullptr)
+        {
+            entry.next_->prev_ = entry.prev_;
+        }
+
+        if (head == nullptr)
+        {
+            occupied_[entry.level_] &= ~(std::uint64_t(1) << entry.slot_);
+        }
+
+        entry.prev_ = nullptr;
+        entry.next_ = nullptr;
+    }
+
+    // Find the slot that expires next. Entries on lower levels always expire
+    // before those on higher levels.
+    bool timing_wheel::next_expiration_locked(std::uint64_t& deadline,
+        std::size_t& level, std::size_t& slot) const noexcept
+    {
+        for (level = 0; level != num_levels; ++level)
+        {
+            std::uint64_t const occupied = occupied_[level];
+            if (occupied == 0)
+                continue;
+
+            std::size_t const shift = level_bits * level;
+            std::uint64_t const slot_range = std::uint64_t(1) << shift;
+            std::uint64_t const level_range = slot_range << level_bits;
+
+            // the first occupied slot at or after the current one
+            std::size_t const now_slot =
+                (now_ >> shift) & (slots_per_level - 1);
+            std::uint64_t const rotated = now_slot == 0 ?
+                occupied :
+                (occupied >> now_slot) |
+                    (occupied << (slots_per_level - now_slot));
+
+            // entries beyond the range of the wheel may be parked in the
+            // current slot of the last level, they are due one rotation
+            // later, i.e. after all other slots of that level
+            std::uint64_t const later = rotated & ~std::uint64_t(1);
+            std::size_t const distance = count_trailing_zeros(
+                level == 0 || later == 0 ? rotated : later);
+
+            slot = (now_slot + distance) & (slots_per_level - 1);
+            deadline = (now_ & ~(level_range - 1)) +
+                (now_slot + distance) * slot_range;
+
+            if (level != 0 && distance == 0)
+            {
+                deadline += level_range;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void timing_wheel::update_next_expiry_locked() noexcept
+    {
+        std::uint64_t deadline = no_expiry;
+        std::size_t level = 0;
+        std::size_t slot = 0;
+        if (!next_expiration_locked(deadline, level, slot))
+        {
+            deadline = no_expiry;
+        }
+        next_expiry_.store(deadline, std::memory_order_relaxed);
+    }
+
+    timing_wheel::clock_type::time_point timing_wheel::next_expiry()
+        const noexcept
+    {
+        std::uint64_t const deadline =
+            next_expiry_.load(std::memory_order_relaxed);
+        if (deadline == no_expiry)
+            return (clock_type::time_point::max)();
+
+        return epoch_ + std::chrono::microseconds(deadline);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t timing_wheel::poll(std::size_t num_thread)
+    {
+        if (empty())
+            return 0;
+
+        auto const now = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                clock_type::now() - epoch_)
+                .count());
+        if (now < next_expiry_.load(std::memory_order_relaxed))
+            return 0;
+
+        // the state changes are applied only after the lock has been
+        // released, the caller of cancel() may destroy its entry as soon as
+        // the entry has been unlinked (the vector is allocated only if any
+        // timer has expired, set_thread_state may re-enter poll)
+        std::vector<expired_timer> expired;
+
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+            std::uint64_t deadline = 0;
+            std::size_t level = 0;
+            std::size_t slot = 0;
+            while (next_expiration_locked(deadline, level, slot) &&
+                deadline <= now)
+            {
+                now_ = deadline;
+
+                timer_entry* entry = slots_[level][slot];
+                slots_[level][slot] = nullptr;
+                occupied_[level] &= ~(std::uint64_t(1) << slot);
+
+                while (entry != nullptr)
+                {
+                    timer_entry* next = entry->next_;
+                    if (entry->deadline_ <= now_)
+                    {
+                        expired.push_back(expired_timer{HPX_MOVE(entry->thrd_),
+                            entry->newstate_, entry->newstate_ex_,
+                            entry->priority_, entry->retry_on_active_});
+
+                        entry->prev_ = nullptr;
+                        entry->next_ = nullptr;
+                        entry->wheel_.store(nullptr, std::memory_order_relaxed);
+                        size_.store(size_.load(std::memory_order_relaxed) - 1,
+                            std::memory_order_relaxed);
+
+                        if (entry->owned_by_wheel_)
+                        {
+                            delete entry;
+                        }
+                    }
+                    else
+                    {
+                        // cascade to a lower level
+                        insert_locked(*entry);
+                    }
+                    entry = next;
+                }
+            }
+
+            now_ = (std::max)(now_, now);
+            update_next_expiry_locked();
+        }
+
+        std::size_t const count = expired.size();
+        for (expired_timer& timer : expired)
+        {
+            error_code ec(throwmode::lightweight);    // do not throw
+            set_thread_state(timer.thrd.noref(), timer.newstate,
+                timer.newstate_ex, timer.priority,
+                thread_schedule_hint(static_cast<std::int16_t>(num_thread)),
+                timer.retry_on_active, ec);
+        }
+
+        return count;
+    }
+}    // namespace hpx::threads::detail
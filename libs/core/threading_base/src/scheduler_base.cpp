@@ -7,10 +7,12 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/execution_base/this_thread.hpp>
+#include <hpx/threading_base/detail/timing_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
@@ -50,12 +52,22 @@ namespace hpx::threads::policies {
       , polling_function_mpi_(&null_polling_function)
       , polling_function_cuda_(&null_polling_function)
       , polling_function_sycl_(&null_polling_function)
+      , polling_function_io_(&null_polling_function)
       , polling_work_count_function_mpi_(&null_polling_work_count_function)
       , polling_work_count_function_cuda_(&null_polling_work_count_function)
       , polling_work_count_function_sycl_(&null_polling_work_count_function)
+      , polling_work_count_function_io_(&null_polling_work_count_function)
+      , suspended_pu_count_(0)
     {
         scheduler_base::set_scheduler_mode(mode);
 
+        timing_wheels_.reserve(num_threads);
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            timing_wheels_.push_back(
+                std::make_unique<threads::detail::timing_wheel>());
+        }
+
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         double const max_time = thread_queue_init.max_idle_backoff_time_;
 
@@ -89,9 +101,30 @@ namespace hpx::threads::policies {
                 (std::min)(static_cast<double>(data.wait_count_),
                     static_cast<double>(max_exponent - 1));
 
-            std::chrono::milliseconds const period(std::lround((std::min)(
+            std::chrono::milliseconds period(std::lround((std::min)(
                 data.max_idle_backoff_time_, std::pow(2.0, exponent))));
 
+            // do not sleep past the next armed timer, idle worker threads
+            // fire the timers of all other worker threads as well
+            auto next_expiry =
+                (std::chrono::steady_clock::time_point::max)();
+            for (auto const& timers : timing_wheels_)
+            {
+                if (!timers->empty())
+                {
+                    next_expiry = (std::min)(next_expiry, timers->next_expiry());
+                }
+            }
+            if (next_expiry != (std::chrono::steady_clock::time_point::max)())
+            {
+                auto const now = std::chrono::steady_clock::now();
+                period = next_expiry <= now ?
+                    std::chrono::milliseconds(0) :
+                    (std::min)(period,
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                            next_expiry - now));
+            }
+
             ++data.wait_count_;
 
             std::unique_lock<pu_mutex_type> l(mtx_);
@@ -123,10 +156,16 @@ namespace hpx::threads::policies {
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
 
+        // the timers armed on this thread are fired by the remaining worker
+        // threads while it is suspended
+        ++suspended_pu_count_;
+
         states_[num_thread].data_.store(hpx::state::sleeping);
         std::unique_lock<pu_mutex_type> l(suspend_mtxs_[num_thread]);
         suspend_conds_[num_thread].wait(l);    //-V1089
 
+        --suspended_pu_count_;
+
         // Only set running if still in hpx::state::sleeping. Can be set with
         // non-blocking/locking functions to stopping or terminating, in which
         // case the state is left untouched.
@@ -518,6 +557,23 @@ namespace hpx::threads::policies {
             &null_polling_work_count_function, std::memory_order_relaxed);
     }
 
+    void scheduler_base::set_io_polling_functions(
+        polling_function_ptr io_func,
+        polling_work_count_function_ptr io_work_count_func)
+    {
+        polling_function_io_.store(io_func, std::memory_order_relaxed);
+        polling_work_count_function_io_.store(
+            io_work_count_func, std::memory_order_relaxed);
+    }
+
+    void scheduler_base::clear_io_polling_function()
+    {
+        polling_function_io_.store(
+            &null_polling_function, std::memory_order_relaxed);
+        polling_work_count_function_io_.store(
+            &null_polling_work_count_function, std::memory_order_relaxed);
+    }
+
     detail::polling_status scheduler_base::custom_polling_function() const
     {
         detail::polling_status status = detail::polling_status::idle;
@@ -541,6 +597,13 @@ namespace hpx::threads::policies {
         {
             status = detail::polling_status::busy;
         }
+#endif
+#if defined(HPX_HAVE_MODULE_ASYNC_IO)
+        if ((*polling_function_io_.load(std::memory_order_relaxed))() ==
+            detail::polling_status::busy)
+        {
+            status = detail::polling_status::busy;
+        }
 #endif
         return status;
     }
@@ -559,10 +622,140 @@ namespace hpx::threads::policies {
 #if defined(HPX_HAVE_MODULE_ASYNC_SYCL)
         work_count +=
             polling_work_count_function_sycl_.load(std::memory_order_relaxed)();
+#endif
+#if defined(HPX_HAVE_MODULE_ASYNC_IO)
+        work_count +=
+            polling_work_count_function_io_.load(std::memory_order_relaxed)();
 #endif
         return work_count;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void scheduler_base::resolve_local_schedule_hint(
+        threads::thread_schedule_hint& schedulehint) const noexcept
+    {
+        if (schedulehint.mode != thread_schedule_hint_mode::local_thread &&
+            schedulehint.mode != thread_schedule_hint_mode::local_numa)
+        {
+            return;
+        }
+
+        std::size_t const num_thread =
+            threads::detail::get_local_thread_num_tss();
+        if (num_thread == static_cast<std::size_t>(-1) ||
+            parent_pool_ == nullptr ||
+            threads::detail::get_thread_pool_num_tss() !=
+                parent_pool_->get_pool_index())
+        {
+            schedulehint.mode = thread_schedule_hint_mode::none;
+            schedulehint.hint = -1;
+            return;
+        }
+
+        if (schedulehint.mode == thread_schedule_hint_mode::local_thread)
+        {
+            schedulehint.mode = thread_schedule_hint_mode::thread;
+            schedulehint.hint = static_cast<std::int16_t>(num_thread);
+        }
+        else
+        {
+            schedulehint.mode = thread_schedule_hint_mode::numa;
+            schedulehint.hint =
+                static_cast<std::int16_t>(get_numa_domain(num_thread));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t scheduler_base::select_timing_wheel(
+        threads::thread_schedule_hint schedulehint) const noexcept
+    {
+        // prefer the calling worker thread, it polls its wheel anyways
+        std::size_t const num_thread =
+            threads::detail::get_local_thread_num_tss();
+        if (num_thread < timing_wheels_.size() && parent_pool_ != nullptr &&
+            threads::detail::get_thread_pool_num_tss() ==
+                parent_pool_->get_pool_index())
+        {
+            return num_thread;
+        }
+
+        if (schedulehint.mode == thread_schedule_hint_mode::thread &&
+            schedulehint.hint >= 0 &&
+            static_cast<std::size_t>(schedulehint.hint) <
+                timing_wheels_.size())
+        {
+            return static_cast<std::size_t>(schedulehint.hint);
+        }
+        return 0;
+    }
+
+    void scheduler_base::schedule_timer(threads::detail::timer_entry& entry,
+        std::chrono::steady_clock::time_point const& abs_time,
+        threads::thread_schedule_hint schedulehint)
+    {
+        timing_wheels_[select_timing_wheel(schedulehint)]->schedule(
+            entry, abs_time);
+    }
+
+    void scheduler_base::schedule_timer(
+        std::unique_ptr<threads::detail::timer_entry> entry,
+        std::chrono::steady_clock::time_point const& abs_time,
+        threads::thread_schedule_hint schedulehint)
+    {
+        timing_wheels_[select_timing_wheel(schedulehint)]->schedule(
+            HPX_MOVE(entry), abs_time);
+    }
+
+    bool scheduler_base::poll_timers(std::size_t num_thread, bool idle)
+    {
+        HPX_ASSERT(num_thread < timing_wheels_.size());
+
+        std::size_t fired = timing_wheels_[num_thread]->poll(num_thread);
+
+        // The owner of a wheel may be busy running a long task or may be
+        // suspended, its timers must not be delayed in either case. Polling
+        // a wheel without expired timers does not acquire its lock.
+        if (idle || suspended_pu_count_.load(std::memory_order_relaxed) != 0)
+        {
+            for (std::size_t i = 0; i != timing_wheels_.size(); ++i)
+            {
+                if (i != num_thread &&
+                    (idle ||
+                        states_[i].data_.load(std::memory_order_relaxed) ==
+                            hpx::state::sleeping))
+                {
+                    fired += timing_wheels_[i]->poll(num_thread);
+                }
+            }
+        }
+        return fired != 0;
+    }
+
+    void scheduler_base::clear_timers() noexcept
+    {
+        for (auto const& timers : timing_wheels_)
+        {
+            timers->clear();
+        }
+    }
+
+    std::size_t scheduler_base::get_timer_count(
+        std::size_t num_thread) const noexcept
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            HPX_ASSERT(num_thread < timing_wheels_.size());
+            return timing_wheels_[num_thread]->size();
+        }
+
+        std::size_t count = 0;
+        for (auto const& timers : timing_wheels_)
+        {
+            count += timers->size();
+        }
+        return count;
+    }
+
     std::ostream& operator<<(std::ostream& os, scheduler_base const& scheduler)
     {
         os << scheduler.get_description() << "(" << &scheduler << ")";
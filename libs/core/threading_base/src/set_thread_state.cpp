@@ -264,6 +264,7 @@ namespace hpx::threads::detail {
 
             auto const* thrd_data = get_thread_id_data(thrd);
             auto* scheduler = thrd_data->get_scheduler_base();
+            scheduler->resolve_local_schedule_hint(schedulehint);
             scheduler->schedule_thread(
                 thrd, schedulehint, false, thrd_data->get_priority());
 
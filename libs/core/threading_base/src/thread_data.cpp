@@ -19,8 +19,10 @@
 #include <hpx/threading_base/external_timer.hpp>
 #endif
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -55,33 +57,32 @@ namespace hpx::threads {
       : detail::thread_data_reference_counting(addref)
       , current_state_(thread_state(
             init_data.initial_state, thread_restart_state::signaled))
+      , scheduler_base_(init_data.scheduler_base)
+      , queue_(queue)
+      , stacksize_(stacksize)
+      , deadline_(init_data.deadline.time_since_epoch().count())
+      , last_worker_thread_num_((std::numeric_limits<std::uint32_t>::max)())
+      , priority_(init_data.priority)
+      , is_stackless_(is_stackless)
+      , runs_as_child_(init_data.schedulehint.runs_as_child_mode() ==
+            hpx::threads::thread_execution_hint::run_as_child)
+      , requested_interrupt_(false)
+      , stacksize_enum_(init_data.stacksize)
+      , enabled_interrupt_(true)
+      , ran_exit_funcs_(false)
+      , cold_(nullptr)
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
+      , description_version_(0)
       , description_(init_data.description)
-      , lco_description_()
+#endif
+#ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
+      , marked_state_(thread_schedule_state::unknown)
 #endif
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
       , parent_locality_id_(init_data.parent_locality_id)
       , parent_thread_id_(init_data.parent_id)
       , parent_thread_phase_(init_data.parent_phase)
 #endif
-#ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
-      , marked_state_(thread_schedule_state::unknown)
-#endif
-#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
-      , backtrace_(nullptr)
-#endif
-      , priority_(init_data.priority)
-      , requested_interrupt_(false)
-      , enabled_interrupt_(true)
-      , ran_exit_funcs_(false)
-      , is_stackless_(is_stackless)
-      , runs_as_child_(init_data.schedulehint.runs_as_child_mode() ==
-            hpx::threads::thread_execution_hint::run_as_child)
-      , scheduler_base_(init_data.scheduler_base)
-      , last_worker_thread_num_(static_cast<std::size_t>(-1))
-      , stacksize_(stacksize)
-      , stacksize_enum_(init_data.stacksize)
-      , queue_(queue)
     {
         LTM_(debug).format(
             "thread::thread({}), description({})", this, get_description());
@@ -111,6 +112,25 @@ namespace hpx::threads {
     {
         LTM_(debug).format("thread_data::~thread_data({})", this);
         free_thread_exit_callbacks();
+
+        delete cold_.load(std::memory_order_relaxed);
+    }
+
+    detail::thread_data_cold& thread_data::get_or_create_cold_data() const
+    {
+        detail::thread_data_cold* cold = cold_.load(std::memory_order_acquire);
+        if (cold == nullptr)
+        {
+            // another thread may install its block concurrently, the first
+            // one wins
+            auto new_cold = std::make_unique<detail::thread_data_cold>();
+            if (cold_.compare_exchange_strong(cold, new_cold.get(),
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                cold = new_cold.release();
+            }
+        }
+        return *cold;
     }
 
     void thread_data::destroy_thread()
@@ -122,26 +142,42 @@ namespace hpx::threads {
         get_scheduler_base()->destroy_thread(this);
     }
 
+    void thread_data::unbind_stack() noexcept
+    {
+        if (!is_stackless())
+        {
+            static_cast<thread_data_stackful*>(this)->unbind_stack();
+        }
+    }
+
     void thread_data::run_thread_exit_callbacks()
     {
         std::unique_lock<hpx::util::detail::spinlock> l(
             spinlock_pool::spinlock_for(this));
 
-        while (!exit_funcs_.empty())
+        detail::thread_data_cold* cold = cold_.load(std::memory_order_acquire);
+        if (cold != nullptr)
         {
+            auto& exit_funcs = cold->exit_funcs_;
+            while (!exit_funcs.empty())
             {
-                hpx::unlock_guard<std::unique_lock<hpx::util::detail::spinlock>>
-                    ul(l);
-                if (!exit_funcs_.front().empty())
-                    exit_funcs_.front()();
+                {
+                    hpx::unlock_guard<
+                        std::unique_lock<hpx::util::detail::spinlock>>
+                        ul(l);
+                    if (!exit_funcs.front().empty())
+                        exit_funcs.front()();
+                }
+                exit_funcs.pop_front();
             }
-            exit_funcs_.pop_front();
         }
         ran_exit_funcs_ = true;
     }
 
     bool thread_data::add_thread_exit_callback(hpx::function<void()> const& f)
     {
+        detail::thread_data_cold& cold = get_or_create_cold_data();
+
         std::lock_guard<hpx::util::detail::spinlock> l(
             spinlock_pool::spinlock_for(this));
 
@@ -152,7 +188,7 @@ namespace hpx::threads {
             return false;
         }
 
-        exit_funcs_.push_front(f);
+        cold.exit_funcs_.push_front(f);
 
         return true;
     }
@@ -162,20 +198,20 @@ namespace hpx::threads {
         std::lock_guard<hpx::util::detail::spinlock> l(
             spinlock_pool::spinlock_for(this));
 
-        // Exit functions should have been executed.
-        HPX_ASSERT(exit_funcs_.empty() || ran_exit_funcs_);
+        detail::thread_data_cold* cold = cold_.load(std::memory_order_acquire);
+        if (cold != nullptr)
+        {
+            // Exit functions should have been executed.
+            HPX_ASSERT(cold->exit_funcs_.empty() || ran_exit_funcs_);
 
-        exit_funcs_.clear();
+            cold->exit_funcs_.clear();
+        }
     }
 
     bool thread_data::interruption_point(bool throw_on_interrupt)
     {
-        // We do not protect enabled_interrupt_ and requested_interrupt_ from
-        // concurrent access here (which creates a benign data race) in order to
-        // avoid infinite recursion. This function is called by
-        // this_thread::suspend which causes problems if the lock would call
-        // suspend itself.
-        if (enabled_interrupt_ && requested_interrupt_)
+        if (enabled_interrupt_.load(std::memory_order_relaxed) &&
+            requested_interrupt_.load(std::memory_order_acquire))
         {
             // Verify that there are no more registered locks for this
             // OS-thread. This will throw if there are still any locks held.
@@ -184,7 +220,8 @@ namespace hpx::threads {
             // now interrupt this thread
             if (throw_on_interrupt)
             {
-                requested_interrupt_ = false;    // avoid recursive exceptions
+                // avoid recursive exceptions
+                requested_interrupt_.store(false, std::memory_order_relaxed);
                 throw hpx::thread_interrupted();
             }
 
@@ -204,9 +241,21 @@ namespace hpx::threads {
         current_state_.store(thread_state(
             init_data.initial_state, thread_restart_state::signaled));
 
+        // the cold data block is kept for the next use of this object
+        if (detail::thread_data_cold* cold =
+                cold_.load(std::memory_order_relaxed))
+        {
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+            cold->lco_description_ = threads::thread_description();
+#endif
+#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
+            cold->backtrace_ = nullptr;
+#endif
+            HPX_ASSERT(cold->exit_funcs_.empty());
+        }
+
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
         description_ = init_data.description;
-        lco_description_ = threads::thread_description();
 #endif
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
         parent_locality_id_ = init_data.parent_locality_id;
@@ -215,22 +264,19 @@ namespace hpx::threads {
 #endif
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
         set_marked_state(thread_schedule_state::unknown);
-#endif
-#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
-        backtrace_ = nullptr;
 #endif
         priority_ = init_data.priority;
-        requested_interrupt_ = false;
-        enabled_interrupt_ = true;
+        requested_interrupt_.store(false, std::memory_order_relaxed);
+        enabled_interrupt_.store(true, std::memory_order_relaxed);
         ran_exit_funcs_ = false;
 
         runs_as_child_.store(init_data.schedulehint.runs_as_child_mode() ==
                 hpx::threads::thread_execution_hint::run_as_child,
             std::memory_order_relaxed);
+        set_deadline(init_data.deadline);
 
-        exit_funcs_.clear();
         scheduler_base_ = init_data.scheduler_base;
-        last_worker_thread_num_ = static_cast<std::size_t>(-1);
+        last_worker_thread_num_ = (std::numeric_limits<std::uint32_t>::max)();
 
         // We explicitly set the logical stack size again as it can be different
         // from what the previous use required. However, the physical stack size
@@ -10,7 +10,10 @@
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/execution_base/this_thread.hpp>
+#include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/time_slice.hpp>
+#include <hpx/threading_base/detail/timing_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
@@ -19,9 +22,6 @@
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
-#ifdef HPX_HAVE_VERIFY_LOCKS
-#include <hpx/lock_registration/detail/register_locks.hpp>
-#endif
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
 #include <hpx/threading_base/detail/reset_lco_description.hpp>
 #endif
@@ -534,14 +534,14 @@ namespace hpx::this_thread {
 #ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
             threads::detail::reset_backtrace bt(id, ec);
 #endif
-            std::atomic<bool> timer_started(false);
-            threads::thread_id_ref_type const timer_id =
-                threads::set_thread_state(id.noref(), abs_time, &timer_started,
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::timeout,
-                    threads::thread_priority::boost, true, ec);
-            if (ec)
-                return threads::thread_restart_state::unknown;
+            // the timer lives on our stack, it is disarmed when we are woken
+            // up before it has expired
+            threads::detail::timer_entry timer(id,
+                threads::thread_schedule_state::pending,
+                threads::thread_restart_state::timeout,
+                threads::thread_priority::boost, true);
+            get_thread_id_data(id)->get_scheduler_base()->schedule_timer(
+                timer, abs_time.value());
 
             // We might need to dispatch 'nextid' to it's correct scheduler only
             // if our current scheduler is the same, we should yield to the id
@@ -570,14 +570,7 @@ namespace hpx::this_thread {
                 HPX_ASSERT(statex == threads::thread_restart_state::abort ||
                     statex == threads::thread_restart_state::signaled);
 
-                error_code ec1(throwmode::lightweight);    // do not throw
-                hpx::util::yield_while<true>(
-                    [&timer_started]() { return !timer_started.load(); },
-                    "set_thread_state_timed");
-                threads::set_thread_state(timer_id.noref(),
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::abort,
-                    threads::thread_priority::boost, true, ec1);
+                timer.cancel();
             }
         }
 
@@ -606,6 +599,37 @@ namespace hpx::this_thread {
         return threads::get_pool(threads::get_self_id(), ec);
     }
 
+    bool yield_if_slice_expired() noexcept
+    {
+        if (!threads::detail::time_slice_expired())
+        {
+            return false;
+        }
+
+        // stackless threads can't be suspended
+        threads::thread_data const* self = threads::get_self_id_data();
+        if (self == nullptr || self->is_stackless())
+        {
+            return false;
+        }
+
+        // don't yield while the thread holds a (registered) lock
+        if (util::has_registered_locks())
+        {
+            return false;
+        }
+
+        threads::detail::mark_forced_yield();
+
+        // This is not an interruption point, a pending interruption request
+        // or an abort is handled by the next regular suspension of the
+        // thread.
+        threads::get_self().yield(threads::thread_result_type(
+            threads::thread_schedule_state::pending,
+            threads::invalid_thread_id));
+        return true;
+    }
+
     std::ptrdiff_t get_available_stack_space() noexcept
     {
         if (threads::thread_self const* self = threads::get_self_ptr())
@@ -19,6 +19,21 @@
 
 namespace hpx::threads {
 
+    ///////////////////////////////////////////////////////////////////////////
+    char const* get_admission_policy_name(admission_policy policy) noexcept
+    {
+        switch (policy)
+        {
+        case admission_policy::run_inline:
+            return "run_inline";
+        case admission_policy::suspend:
+            return "suspend";
+        case admission_policy::reject:
+            return "reject";
+        }
+        return "unknown";
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     thread_pool_base::thread_pool_base(thread_pool_init_parameters const& init)
       : id_(init.index_, init.name_)
@@ -0,0 +1,203 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Timed suspensions of threads are kept in the per-worker timing wheels of
+// the scheduler. This verifies that timers never fire early, that canceled
+// timers are removed from the wheels, that timed thread state changes not
+// bound to a suspension work as well, and that timers armed on a busy worker
+// thread are fired by the idle ones.
+
+#include <hpx/condition_variable.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t get_timer_count()
+{
+    return hpx::threads::get_self_id_data()
+        ->get_scheduler_base()
+        ->get_timer_count();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sleep_for()
+{
+    using clock = std::chrono::steady_clock;
+
+    std::atomic<std::size_t> early(0);
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        futures.push_back(hpx::async([i, &early]() {
+            auto const duration = std::chrono::microseconds(100 * (i % 50));
+            auto const start = clock::now();
+
+            hpx::this_thread::sleep_for(duration);
+
+            if (clock::now() - start < duration)
+            {
+                ++early;
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(early.load(), std::size_t(0));
+}
+
+void test_sleep_until_past()
+{
+    // a deadline in the past resumes the thread right away
+    hpx::this_thread::sleep_until(
+        std::chrono::steady_clock::now() - std::chrono::seconds(1));
+    hpx::this_thread::sleep_for(std::chrono::seconds(0));
+}
+
+void test_cancel()
+{
+    hpx::mutex mtx;
+    hpx::condition_variable cond;
+
+    std::size_t const timers_before = get_timer_count();
+
+    // the waiting threads are notified long before their timers expire,
+    // which disarms the timers
+    std::atomic<std::size_t> waiting(0);
+    std::vector<hpx::future<hpx::cv_status>> futures;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            std::unique_lock<hpx::mutex> l(mtx);
+            ++waiting;
+            return cond.wait_for(l, std::chrono::hours(1));
+        }));
+    }
+
+    hpx::util::yield_while([&]() { return waiting.load() != 100; });
+    {
+        std::lock_guard<hpx::mutex> l(mtx);
+        cond.notify_all();
+    }
+
+    for (auto& f : futures)
+    {
+        HPX_TEST(f.get() == hpx::cv_status::no_timeout);
+    }
+
+    HPX_TEST_EQ(get_timer_count(), timers_before);
+}
+
+void test_wait_for_timeout()
+{
+    hpx::mutex mtx;
+    hpx::condition_variable cond;
+
+    std::unique_lock<hpx::mutex> l(mtx);
+    HPX_TEST(cond.wait_for(l, std::chrono::milliseconds(10)) ==
+        hpx::cv_status::timeout);
+}
+
+void test_timed_thread_start()
+{
+    // the thread is resumed by a timer owned by the timing wheel
+    auto const start = std::chrono::steady_clock::now();
+    auto const delay = std::chrono::milliseconds(20);
+
+    hpx::future<int> f = hpx::make_ready_future_after(delay, 42);
+    HPX_TEST_EQ(f.get(), 42);
+    HPX_TEST(std::chrono::steady_clock::now() - start >= delay);
+}
+
+void test_interval_timer_stop()
+{
+    std::size_t const timers_before = get_timer_count();
+
+    // stopping the interval timer disarms its timer right away
+    hpx::util::interval_timer timer(
+        []() { return true; }, std::chrono::hours(1), "test_interval_timer");
+    timer.start(false);
+    HPX_TEST_EQ(get_timer_count(), timers_before + 1);
+
+    timer.stop();
+    HPX_TEST_EQ(get_timer_count(), timers_before);
+}
+
+void test_busy_owner()
+{
+    using clock = std::chrono::steady_clock;
+
+    auto const delay = std::chrono::milliseconds(10);
+    auto const busy = std::chrono::milliseconds(500);
+
+    // the timer is armed in the wheel of the worker thread running the
+    // sleeping thread, that worker thread is kept busy afterwards
+    hpx::future<clock::duration> f = hpx::async([&]() {
+        hpx::threads::thread_schedule_hint const hint(
+            hpx::threads::thread_schedule_hint_mode::thread,
+            static_cast<std::int16_t>(hpx::get_worker_thread_num()),
+            hpx::threads::thread_placement_hint::none,
+            hpx::threads::thread_execution_hint::none);
+        hpx::future<void> spin = hpx::async(
+            hpx::launch::async_policy(hpx::threads::thread_priority::boost,
+                hpx::threads::thread_stacksize::default_, hint),
+            [&]() {
+                auto const start = clock::now();
+                while (clock::now() - start < busy)
+                {
+                }
+            });
+
+        auto const start = clock::now();
+        hpx::this_thread::sleep_for(delay);
+        auto const elapsed = clock::now() - start;
+
+        spin.get();
+        return elapsed;
+    });
+
+    HPX_TEST(f.get() < busy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_sleep_for();
+    test_sleep_until_past();
+    test_cancel();
+    test_wait_for_timeout();
+    test_timed_thread_start();
+    test_interval_timer_stop();
+    test_busy_owner();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=4"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
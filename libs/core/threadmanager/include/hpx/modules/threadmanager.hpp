@@ -279,6 +279,9 @@ namespace hpx::threads {
         std::int64_t get_num_stolen_to_staged(bool reset) const;
 #endif
 
+        std::int64_t get_forced_yield_count(bool reset) const;
+        std::int64_t get_throttled_spawn_count(bool reset) const;
+
     private:
         policies::thread_queue_init_parameters get_init_parameters() const;
         void create_scheduler_user_defined(
@@ -293,6 +296,8 @@ namespace hpx::threads {
         void create_scheduler_local_priority_lifo(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_local_deadline(thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_static(thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_static_priority(
@@ -58,6 +58,28 @@ namespace hpx::threads {
                     "than number of threads (--hpx:threads)");
             }
         }
+
+        admission_policy get_admission_policy(std::string const& policy)
+        {
+            if (policy == "inline")
+            {
+                return admission_policy::run_inline;
+            }
+            if (policy == "suspend")
+            {
+                return admission_policy::suspend;
+            }
+            if (policy == "reject")
+            {
+                return admission_policy::reject;
+            }
+
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "threadmanager::create_pools",
+                "invalid admission policy: '{}', expected 'inline', "
+                "'suspend', or 'reject'",
+                policy);
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -230,6 +252,46 @@ namespace hpx::threads {
         pools_.push_back(HPX_MOVE(pool));
     }
 
+    void threadmanager::create_scheduler_local_deadline(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t numa_sensitive)
+    {
+        // set parameters for scheduler and pool instantiation and perform
+        // compatibility checks
+        std::size_t const num_high_priority_queues =
+            hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                "hpx.thread_queue.high_priority_queues",
+                thread_pool_init.num_threads_);
+
+        detail::check_num_high_priority_queues(
+            thread_pool_init.num_threads_, num_high_priority_queues);
+
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::local_deadline_queue_scheduler<>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            num_high_priority_queues, thread_queue_init,
+            "core-local_deadline_queue_scheduler");
+
+        auto sched = std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_scheduler_local_priority_lifo(
         [[maybe_unused]] thread_pool_init_parameters const& thread_pool_init,
         [[maybe_unused]] policies::thread_queue_init_parameters const&
@@ -654,6 +716,8 @@ namespace hpx::threads {
         std::size_t const max_busy_loop_count =
             hpx::util::get_entry_as<std::int64_t>(
                 rtcfg_, "hpx.max_busy_loop_count", HPX_BUSY_LOOP_COUNT_MAX);
+        std::uint64_t const time_slice = hpx::util::get_entry_as<std::uint64_t>(
+            rtcfg_, "hpx.time_slice", 0);
 
         std::size_t const numa_sensitive = hpx::util::get_entry_as<std::size_t>(
             rtcfg_, "hpx.numa_sensitive", 0);
@@ -745,11 +809,22 @@ namespace hpx::threads {
                 overall_background_work = network_background_callback_;
             }
 
+            // the admission control settings can be overridden for each pool
+            std::size_t const admission_limit =
+                hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                    "hpx.admission." + name + ".limit",
+                    hpx::util::get_entry_as<std::size_t>(
+                        rtcfg_, "hpx.admission.limit", 0));
+            admission_policy const policy =
+                detail::get_admission_policy(rtcfg_.get_entry(
+                    "hpx.admission." + name + ".policy",
+                    rtcfg_.get_entry("hpx.admission.policy", "suspend")));
+
             thread_pool_init_parameters thread_pool_init(name, i,
                 scheduler_mode, num_threads_in_pool, thread_offset, notifier_,
                 rp.get_affinity_data(), overall_background_work,
                 max_background_threads, max_idle_loop_count,
-                max_busy_loop_count);
+                max_busy_loop_count, 10, time_slice, admission_limit, policy);
 
             switch (sched_type)
             {
@@ -773,6 +848,11 @@ namespace hpx::threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::local_deadline:
+                create_scheduler_local_deadline(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             case resource::scheduling_policy::static_:
                 create_scheduler_static(
                     thread_pool_init, thread_queue_init, numa_sensitive);
@@ -1465,6 +1545,22 @@ namespace hpx::threads {
     }
 #endif
 
+    std::int64_t threadmanager::get_forced_yield_count(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_forced_yield_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_throttled_spawn_count(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_throttled_spawn_count(all_threads, reset);
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool threadmanager::run() const
     {
@@ -97,6 +97,7 @@ namespace hpx::actions {
         symbol_namespace_unbind_action_id,
         symbol_namespace_iterate_action_id,
         symbol_namespace_on_event_action_id,
+        symbol_namespace_invalidate_action_id,
         symbol_namespace_statistics_counter_action_id,
         terminate_action_id,
         terminate_all_action_id,
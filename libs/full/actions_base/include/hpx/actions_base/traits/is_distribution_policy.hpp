@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include <type_traits>
+#include <vector>
 
 namespace hpx::traits {
 
@@ -31,4 +32,18 @@ namespace hpx::traits {
             return policy.get_num_localities();
         }
     };
+
+    // By default, the elements of a container are evenly distributed over
+    // its partitions, which is represented by an empty list of partition
+    // sizes. Otherwise, the returned list holds the number of elements to
+    // place into each of the partitions.
+    template <typename Policy, typename Enable = void>
+    struct container_partition_sizes
+    {
+        static std::vector<std::size_t> call(
+            Policy const&, std::size_t /* size */)
+        {
+            return {};
+        }
+    };
 }    // namespace hpx::traits
@@ -81,13 +81,20 @@ namespace hpx { namespace agas {
         std::uint32_t console_cache_;
 
         std::size_t const max_refcnt_requests_;
+        std::size_t const max_refcnt_delay_;    // in milliseconds
 
         mutex_type refcnt_requests_mtx_;
         std::size_t refcnt_requests_count_;
         bool enable_refcnt_caching_;
+        bool refcnt_flush_scheduled_;
 
         std::shared_ptr<refcnt_requests_type> refcnt_requests_;
 
+        // statistics for the reference count requests
+        std::atomic<std::int64_t> refcnt_decrement_count_;
+        std::atomic<std::int64_t> refcnt_coalesced_count_;
+        std::atomic<std::int64_t> refcnt_message_count_;
+
         service_mode const service_type;
         runtime_mode const runtime_type;
 
@@ -247,7 +254,18 @@ namespace hpx { namespace agas {
         void send_refcnt_requests_sync(
             std::unique_lock<mutex_type>& l, error_code& ec);
 
+        /// Assumes that \a refcnt_requests_mtx_ is locked.
+        void schedule_refcnt_requests_flush(std::unique_lock<mutex_type>& l);
+
+        /// Send the pending requests once the maximum delay has expired.
+        void flush_refcnt_requests();
+
     public:
+        // Helper functions to access the reference count request statistics
+        std::int64_t get_refcnt_decrement_count(bool reset);
+        std::int64_t get_refcnt_coalesced_count(bool reset);
+        std::int64_t get_refcnt_message_count(bool reset);
+
         // Helper functions to access the current cache statistics
         std::uint64_t get_cache_entries(bool) const;
         std::uint64_t get_cache_hits(bool) const;
@@ -34,10 +34,14 @@
 #include <hpx/serialization/vector.hpp>
 #include <hpx/synchronization/shared_mutex.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading/thread.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -120,9 +124,14 @@ namespace hpx::agas {
       : gva_cache_(new gva_cache_type)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
+      , max_refcnt_delay_(ini_.get_agas_max_pending_refcnt_delay())
       , refcnt_requests_count_(0)
       , enable_refcnt_caching_(true)
+      , refcnt_flush_scheduled_(false)
       , refcnt_requests_(new refcnt_requests_type)
+      , refcnt_decrement_count_(0)
+      , refcnt_coalesced_count_(0)
+      , refcnt_message_count_(0)
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
@@ -333,6 +342,9 @@ namespace hpx::agas {
         {
             locality_ns_->free(gid);
             component_ns_->unregister_server_instance(ec);
+
+            // release all ids held by the cache of resolved names
+            symbol_ns_.get_service().clear_name_cache();
             symbol_ns_.unregister_server_instance(ec);
 
             remove_resolved_locality(gid);
@@ -1401,6 +1413,9 @@ namespace hpx::agas {
                 pending_decrefs = matches->second;
                 matches->second += credit;
 
+                // the incref was combined with a pending decref
+                ++refcnt_coalesced_count_;
+
                 // Increment requests need to be handled immediately.
 
                 // If the given incref was fully compensated by a pending decref
@@ -1488,6 +1503,8 @@ namespace hpx::agas {
             return;
         }
 
+        ++refcnt_decrement_count_;
+
         try
         {
             std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
@@ -1497,6 +1514,7 @@ namespace hpx::agas {
                 matches != refcnt_requests_->end())
             {
                 matches->second -= credit;
+                ++refcnt_coalesced_count_;
             }
             else
             {
@@ -1605,6 +1623,7 @@ namespace hpx::agas {
     {
         try
         {
+            symbol_ns_.get_service().invalidate(name);
             return symbol_ns_.unbind(name);
         }
         catch (hpx::exception const& e)
@@ -1617,6 +1636,7 @@ namespace hpx::agas {
     hpx::future<hpx::id_type> addressing_service::unregister_name_async(
         std::string const& name) const
     {
+        symbol_ns_.get_service().invalidate(name);
         return symbol_ns_.unbind_async(name);
     }
 
@@ -1626,6 +1646,11 @@ namespace hpx::agas {
     {
         try
         {
+            if (hpx::id_type id; caching_ &&
+                symbol_ns_.get_service().get_cached_name(name, id))
+            {
+                return id;
+            }
             return symbol_ns_.resolve(name);
         }
         catch (hpx::exception const& e)
@@ -1638,6 +1663,11 @@ namespace hpx::agas {
     hpx::future<hpx::id_type> addressing_service::resolve_name_async(
         std::string const& name) const
     {
+        if (hpx::id_type id;
+            caching_ && symbol_ns_.get_service().get_cached_name(name, id))
+        {
+            return hpx::make_ready_future(HPX_MOVE(id));
+        }
         return symbol_ns_.resolve_async(name);
     }
 
@@ -1659,15 +1689,39 @@ namespace hpx::agas {
     future<hpx::id_type> addressing_service::on_symbol_namespace_event(
         std::string const& name, bool call_for_past_events) const
     {
+        // names which are already bound can be resolved from the local cache
+        bool const use_cache = caching_ && call_for_past_events;
+
+        server::symbol_namespace& service = symbol_ns_.get_service();
+        std::uint64_t const epoch = service.get_cache_epoch();
+        if (hpx::id_type id; use_cache && service.get_cached_name(name, id))
+        {
+            return hpx::make_ready_future(HPX_MOVE(id));
+        }
+
         hpx::distributed::promise<hpx::id_type, naming::gid_type> p;
         auto result_f = p.get_future();
 
         hpx::future<bool> f =
             symbol_ns_.on_event(name, call_for_past_events, p.get_id());
 
-        return f.then(hpx::launch::sync,
+        hpx::future<hpx::id_type> result = f.then(hpx::launch::sync,
             util::one_shot(hpx::bind_back(
                 &detail::on_register_event, HPX_MOVE(result_f))));
+
+        if (!use_cache)
+        {
+            return result;
+        }
+
+        // the symbol namespace instance hosting the name will invalidate the
+        // cached entry once the name is unbound
+        return result.then(hpx::launch::sync,
+            [&service, name, epoch](hpx::future<hpx::id_type>&& f) {
+                hpx::id_type id = f.get();
+                service.cache_name(name, id, epoch);
+                return id;
+            });
     }
 
     // Return all matching entries in the symbol namespace
@@ -1922,6 +1976,23 @@ namespace hpx::agas {
         send_refcnt_requests_sync(l, ec);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Helper functions to access the reference count request statistics
+    std::int64_t addressing_service::get_refcnt_decrement_count(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_decrement_count_, reset);
+    }
+
+    std::int64_t addressing_service::get_refcnt_coalesced_count(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_coalesced_count_, reset);
+    }
+
+    std::int64_t addressing_service::get_refcnt_message_count(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_message_count_, reset);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */) const
@@ -2052,12 +2123,63 @@ namespace hpx::agas {
 
         if (!enable_refcnt_caching_ ||
             max_refcnt_requests_ == ++refcnt_requests_count_)
+        {
             send_refcnt_requests_non_blocking(l, ec);
+            return;
+        }
+
+        // make sure the buffered requests are sent after at most
+        // max_refcnt_delay_ milliseconds
+        if (max_refcnt_delay_ != 0 && !refcnt_flush_scheduled_)
+            schedule_refcnt_requests_flush(l);
 
-        else if (&ec != &throws)
+        if (&ec != &throws)
             ec = make_success_code();
     }
 
+    void addressing_service::schedule_refcnt_requests_flush(
+        [[maybe_unused]] std::unique_lock<mutex_type>& l)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        if (!threads::threadmanager_is(hpx::state::running))
+            return;
+
+        threads::thread_init_data data(
+            threads::make_thread_function_nullary(
+                [HPX_CXX20_CAPTURE_THIS(=)]() -> void {
+                    return flush_refcnt_requests();
+                }),
+            "addressing_service::flush_refcnt_requests",
+            threads::thread_priority::normal, threads::thread_schedule_hint(),
+            threads::thread_stacksize::default_,
+            threads::thread_schedule_state::pending, true);
+
+        error_code ec(throwmode::lightweight);
+        threads::register_thread(data, ec);
+
+        refcnt_flush_scheduled_ = !ec;
+    }
+
+    void addressing_service::flush_refcnt_requests()
+    {
+        hpx::this_thread::sleep_for(
+            std::chrono::milliseconds(max_refcnt_delay_));
+
+        std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+        refcnt_flush_scheduled_ = false;
+
+        error_code ec(throwmode::lightweight);
+        send_refcnt_requests_non_blocking(l, ec);
+        if (ec)
+        {
+            LAGAS_(error).format(
+                "addressing_service::flush_refcnt_requests, failed to send "
+                "reference count requests: {1}",
+                ec.get_message());
+        }
+    }
+
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void dump_refcnt_requests(
         std::unique_lock<addressing_service::mutex_type>& l,
@@ -2086,6 +2208,60 @@ namespace hpx::agas {
     }
 #endif
 
+    namespace {
+
+        using refcnt_bulk_requests_type = std::map<hpx::id_type,
+            std::vector<
+                hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>>>;
+
+        // Collect all requests for each locality. Consecutive gids which
+        // return the same amount of credits are combined into one range
+        // [lower, upper) to reduce the size of the bulk requests.
+        refcnt_bulk_requests_type collect_refcnt_requests(
+            addressing_service::refcnt_requests_type const& pending)
+        {
+            refcnt_bulk_requests_type requests;
+
+            std::vector<hpx::tuple<std::int64_t, naming::gid_type,
+                naming::gid_type>>* current = nullptr;
+
+            for (auto const& e : pending)
+            {
+                HPX_ASSERT(e.second < 0);
+
+                naming::gid_type const& raw = e.first;
+
+                if (current != nullptr)
+                {
+                    auto& last = current->back();
+
+                    naming::gid_type const& lower = hpx::get<1>(last);
+                    naming::gid_type& upper = hpx::get<2>(last);
+
+                    // a single gid is encoded as lower == upper
+                    naming::gid_type const next =
+                        lower == upper ? lower + 1 : upper;
+
+                    if (hpx::get<0>(last) == e.second && raw == next &&
+                        raw.get_msb() == lower.get_msb())
+                    {
+                        upper = raw + 1;
+                        continue;
+                    }
+                }
+
+                hpx::id_type const target(
+                    primary_namespace::get_service_instance(raw),
+                    hpx::id_type::management_type::unmanaged);
+
+                current = &requests[target];
+                current->emplace_back(e.second, raw, raw);
+            }
+
+            return requests;
+        }
+    }    // namespace
+
     // 26110: Caller failing to hold lock 'l' before calling function
 #if defined(HPX_MSVC)
 #pragma warning(push)
@@ -2124,23 +2300,9 @@ namespace hpx::agas {
 #endif
 
             // collect all requests for each locality
-            using requests_type = std::map<hpx::id_type,
-                std::vector<hpx::tuple<std::int64_t, naming::gid_type,
-                    naming::gid_type>>>;
-            requests_type requests;
-
-            for (refcnt_requests_type::const_reference e : *p)
-            {
-                HPX_ASSERT(e.second < 0);
-
-                naming::gid_type raw(e.first);
-
-                hpx::id_type target(
-                    primary_namespace::get_service_instance(raw),
-                    hpx::id_type::management_type::unmanaged);
-
-                requests[target].emplace_back(e.second, raw, raw);
-            }
+            refcnt_bulk_requests_type requests = collect_refcnt_requests(*p);
+            refcnt_message_count_ +=
+                static_cast<std::int64_t>(requests.size());
 
             // send requests to all locality
             auto const end = requests.end();
@@ -2195,23 +2357,11 @@ namespace hpx::agas {
 #endif
 
         // collect all requests for each locality
-        using requests_type = std::map<hpx::id_type,
-            std::vector<
-                hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>>>;
-        requests_type requests;
+        refcnt_bulk_requests_type requests = collect_refcnt_requests(*p);
+        refcnt_message_count_ += static_cast<std::int64_t>(requests.size());
 
         std::vector<hpx::future<std::vector<std::int64_t>>> lazy_results;
-        for (refcnt_requests_type::const_reference e : *p)
-        {
-            HPX_ASSERT(e.second < 0);
-
-            naming::gid_type raw(e.first);
-
-            hpx::id_type target(primary_namespace::get_service_instance(raw),
-                hpx::id_type::management_type::unmanaged);
-
-            requests[target].emplace_back(e.second, raw, raw);
-        }
+        lazy_results.reserve(requests.size());
 
         // send requests to all locality
         auto const end = requests.end();
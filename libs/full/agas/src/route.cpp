@@ -53,22 +53,14 @@ namespace hpx::agas::server {
         // resolve destination addresses, we should be able to resolve all of
         // them, otherwise it's an error
         {
-            std::unique_lock<primary_namespace::mutex_type> l(server.mutex());
-
             error_code& ec = throws;
 
-            // wait for any migration to be completed
-            if (naming::detail::is_migratable(gid))
-            {
-                server.wait_for_migration_locked(l, gid, ec);
-            }
-
-            cache_address = server.resolve_gid_locked(l, gid, ec);
+            // wait for any migration to be completed, no new migration may
+            // begin before the gid is resolved
+            cache_address = server.resolve_gid_after_migration(gid, ec);
 
             if (ec || hpx::get<0>(cache_address) == naming::invalid_gid)
             {
-                l.unlock();
-
                 HPX_THROWS_IF(ec, hpx::error::no_success,
                     "primary_namespace::route",
                     "can't route parcel to unknown gid: {}", gid);
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/datastructures/detail/small_vector.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::agas::server {
+
+    /// \brief Concurrent range index mapping (block allocated) global ids to
+    /// their global virtual addresses.
+    ///
+    /// The key space is split into buckets of 2^bucket_bits consecutive gids
+    /// (all sharing the same MSB), each bucket is assigned to one of the
+    /// shards. Every shard is an ordered map protected by its own lock. A
+    /// range of gids [base, base + count) which lies completely inside of one
+    /// bucket is stored in the shard of that bucket. The (rare) ranges
+    /// spanning more than one bucket are stored once in a separate ordered
+    /// map, which is consulted only if the shard does not contain the gid.
+    /// All lookups are performed by lower bound on the base gid of the
+    /// ranges.
+    struct HPX_EXPORT gva_table
+    {
+        using mutex_type = hpx::spinlock;
+
+        // gva and locality of a bound range
+        using data_type = std::pair<gva, naming::gid_type>;
+
+        // base gid, gva, and locality of a resolved gid
+        using resolved_type =
+            hpx::tuple<naming::gid_type, gva, naming::gid_type>;
+
+        static constexpr std::size_t num_shards = 64;
+        static constexpr std::uint64_t bucket_bits = 12;
+
+        enum class bind_result
+        {
+            inserted,            // a new range has been bound
+            updated,             // the binding of the range has been updated
+            count_mismatch,      // existing binding has different size
+            invalid_locality,    // update requires a valid locality
+            overlapping          // new range overlaps an existing one
+        };
+
+        enum class unbind_result
+        {
+            unbound,           // the range has been removed
+            not_found,         // there is no range starting at the given gid
+            count_mismatch,    // existing binding has different size
+        };
+
+        gva_table() = default;
+
+        gva_table(gva_table const&) = delete;
+        gva_table(gva_table&&) = delete;
+        gva_table& operator=(gva_table const&) = delete;
+        gva_table& operator=(gva_table&&) = delete;
+
+        // Bind the range [id, id + g.count) or update the binding if a range
+        // starting at the given id (with the same size) exists already. The
+        // id must have its internal bits stripped.
+        bind_result bind(naming::gid_type const& id, gva const& g,
+            naming::gid_type const& locality);
+
+        // Remove the range [id, id + count), the existing binding is returned
+        // in data. The id must have its internal bits stripped.
+        unbind_result unbind(
+            naming::gid_type const& id, std::uint64_t count, data_type& data);
+
+        // Find the range containing the given gid, returns an invalid base gid
+        // if the gid is not bound.
+        [[nodiscard]] resolved_type resolve(naming::gid_type const& id) const;
+
+        // Return the number of bound ranges.
+        [[nodiscard]] std::size_t size() const;
+
+    private:
+        // maps the base gid of each range to its binding
+        using map_type = std::map<naming::gid_type, data_type>;
+        using shard_indices_type = hpx::detail::small_vector<std::size_t, 4>;
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            map_type entries_;
+        };
+
+        static std::size_t shard_index(naming::gid_type const& id) noexcept;
+
+        // return whether the range spans more than one bucket
+        static bool is_large_range(
+            naming::gid_type const& id, std::uint64_t count) noexcept;
+
+        // return the (sorted) indices of all shards covered by the range
+        static shard_indices_type shard_indices(
+            naming::gid_type const& id, std::uint64_t count);
+
+        // holds the locks of all shards covered by a range
+        struct range_lock;
+
+        // find the entry covering the given gid in the given map
+        static map_type::const_iterator find(
+            map_type const& entries, naming::gid_type const& id);
+
+        // return whether any entry of the given map overlaps with the range
+        static bool overlaps(map_type const& entries,
+            naming::gid_type const& id, std::uint64_t count);
+
+        std::array<util::cache_aligned_data<shard>, num_shards> shards_;
+
+        // ranges spanning more than one bucket
+        mutable mutex_type large_mtx_;
+        map_type large_entries_;
+        std::atomic<std::size_t> num_large_entries_ = 0;
+    };
+}    // namespace hpx::agas::server
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -15,15 +15,18 @@
 #include <hpx/actions_base/component_action.hpp>
 #include <hpx/agas_base/agas_fwd.hpp>
 #include <hpx/agas_base/gva.hpp>
+#include <hpx/agas_base/server/gva_table.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/traits/action_get_embedded_parcel.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -119,25 +122,31 @@ namespace hpx::agas::server {
 
         using component_type = std::int32_t;
 
-        using gva_table_data_type = std::pair<gva, naming::gid_type>;
-        using gva_table_type = std::map<naming::gid_type, gva_table_data_type>;
+        using gva_table_data_type = gva_table::data_type;
+        using gva_table_type = gva_table;
         using refcnt_table_type = std::map<naming::gid_type, std::int64_t>;
 
-        using resolved_type =
-            hpx::tuple<naming::gid_type, gva, naming::gid_type>;
+        using resolved_type = gva_table::resolved_type;
 
-        mutex_type& mutex()
-        {
-            return mutex_;
-        }
+        static constexpr std::size_t num_refcnt_shards = 64;
 
     private:
-        // REVIEW: Separate mutexes might reduce contention here. This has to be
-        // investigated carefully.
-        mutex_type mutex_;
-
+        // The GVA table, the reference count table, and the migration table
+        // are protected by separate locks. The GVA table and the reference
+        // count table are additionally sharded. If the migration lock is held
+        // while accessing the GVA table it has to be acquired first.
         gva_table_type gvas_;
-        refcnt_table_type refcnts_;
+
+        struct refcnt_shard
+        {
+            mutex_type mtx_;
+            refcnt_table_type refcnts_;
+        };
+
+        std::array<util::cache_aligned_data<refcnt_shard>, num_refcnt_shards>
+            refcnts_;
+
+        refcnt_shard& get_refcnt_shard(naming::gid_type const& id) noexcept;
 
         using migration_table_type = std::map<naming::gid_type,
             hpx::tuple<bool, std::size_t,
@@ -146,6 +155,8 @@ namespace hpx::agas::server {
         std::string instance_name_;
         naming::gid_type next_id_;     // next available gid
         naming::gid_type locality_;    // our locality id
+
+        mutex_type migration_mtx_;
         migration_table_type migrating_objects_;
 
     public:
@@ -236,17 +247,23 @@ namespace hpx::agas::server {
 
     private:
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        /// Dump the credit counts of all matching ranges. Expects that \p l
-        /// is locked.
-        void dump_refcnt_matches(refcnt_table_type::iterator lower_it,
-            refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-            naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-            char const* func_name);
+        /// Dump the credit counts of all gids in the range [lower, upper).
+        void dump_refcnt_matches(naming::gid_type const& lower,
+            naming::gid_type const& upper, char const* func_name);
 #endif
 
+        // Expects that \p l holds the migration lock.
+        void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
+            naming::gid_type const& id, error_code& ec);
+
     public:
         // helper function
-        void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
+        void wait_for_migration(naming::gid_type const& id, error_code& ec);
+
+        // Wait for any migration of the given object to complete and resolve
+        // it while still holding the migration lock. This makes sure no
+        // migration can begin in between.
+        resolved_type resolve_gid_after_migration(
             naming::gid_type const& id, error_code& ec);
 
     public:
@@ -299,13 +316,12 @@ namespace hpx::agas::server {
         std::pair<naming::gid_type, naming::gid_type> allocate(
             std::uint64_t count);
 
-        resolved_type resolve_gid_locked(std::unique_lock<mutex_type>& l,
+        resolved_type resolve_gid_impl(
             naming::gid_type const& gid, error_code& ec);
 
     private:
-        resolved_type resolve_gid_locked_non_local(
-            std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
-            error_code& ec);
+        resolved_type resolve_gid_non_local(
+            naming::gid_type const& gid, error_code& ec);
 
         void increment(naming::gid_type const& lower,
             naming::gid_type const& upper, std::int64_t const& credits,
@@ -331,8 +347,7 @@ namespace hpx::agas::server {
         using free_entry_list_type =
             std::list<free_entry, free_entry_allocator_type>;
 
-        void resolve_free_list(std::unique_lock<mutex_type>& l,
-            std::list<refcnt_table_type::iterator> const& free_list,
+        void resolve_free_list(std::vector<naming::gid_type> const& free_list,
             free_entry_list_type& free_entry_list,
             naming::gid_type const& lower, naming::gid_type const& upper,
             error_code& ec);
@@ -15,16 +15,21 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <array>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -48,16 +53,48 @@ namespace hpx::agas::server {
         using iterate_names_return_type =
             std::map<std::string, naming::gid_type>;
 
-        using gid_table_type =
-            std::map<std::string, std::shared_ptr<naming::gid_type>>;
+        struct gid_entry
+        {
+            std::shared_ptr<naming::gid_type> gid_;
+
+            // remote localities which may have cached the resolved name
+            std::vector<std::uint32_t> cached_by_;
+        };
+
+        using gid_table_type = std::unordered_map<std::string, gid_entry>;
 
         using on_event_data_map_type = std::multimap<std::string, hpx::id_type>;
 
+        // names resolved through this locality, which may be hosted by the
+        // symbol namespace instance of any locality
+        using name_cache_type = std::unordered_map<std::string, hpx::id_type>;
+
+        // The names are distributed over the shards based on their hash
+        // value. Each shard is protected by its own lock, all data related to
+        // a name is stored in the same shard.
+        static constexpr std::size_t num_shards = 32;
+
     private:
-        mutex_type mutex_;
-        gid_table_type gids_;
+        struct shard
+        {
+            mutex_type mtx_;
+            gid_table_type gids_;
+            on_event_data_map_type on_event_data_;
+            name_cache_type cached_names_;
+        };
+
+        shard& get_shard(std::string const& key) noexcept;
+
+        // remember the locality of the given LCO as (potentially) caching
+        // the name stored in the given entry
+        void add_cached_by(gid_entry& entry, hpx::id_type const& lco) const;
+
+        std::array<util::cache_aligned_data<shard>, num_shards> shards_;
+
+        // incremented for each invalidation of a cached name
+        std::atomic<std::uint64_t> cache_epoch_{0};
+
         std::string instance_name_;
-        on_event_data_map_type on_event_data_;
 
     public:
         // data structure holding all counters for the component_namespace component
@@ -144,11 +181,33 @@ namespace hpx::agas::server {
         bool on_event(std::string const& name, bool call_for_past_events,
             hpx::id_type const& lco);
 
+        // Remove the given name from the cache of resolved names. This is
+        // invoked by the symbol namespace instance hosting the name whenever
+        // the name is unbound.
+        void invalidate(std::string const& key);
+
+        ///////////////////////////////////////////////////////////////////////
+        // Access the locality-local cache of resolved names. A name is cached
+        // only if the cache epoch has not changed since the name resolution
+        // was started (i.e. if no invalidation could have been missed).
+        [[nodiscard]] std::uint64_t get_cache_epoch() const noexcept
+        {
+            return cache_epoch_.load(std::memory_order_acquire);
+        }
+
+        bool get_cached_name(std::string const& key, hpx::id_type& id);
+
+        void cache_name(std::string const& key, hpx::id_type const& id,
+            std::uint64_t epoch);
+
+        void clear_name_cache();
+
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, bind)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, resolve)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, unbind)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, iterate)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, on_event)
+        HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, invalidate)
     };
 }    // namespace hpx::agas::server
 
@@ -185,4 +244,11 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::symbol_namespace::on_event_action,
     symbol_namespace_on_event_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::invalidate_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::invalidate_action,
+    symbol_namespace_invalidate_action)
+
 #include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,293 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/config.hpp>
+#include <hpx/agas_base/server/gva_table.hpp>
+#include <hpx/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace hpx::agas::server {
+
+    namespace {
+
+        constexpr std::uint64_t bucket_size = std::uint64_t(1)
+            << gva_table::bucket_bits;
+
+        // an empty range still occupies its base gid
+        constexpr std::uint64_t get_span(std::uint64_t count) noexcept
+        {
+            return count != 0 ? count : 1;
+        }
+
+        // return the first gid of the bucket containing the given gid
+        naming::gid_type bucket_base(naming::gid_type const& id) noexcept
+        {
+            return naming::gid_type(
+                id.get_msb(), id.get_lsb() & ~(bucket_size - 1));
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct gva_table::range_lock
+    {
+        range_lock(gva_table& table, naming::gid_type const& id,
+            std::uint64_t count)
+          : table_(table)
+          , indices_(shard_indices(id, count))
+        {
+            for (std::size_t const i : indices_)
+            {
+                table_.shards_[i].data_.mtx_.lock();
+            }
+        }
+
+        range_lock(range_lock const&) = delete;
+        range_lock(range_lock&&) = delete;
+        range_lock& operator=(range_lock const&) = delete;
+        range_lock& operator=(range_lock&&) = delete;
+
+        ~range_lock()
+        {
+            for (auto it = indices_.rbegin(); it != indices_.rend(); ++it)
+            {
+                table_.shards_[*it].data_.mtx_.unlock();
+            }
+        }
+
+        gva_table& table_;
+        shard_indices_type const indices_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t gva_table::shard_index(naming::gid_type const& id) noexcept
+    {
+        // consecutive buckets are assigned to consecutive shards, the MSB
+        // (which mainly encodes the locality) selects the first shard
+        std::uint64_t const msb_hash =
+            (id.get_msb() * 0x9e3779b97f4a7c15ULL) >> 32;
+        return static_cast<std::size_t>(
+            ((id.get_lsb() >> bucket_bits) + msb_hash) % num_shards);
+    }
+
+    bool gva_table::is_large_range(
+        naming::gid_type const& id, std::uint64_t count) noexcept
+    {
+        return bucket_base(id) != bucket_base(id + (get_span(count) - 1));
+    }
+
+    gva_table::shard_indices_type gva_table::shard_indices(
+        naming::gid_type const& id, std::uint64_t count)
+    {
+        shard_indices_type indices;
+
+        std::uint64_t const first_bucket = id.get_lsb() >> bucket_bits;
+        std::uint64_t const last_bucket =
+            (id.get_lsb() + (get_span(count) - 1)) >> bucket_bits;
+
+        if (last_bucket - first_bucket + 1 >= num_shards)
+        {
+            indices.reserve(num_shards);
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                indices.push_back(i);
+            }
+            return indices;
+        }
+
+        naming::gid_type bucket = bucket_base(id);
+        for (std::uint64_t b = first_bucket; b <= last_bucket; ++b)
+        {
+            indices.push_back(shard_index(bucket));
+            bucket += bucket_size;
+        }
+
+        std::sort(indices.begin(), indices.end());
+        indices.erase(
+            std::unique(indices.begin(), indices.end()), indices.end());
+
+        return indices;
+    }
+
+    gva_table::map_type::const_iterator gva_table::find(
+        map_type const& entries, naming::gid_type const& id)
+    {
+        auto const end = entries.end();
+
+        // the closest range starting at or below the given id is the only
+        // candidate containing it
+        auto it = entries.upper_bound(id);
+        if (it == entries.begin())
+            return end;
+
+        --it;
+        if (it->first == id || it->first + it->second.first.count > id)
+            return it;
+
+        return end;
+    }
+
+    bool gva_table::overlaps(map_type const& entries,
+        naming::gid_type const& id, std::uint64_t count)
+    {
+        if (find(entries, id) != entries.end())
+            return true;
+
+        auto const it = entries.lower_bound(id);
+        return it != entries.end() && it->first <= id + (get_span(count) - 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_table::bind_result gva_table::bind(naming::gid_type const& id,
+        gva const& g, naming::gid_type const& locality)
+    {
+        bool const large = is_large_range(id, g.count);
+
+        // Lock all shards covered by the new range (in ascending order) and
+        // the table of large ranges, any existing range overlapping with the
+        // new one is visible while holding those locks. Large ranges are
+        // counted while holding the locks of all shards they cover, thus a
+        // range inside of a single bucket has to consult the table of large
+        // ranges only if there are any.
+        range_lock l(*this, id, g.count);
+        std::unique_lock<mutex_type> ll(large_mtx_, std::defer_lock);
+        bool const check_large =
+            large || num_large_entries_.load(std::memory_order_acquire) != 0;
+        if (check_large)
+        {
+            ll.lock();
+        }
+
+        map_type& entries =
+            large ? large_entries_ : shards_[shard_index(id)].data_.entries_;
+
+        // If we got an exact match, this is a request to update an existing
+        // binding (e.g. move semantics).
+        if (auto const it = entries.find(id); it != entries.end())
+        {
+            // we can't change block sizes of existing bindings
+            if (it->second.first.count != g.count)
+                return bind_result::count_mismatch;
+
+            if (!locality)
+                return bind_result::invalid_locality;
+
+            it->second = data_type(g, locality);
+            return bind_result::updated;
+        }
+
+        // an existing range of a different size may start at the same gid
+        if (large)
+        {
+            map_type const& other = shards_[shard_index(id)].data_.entries_;
+            if (other.find(id) != other.end())
+                return bind_result::count_mismatch;
+        }
+        else if (check_large && large_entries_.find(id) != large_entries_.end())
+        {
+            return bind_result::count_mismatch;
+        }
+
+        if (check_large && overlaps(large_entries_, id, g.count))
+            return bind_result::overlapping;
+
+        for (std::size_t const i : l.indices_)
+        {
+            if (overlaps(shards_[i].data_.entries_, id, g.count))
+                return bind_result::overlapping;
+        }
+
+        entries.emplace(id, data_type(g, locality));
+        if (large)
+        {
+            num_large_entries_.fetch_add(1, std::memory_order_release);
+        }
+        return bind_result::inserted;
+    }
+
+    gva_table::unbind_result gva_table::unbind(
+        naming::gid_type const& id, std::uint64_t count, data_type& data)
+    {
+        bool const large = is_large_range(id, count);
+
+        shard& s = shards_[shard_index(id)].data_;
+        std::unique_lock<mutex_type> l(large ? large_mtx_ : s.mtx_);
+
+        map_type& entries = large ? large_entries_ : s.entries_;
+
+        auto const it = entries.find(id);
+        if (it == entries.end())
+        {
+            // a range with a different size starting at the same gid may be
+            // stored in the other table
+            l.unlock();
+
+            std::lock_guard<mutex_type> ol(large ? s.mtx_ : large_mtx_);
+            map_type const& other = large ? s.entries_ : large_entries_;
+            return other.find(id) != other.end() ?
+                unbind_result::count_mismatch :
+                unbind_result::not_found;
+        }
+
+        if (it->second.first.count != count)
+            return unbind_result::count_mismatch;
+
+        data = it->second;
+        entries.erase(it);
+
+        if (large)
+        {
+            num_large_entries_.fetch_sub(1, std::memory_order_release);
+        }
+        return unbind_result::unbound;
+    }
+
+    gva_table::resolved_type gva_table::resolve(
+        naming::gid_type const& id) const
+    {
+        {
+            shard const& s = shards_[shard_index(id)].data_;
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            if (auto const it = find(s.entries_, id); it != s.entries_.end())
+            {
+                return resolved_type(
+                    it->first, it->second.first, it->second.second);
+            }
+        }
+
+        if (num_large_entries_.load(std::memory_order_acquire) != 0)
+        {
+            std::lock_guard<mutex_type> l(large_mtx_);
+            if (auto const it = find(large_entries_, id);
+                it != large_entries_.end())
+            {
+                return resolved_type(
+                    it->first, it->second.first, it->second.second);
+            }
+        }
+
+        return resolved_type(naming::invalid_gid, gva(), naming::invalid_gid);
+    }
+
+    std::size_t gva_table::size() const
+    {
+        std::size_t size = 0;
+        for (auto const& s : shards_)
+        {
+            std::lock_guard<mutex_type> l(s.data_.mtx_);
+            size += s.data_.entries_.size();
+        }
+        return size + num_large_entries_.load(std::memory_order_acquire);
+    }
+}    // namespace hpx::agas::server
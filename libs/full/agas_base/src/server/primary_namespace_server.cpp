@@ -92,10 +92,10 @@ namespace hpx::agas::server {
         counter_data_.increment_begin_migration_count();
         using hpx::get;
 
-        std::unique_lock<mutex_type> l(mutex_);
+        std::unique_lock<mutex_type> l(migration_mtx_);
 
         wait_for_migration_locked(l, id, hpx::throws);
-        resolved_type r = resolve_gid_locked_non_local(l, id, hpx::throws);
+        resolved_type r = resolve_gid_non_local(id, hpx::throws);
         if (get<0>(r) == naming::invalid_gid)
         {
             l.unlock();
@@ -132,7 +132,7 @@ namespace hpx::agas::server {
     }
 
     // migration of the given object is complete
-    // 26115: Failing to release lock 'this->mutex_' in function
+    // 26115: Failing to release lock 'this->migration_mtx_' in function
 #if defined(HPX_MSVC)
 #pragma warning(push)
 #pragma warning(disable : 26115)
@@ -144,7 +144,7 @@ namespace hpx::agas::server {
             counter_data_.end_migration_.enabled_);
         counter_data_.increment_end_migration_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        std::unique_lock<mutex_type> l(migration_mtx_);
 
         using hpx::get;
 
@@ -170,6 +170,32 @@ namespace hpx::agas::server {
 #endif
 
     // wait if given object is currently being migrated
+    void primary_namespace::wait_for_migration(
+        naming::gid_type const& id, error_code& ec)
+    {
+        std::unique_lock<mutex_type> l(migration_mtx_);
+        wait_for_migration_locked(l, id, ec);
+    }
+
+    primary_namespace::resolved_type
+    primary_namespace::resolve_gid_after_migration(
+        naming::gid_type const& id, error_code& ec)
+    {
+        if (!naming::detail::is_migratable(id))
+        {
+            return resolve_gid_impl(id, ec);
+        }
+
+        std::unique_lock<mutex_type> l(migration_mtx_);
+        wait_for_migration_locked(l, id, ec);
+        if (ec)
+        {
+            return resolved_type(
+                naming::invalid_gid, gva(), naming::invalid_gid);
+        }
+        return resolve_gid_impl(id, ec);
+    }
+
     void primary_namespace::wait_for_migration_locked(
         std::unique_lock<mutex_type>& l, naming::gid_type const& id,
         error_code& ec)
@@ -213,124 +239,26 @@ namespace hpx::agas::server {
         naming::gid_type const gid = id;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
-
-        auto const begin = gvas_.begin();
-        auto const end = gvas_.end();
-
-        if (auto it = gvas_.lower_bound(id); it != end)
+        // non-migratable gids don't need to be bound
+        if (naming::refers_to_local_lva(gid) &&
+            !naming::refers_to_virtual_memory(gid))
         {
-            // If we got an exact match, this is a request to update an existing
-            // binding (e.g. move semantics).
-            if (it->first == id)
-            {
-                // non-migratable gids can't be rebound
-                if (naming::refers_to_local_lva(gid) &&
-                    !naming::refers_to_virtual_memory(gid))
-                {
-                    l.unlock();
-
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "cannot rebind gids for non-migratable objects");
-                }
-
-                gva& gaddr = it->second.first;
-                naming::gid_type& loc = it->second.second;
-
-                // Check for count mismatch (we can't change block sizes of
-                // existing bindings).
-                if (HPX_UNLIKELY(gaddr.count != g.count))
-                {
-                    // REVIEW: Is this the right error code to use?
-                    l.unlock();
-
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "cannot change block size of existing binding");
-                }
-
-                if (HPX_UNLIKELY(
-                        to_int(hpx::components::component_enum_type::invalid) ==
-                        g.type))
-                {
-                    l.unlock();
-
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "attempt to update a GVA with an invalid type, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality);
-                }
-
-                if (HPX_UNLIKELY(!locality))
-                {
-                    l.unlock();
-
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "attempt to update a GVA with an invalid "
-                        "locality id, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality);
-                }
-
-                // Store the new endpoint and offset
-                gaddr.prefix = g.prefix;
-                gaddr.type = g.type;
-                gaddr.lva(g.lva());
-                gaddr.offset = g.offset;
-                loc = locality;
-
-                l.unlock();
-
-                LAGAS_(info).format(
-                    "primary_namespace::bind_gid, gid({1}), gva({2}), "
-                    "locality({3}), response(repeated_request)",
-                    id, g, locality);
-
-                return false;
-            }
-
-            // We're about to decrement the iterator it - first, we
-            // check that it's safe to do this.
-            else if (it != begin)
+            resolved_type const r = gvas_.resolve(id);
+            if (get<0>(r) == id)
             {
-                --it;
-
-                // Check that a previous range doesn't cover the new id.
-                if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
-                {
-                    // REVIEW: Is this the right error code to use?
-                    l.unlock();
-
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "the new GID is contained in an existing range");
-                }
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "primary_namespace::bind_gid",
+                    "cannot rebind gids for non-migratable objects");
             }
-        }
-
-        else if (HPX_LIKELY(!gvas_.empty()))
-        {
-            --it;
 
-            // Check that a previous range doesn't cover the new id.
-            if ((it->first + it->second.first.count) > id)
+            if (get<0>(r) != naming::invalid_gid)
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
-
                 HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                     "primary_namespace::bind_gid",
                     "the new GID is contained in an existing range");
             }
-        }
 
-        // non-migratable gids don't need to be bound
-        if (naming::refers_to_local_lva(gid) &&
-            !naming::refers_to_virtual_memory(gid))
-        {
             LAGAS_(info).format(
                 "primary_namespace::bind_gid, gid({1}), gva({2}), "
                 "locality({3})",
@@ -343,8 +271,6 @@ namespace hpx::agas::server {
 
         if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
         {
-            l.unlock();
-
             HPX_THROW_EXCEPTION(hpx::error::internal_server_error,
                 "primary_namespace::bind_gid",
                 "MSBs of lower and upper range bound do not match");
@@ -354,29 +280,47 @@ namespace hpx::agas::server {
                 to_int(hpx::components::component_enum_type::invalid) ==
                 g.type))
         {
-            l.unlock();
-
             HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                 "primary_namespace::bind_gid",
-                "attempt to insert a GVA with an invalid type, "
+                "attempt to bind a GVA with an invalid type, "
                 "gid({1}), gva({2}), locality({3})",
                 id, g, locality);
         }
 
-        // Insert a GID -> GVA entry into the GVA table.
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gvas_.emplace(id, std::make_pair(g, locality)))))
+        switch (gvas_.bind(id, g, locality))
         {
-            l.unlock();
+        case gva_table::bind_result::inserted:
+            break;
 
-            HPX_THROW_EXCEPTION(hpx::error::lock_error,
+        case gva_table::bind_result::updated:
+            // An existing binding has been updated (e.g. move semantics).
+            LAGAS_(info).format(
+                "primary_namespace::bind_gid, gid({1}), gva({2}), "
+                "locality({3}), response(repeated_request)",
+                id, g, locality);
+
+            return false;
+
+        case gva_table::bind_result::count_mismatch:
+            // REVIEW: Is this the right error code to use?
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                 "primary_namespace::bind_gid",
-                "GVA table insertion failed due to a locking error or "
-                "memory corruption, gid({1}), gva({2}), locality({3})",
+                "cannot change block size of existing binding");
+
+        case gva_table::bind_result::invalid_locality:
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "primary_namespace::bind_gid",
+                "attempt to update a GVA with an invalid "
+                "locality id, "
+                "gid({1}), gva({2}), locality({3})",
                 id, g, locality);
-        }
 
-        l.unlock();
+        case gva_table::bind_result::overlapping:
+            // REVIEW: Is this the right error code to use?
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "primary_namespace::bind_gid",
+                "the new GID is contained in an existing range");
+        }
 
         LAGAS_(info).format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
@@ -415,16 +359,8 @@ namespace hpx::agas::server {
         }
         else
         {
-            std::unique_lock<mutex_type> l(mutex_);
-
-            // wait for any migration to be completed
-            if (naming::detail::is_migratable(id))
-            {
-                wait_for_migration_locked(l, id, hpx::throws);
-            }
-
-            // now, resolve the id
-            r = resolve_gid_locked_non_local(l, id, hpx::throws);
+            // wait for any migration to be completed, then resolve the id
+            r = resolve_gid_after_migration(id, hpx::throws);
         }
 
         if (get<0>(r) == naming::invalid_gid)
@@ -461,24 +397,17 @@ namespace hpx::agas::server {
 
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        gva_table_data_type data;
+        gva_table::unbind_result const result = gvas_.unbind(id, count, data);
 
-        auto const it = gvas_.find(id);
-        if (auto const end = gvas_.end(); it != end)
+        if (HPX_UNLIKELY(result == gva_table::unbind_result::count_mismatch))
         {
-            if (HPX_UNLIKELY(it->second.first.count != count))
-            {
-                l.unlock();
-
-                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                    "primary_namespace::unbind_gid", "block sizes must match");
-            }
-
-            gva_table_data_type const data = it->second;
-
-            gvas_.erase(it);
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "primary_namespace::unbind_gid", "block sizes must match");
+        }
 
-            l.unlock();
+        if (result == gva_table::unbind_result::unbound)
+        {
             LAGAS_(info).format(
                 "primary_namespace::unbind_gid, gid({1}), count({2}), "
                 "gva({3}), locality_id({4})",
@@ -506,8 +435,6 @@ namespace hpx::agas::server {
             return {g.prefix, g.type, g.lva()};
         }
 
-        l.unlock();
-
         LAGAS_(info).format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), "
             "response(no_success)",
@@ -558,7 +485,7 @@ namespace hpx::agas::server {
         {
             std::int64_t credits = hpx::get<0>(req);
             naming::gid_type lower = hpx::get<1>(req);
-            naming::gid_type upper = hpx::get<1>(req);
+            naming::gid_type upper = hpx::get<2>(req);
 
             naming::detail::strip_internal_bits_from_gid(lower);
             naming::detail::strip_internal_bits_from_gid(upper);
@@ -647,32 +574,39 @@ namespace hpx::agas::server {
         return std::make_pair(lower, upper);
     }    // }}}
 
+    primary_namespace::refcnt_shard& primary_namespace::get_refcnt_shard(
+        naming::gid_type const& id) noexcept
+    {
+        // consecutive gids are assigned to different shards
+        std::uint64_t const hash =
+            id.get_lsb() ^ ((id.get_msb() * 0x9e3779b97f4a7c15ULL) >> 32);
+        return refcnts_[hash % num_refcnt_shards].data_;
+    }
+
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it,
-        refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-        naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-        char const* func_name)
+    void primary_namespace::dump_refcnt_matches(naming::gid_type const& lower,
+        naming::gid_type const& upper, char const* func_name)
     {
         // dump_refcnt_matches implementation
-        HPX_ASSERT(l.owns_lock());
-
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
-            // We got nothing, bail - our caller is probably about to throw.
-            return;
-
         std::stringstream ss;
         hpx::util::format_to(ss,
             "{1}, dumping server-side refcnt table matches, lower({2}), "
             "upper({3}):",
             func_name, lower, upper);
 
-        for (/**/; lower_it != upper_it; ++lower_it)
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
-            // The [server] tag is in there to make it easier to filter
-            // through the logs.
-            hpx::util::format_to(ss, "\n  [server] lower({1}), credits({2})",
-                lower_it->first, lower_it->second);
+            refcnt_shard& s = get_refcnt_shard(raw);
+
+            std::unique_lock<mutex_type> l(s.mtx_);
+            if (auto const it = s.refcnts_.find(raw); it != s.refcnts_.end())
+            {
+                // The [server] tag is in there to make it easier to filter
+                // through the logs.
+                hpx::util::format_to(ss,
+                    "\n  [server] lower({1}), credits({2})", it->first,
+                    it->second);
+            }
         }
 
         LAGAS_(debug) << ss.str();
@@ -684,28 +618,10 @@ namespace hpx::agas::server {
         naming::gid_type const& upper, std::int64_t const& credits,
         error_code& ec)
     {    // {{{ increment implementation
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         if (LAGAS_ENABLED(debug))
         {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we're about to touch.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::increment");
+            dump_refcnt_matches(lower, upper, "primary_namespace::increment");
         }
 #endif
 
@@ -721,15 +637,20 @@ namespace hpx::agas::server {
 
         for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
-            auto it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            refcnt_shard& s = get_refcnt_shard(raw);
+
+            std::unique_lock<mutex_type> l(s.mtx_);
+
+            auto it = s.refcnts_.find(raw);
+            if (it == s.refcnts_.end())
             {
                 std::int64_t count =
                     static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL) +
                     credits;
 
                 std::pair<refcnt_table_type::iterator, bool> const p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
+                    s.refcnts_.insert(
+                        refcnt_table_type::value_type(raw, count));
                 if (!p.second)
                 {
                     l.unlock();
@@ -749,9 +670,13 @@ namespace hpx::agas::server {
                 it->second += credits;
             }
 
+            std::int64_t const refcnt = it->second;
+
+            l.unlock();
+
             LAGAS_(info).format(
                 "primary_namespace::increment, raw({1}), refcnt({2})", lower,
-                it->second);
+                refcnt);
         }
 
         if (&ec != &throws)
@@ -759,46 +684,24 @@ namespace hpx::agas::server {
     }    // }}}
 
     ///////////////////////////////////////////////////////////////////////////////
-    // 26110: Caller failing to hold lock 'l' before calling function
-#if defined(HPX_MSVC)
-#pragma warning(push)
-#pragma warning(disable : 26110)
-#endif
-    void primary_namespace::resolve_free_list(std::unique_lock<mutex_type>& l,
-        std::list<refcnt_table_type::iterator> const& free_list,
+    void primary_namespace::resolve_free_list(
+        std::vector<naming::gid_type> const& free_list,
         free_entry_list_type& free_entry_list,
         naming::gid_type const& /* lower */,
         naming::gid_type const& /* upper */, error_code& ec)
     {
-        HPX_ASSERT_OWNS_LOCK(l);
-
         using hpx::get;
 
-        using iterator = refcnt_table_type::iterator;
-
-        for (iterator const& it : free_list)
+        for (naming::gid_type const& gid : free_list)
         {
-            using key_type = refcnt_table_type::key_type;
-
-            // The mapping's key space.
-            key_type gid = it->first;
-
-            if (naming::detail::is_migratable(gid))
-            {
-                // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
-            }
-
-            // Resolve the query GID.
-            resolved_type r = resolve_gid_locked(l, gid, ec);
+            // Resolve the query GID after any migration has completed.
+            resolved_type r = resolve_gid_after_migration(gid, ec);
             if (ec)
                 return;
 
             naming::gid_type& raw = get<0>(r);
             if (raw == naming::invalid_gid)
             {
-                l.unlock();
-
                 HPX_THROWS_IF(ec, hpx::error::internal_server_error,
                     "primary_namespace::resolve_free_list",
                     "primary_namespace::resolve_free_list, failed to resolve "
@@ -815,8 +718,6 @@ namespace hpx::agas::server {
                     to_int(hpx::components::component_enum_type::invalid) ==
                     g.type))
             {
-                l.unlock();
-
                 HPX_THROWS_IF(ec, hpx::error::internal_server_error,
                     "primary_namespace::resolve_free_list",
                     "encountered a GVA with an invalid type while performing a "
@@ -826,8 +727,6 @@ namespace hpx::agas::server {
             }
             else if (HPX_UNLIKELY(0 == g.count))
             {
-                l.unlock();
-
                 HPX_THROWS_IF(ec, hpx::error::internal_server_error,
                     "primary_namespace::resolve_free_list",
                     "encountered a GVA with a count of zero while performing a "
@@ -849,12 +748,16 @@ namespace hpx::agas::server {
             free_entry_list.emplace_back(resolved, gid, get<2>(r));
 
             // remove this entry from the refcnt table
-            refcnts_.erase(it);
+            refcnt_shard& s = get_refcnt_shard(gid);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            if (auto const it = s.refcnts_.find(gid);
+                it != s.refcnts_.end() && it->second == 0)
+            {
+                s.refcnts_.erase(it);
+            }
         }
     }
-#if defined(HPX_MSVC)
-#pragma warning(pop)
-#endif
 
     ///////////////////////////////////////////////////////////////////////////////
     void primary_namespace::decrement_sweep(
@@ -868,110 +771,98 @@ namespace hpx::agas::server {
 
         free_entry_list.clear();
 
-        {
-            std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-            if (LAGAS_ENABLED(debug))
-            {
-                typedef refcnt_table_type::iterator iterator;
+        if (LAGAS_ENABLED(debug))
+        {
+            dump_refcnt_matches(
+                lower, upper, "primary_namespace::decrement_sweep");
+        }
+#endif
 
-                // Find the mappings that we just added or modified.
-                refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-                refcnt_table_type::iterator upper_it;
-                if (lower != upper)
-                {
-                    upper_it = refcnts_.find(upper);
-                }
-                else
-                {
-                    upper_it = lower_it;
-                    ++upper_it;
-                }
+        ///////////////////////////////////////////////////////////////////////
+        // Apply the decrement across the entire key space (e.g. [lower, upper]).
 
-                dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                    "primary_namespace::decrement_sweep");
-            }
-#endif
+        // The third parameter we pass here is the default data to use in case
+        // the key is not mapped. We don't insert GIDs into the refcnt table
+        // when we allocate/bind them, so if a GID is not in the refcnt table,
+        // we know that it's global reference count is the initial global
+        // reference count.
 
-            ///////////////////////////////////////////////////////////////////////
-            // Apply the decrement across the entire key space (e.g. [lower, upper]).
+        std::vector<naming::gid_type> free_list;
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        {
+            refcnt_shard& s = get_refcnt_shard(raw);
 
-            // The third parameter we pass here is the default data to use in case
-            // the key is not mapped. We don't insert GIDs into the refcnt table
-            // when we allocate/bind them, so if a GID is not in the refcnt table,
-            // we know that it's global reference count is the initial global
-            // reference count.
+            std::unique_lock<mutex_type> l(s.mtx_);
 
-            std::list<refcnt_table_type::iterator> free_list;    //-V826
-            for (naming::gid_type raw = lower; raw != upper; ++raw)
+            auto it = s.refcnts_.find(raw);
+            if (it == s.refcnts_.end())
             {
-                auto it = refcnts_.find(raw);
-                if (it == refcnts_.end())
+                if (credits >
+                    static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL))
                 {
-                    if (credits >
-                        static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL))
-                    {
-                        l.unlock();
-
-                        HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                            "primary_namespace::decrement_sweep",
-                            "negative entry in reference count table, "
-                            "raw({1}), refcount({2})",
-                            raw,
-                            static_cast<std::int64_t>(
-                                HPX_GLOBALCREDIT_INITIAL) -
-                                credits);
-                        return;
-                    }
-
-                    std::int64_t count =
+                    l.unlock();
+
+                    HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                        "primary_namespace::decrement_sweep",
+                        "negative entry in reference count table, "
+                        "raw({1}), refcount({2})",
+                        raw,
                         static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL) -
-                        credits;
-
-                    std::pair<refcnt_table_type::iterator, bool> const p =
-                        refcnts_.emplace(raw, count);
-                    if (!p.second)
-                    {
-                        l.unlock();
-
-                        HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                            "primary_namespace::decrement_sweep",
-                            "couldn't create entry in reference count table, "
-                            "raw({1}), ref-count({2})",
-                            raw, count);
-                        return;
-                    }
-
-                    it = p.first;
-                }
-                else
-                {
-                    it->second -= credits;
+                            credits);
+                    return;
                 }
 
-                // Sanity check.
-                if (it->second < 0)
+                std::int64_t count =
+                    static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL) -
+                    credits;
+
+                std::pair<refcnt_table_type::iterator, bool> const p =
+                    s.refcnts_.emplace(raw, count);
+                if (!p.second)
                 {
                     l.unlock();
 
                     HPX_THROWS_IF(ec, hpx::error::invalid_data,
                         "primary_namespace::decrement_sweep",
-                        "negative entry in reference count table, raw({1}), "
-                        "refcount({2})",
-                        raw, it->second);
+                        "couldn't create entry in reference count table, "
+                        "raw({1}), ref-count({2})",
+                        raw, count);
                     return;
                 }
 
-                // this objects needs to be deleted
-                if (it->second == 0)
-                    free_list.push_back(it);
+                it = p.first;
+            }
+            else
+            {
+                it->second -= credits;
             }
 
-            // Resolve the objects which have to be deleted.
-            resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+            // Sanity check.
+            if (it->second < 0)
+            {
+                std::int64_t const refcnt = it->second;
 
-        }    // Unlock the mutex.
+                l.unlock();
+
+                HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                    "primary_namespace::decrement_sweep",
+                    "negative entry in reference count table, raw({1}), "
+                    "refcount({2})",
+                    raw, refcnt);
+                return;
+            }
+
+            // this objects needs to be deleted, its entry is removed once it
+            // has been resolved successfully
+            if (it->second == 0)
+                free_list.push_back(raw);
+        }
+
+        // Resolve the objects which have to be deleted.
+        resolve_free_list(free_list, free_entry_list, lower, upper, ec);
+        if (ec)
+            return;
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -1032,12 +923,9 @@ namespace hpx::agas::server {
             ec = make_success_code();
     }
 
-    primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
-        std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
-        error_code& ec)
+    primary_namespace::resolved_type primary_namespace::resolve_gid_impl(
+        naming::gid_type const& gid, error_code& ec)
     {
-        HPX_ASSERT_OWNS_LOCK(l);
-
         // handle (non-migratable) components located on this locality first
         if (naming::refers_to_local_lva(gid) &&
             !naming::refers_to_virtual_memory(gid))
@@ -1048,21 +936,12 @@ namespace hpx::agas::server {
             return resolve_local_id(gid);
         }
 
-        return resolve_gid_locked_non_local(l, gid, ec);
+        return resolve_gid_non_local(gid, ec);
     }
 
-    // 26110: Caller failing to hold lock 'l' before calling function
-#if defined(HPX_MSVC)
-#pragma warning(push)
-#pragma warning(disable : 26110)
-#endif
-    primary_namespace::resolved_type
-    primary_namespace::resolve_gid_locked_non_local(
-        std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
-        error_code& ec)
+    primary_namespace::resolved_type primary_namespace::resolve_gid_non_local(
+        naming::gid_type const& gid, error_code& ec)
     {
-        HPX_ASSERT_OWNS_LOCK(l);
-
         HPX_ASSERT(!(naming::refers_to_local_lva(gid) &&
             !naming::refers_to_virtual_memory(gid)));
 
@@ -1070,85 +949,11 @@ namespace hpx::agas::server {
         naming::gid_type id = gid;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        gva_table_type::const_iterator it = gvas_.lower_bound(id);
-        gva_table_type::const_iterator const begin = gvas_.begin();
-
-        if (gva_table_type::const_iterator const end = gvas_.end(); it != end)
-        {
-            // Check for exact match
-            if (it->first == id)
-            {
-                if (&ec != &throws)
-                    ec = make_success_code();
-
-                gva_table_data_type const& data = it->second;
-                return resolved_type(it->first, data.first, data.second);
-            }
-
-            // We need to decrement the iterator, first we check that it's safe
-            // to do this.
-            if (it != begin)
-            {
-                --it;
-
-                // Found the GID in a range
-                gva_table_data_type const& data = it->second;
-                if ((it->first + data.first.count) > id)
-                {
-                    if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-                    {
-                        l.unlock();
-
-                        HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                            "primary_namespace::resolve_gid_locked",
-                            "MSBs of lower and upper range bound do not "
-                            "match");
-                        return resolved_type(
-                            naming::invalid_gid, gva(), naming::invalid_gid);
-                    }
-
-                    if (&ec != &throws)
-                        ec = make_success_code();
-
-                    return resolved_type(it->first, data.first, data.second);
-                }
-            }
-        }
-
-        else if (HPX_LIKELY(!gvas_.empty()))
-        {
-            --it;
-
-            // Found the GID in a range
-            gva_table_data_type const& data = it->second;
-            if ((it->first + data.first.count) > id)
-            {
-                if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                        "primary_namespace::resolve_gid_locked",
-                        "MSBs of lower and upper range bound do not match");
-                    return resolved_type(
-                        naming::invalid_gid, gva(), naming::invalid_gid);
-                }
-
-                if (&ec != &throws)
-                    ec = make_success_code();
-
-                return resolved_type(it->first, data.first, data.second);
-            }
-        }
-
         if (&ec != &throws)
             ec = make_success_code();
 
-        return resolved_type(naming::invalid_gid, gva(), naming::invalid_gid);
+        return gvas_.resolve(id);
     }
-#if defined(HPX_MSVC)
-#pragma warning(pop)
-#endif
 
 #if defined(HPX_HAVE_NETWORKING)
     void (*route)(primary_namespace& server, parcelset::parcel&& p) = nullptr;
@@ -8,8 +8,13 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas_base/server/symbol_namespace.hpp>
+#include <hpx/agas_base/symbol_namespace.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/components_base/agas_interface.hpp>
 #include <hpx/format.hpp>
+#include <hpx/futures/future.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming/credit_handling.hpp>
 #include <hpx/naming/split_gid.hpp>
@@ -19,8 +24,10 @@
 #include <hpx/util/insert_checked.hpp>
 #include <hpx/util/regex_from_pattern.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -80,6 +87,30 @@ namespace hpx::agas::server {
         }
     }
 
+    symbol_namespace::shard& symbol_namespace::get_shard(
+        std::string const& key) noexcept
+    {
+        return shards_[std::hash<std::string>()(key) % num_shards].data_;
+    }
+
+    void symbol_namespace::add_cached_by(
+        gid_entry& entry, hpx::id_type const& lco) const
+    {
+        // names resolved by this locality are invalidated directly
+        std::uint32_t const locality_id = naming::get_locality_id_from_id(lco);
+        if (locality_id == naming::invalid_locality_id ||
+            locality_id == agas::get_locality_id())
+        {
+            return;
+        }
+
+        if (std::find(entry.cached_by_.begin(), entry.cached_by_.end(),
+                locality_id) == entry.cached_by_.end())
+        {
+            entry.cached_by_.push_back(locality_id);
+        }
+    }
+
     bool symbol_namespace::bind(
         std::string const& key, naming::gid_type const& gid_)
     {
@@ -87,16 +118,17 @@ namespace hpx::agas::server {
             counter_data_.bind_.time_, counter_data_.bind_.enabled_);
         counter_data_.increment_bind_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(key);
+        std::unique_lock<mutex_type> l(s.mtx_);
 
         naming::gid_type gid = gid_;
 
-        auto const it = gids_.find(key);
-        if (auto const end = gids_.end(); it != end)
+        auto const it = s.gids_.find(key);
+        if (auto const end = s.gids_.end(); it != end)
         {
             std::int64_t const credits =
                 naming::detail::get_credit_from_gid(gid);
-            naming::gid_type raw_gid = *(it->second);
+            naming::gid_type raw_gid = *(it->second.gid_);
 
             naming::detail::strip_internal_bits_from_gid(raw_gid);
             naming::detail::strip_internal_bits_from_gid(gid);
@@ -106,7 +138,7 @@ namespace hpx::agas::server {
             {
                 // REVIEW: do we need to add the credit of the argument to the
                 // table?
-                naming::detail::add_credit_to_gid(*(it->second), credits);
+                naming::detail::add_credit_to_gid(*(it->second.gid_), credits);
 
                 l.unlock();
 
@@ -114,8 +146,8 @@ namespace hpx::agas::server {
                     "symbol_namespace::bind, key({1}), gid({2}), "
                     "old_credit({3}), new_credit({4})",
                     key, gid,
-                    naming::detail::get_credit_from_gid(*(it->second)),
-                    naming::detail::get_credit_from_gid(*(it->second)) +
+                    naming::detail::get_credit_from_gid(*(it->second.gid_)),
+                    naming::detail::get_credit_from_gid(*(it->second.gid_)) +
                         credits);
 
                 return true;
@@ -135,8 +167,8 @@ namespace hpx::agas::server {
             return false;
         }
 
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gids_.emplace(key, std::make_shared<naming::gid_type>(gid)))))
+        if (HPX_UNLIKELY(!util::insert_checked(s.gids_.emplace(key,
+                gid_entry{std::make_shared<naming::gid_type>(gid), {}}))))
         {
             l.unlock();
 
@@ -147,7 +179,7 @@ namespace hpx::agas::server {
         }
 
         // handle registered events
-        if (auto const [first, last] = on_event_data_.equal_range(key);
+        if (auto const [first, last] = s.on_event_data_.equal_range(key);
             first != last)
         {
             std::vector<hpx::id_type> lcos;
@@ -159,7 +191,7 @@ namespace hpx::agas::server {
                 ++iter;
             }
 
-            on_event_data_.erase(first, last);
+            s.on_event_data_.erase(first, last);
 
             // notify all LCOS which were registered with this name
             for (hpx::id_type const& id : lcos)
@@ -167,8 +199,8 @@ namespace hpx::agas::server {
                 // re-locate the entry in the GID table for each LCO anew, as we
                 // need to unlock the mutex protecting the table for each
                 // iteration below
-                auto gid_it = gids_.find(key);
-                if (gid_it == gids_.end())
+                auto gid_it = s.gids_.find(key);
+                if (gid_it == s.gids_.end())
                 {
                     l.unlock();
 
@@ -177,10 +209,12 @@ namespace hpx::agas::server {
                         "unable to re-locate the entry in the GID table");
                 }
 
+                add_cached_by(gid_it->second, id);
+
                 {
                     // hold on to the gid while the map is unlocked
                     std::shared_ptr<naming::gid_type> current_gid =
-                        gid_it->second;
+                        gid_it->second.gid_;
 
                     unlock_guard<std::unique_lock<mutex_type>> ul(l);
 
@@ -215,10 +249,11 @@ namespace hpx::agas::server {
             counter_data_.resolve_.time_, counter_data_.resolve_.enabled_);
         counter_data_.increment_resolve_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(key);
+        std::unique_lock<mutex_type> l(s.mtx_);
 
-        auto const it = gids_.find(key);
-        if (auto const end = gids_.end(); it == end)
+        auto const it = s.gids_.find(key);
+        if (auto const end = s.gids_.end(); it == end)
         {
             l.unlock();
 
@@ -230,7 +265,7 @@ namespace hpx::agas::server {
         }
 
         // hold on to gid before unlocking the map
-        std::shared_ptr<naming::gid_type> const current_gid(it->second);
+        std::shared_ptr<naming::gid_type> const current_gid(it->second.gid_);
 
         l.unlock();
 
@@ -250,10 +285,11 @@ namespace hpx::agas::server {
             counter_data_.unbind_.time_, counter_data_.unbind_.enabled_);
         counter_data_.increment_unbind_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(key);
+        std::unique_lock<mutex_type> l(s.mtx_);
 
-        auto const it = gids_.find(key);
-        if (auto const end = gids_.end(); it == end)
+        auto const it = s.gids_.find(key);
+        if (auto const end = s.gids_.end(); it == end)
         {
             l.unlock();
 
@@ -264,14 +300,49 @@ namespace hpx::agas::server {
             return naming::invalid_gid;
         }
 
-        naming::gid_type gid = *(it->second);
+        naming::gid_type gid = *(it->second.gid_);
+        std::vector<std::uint32_t> const cached_by =
+            HPX_MOVE(it->second.cached_by_);
+
+        s.gids_.erase(it);
 
-        gids_.erase(it);
+        // the name might have been cached by this locality as well
+        hpx::id_type cached_id;
+        if (auto const cached_it = s.cached_names_.find(key);
+            cached_it != s.cached_names_.end())
+        {
+            cached_id = HPX_MOVE(cached_it->second);
+            s.cached_names_.erase(cached_it);
+        }
+        cache_epoch_.fetch_add(1, std::memory_order_acq_rel);
 
         l.unlock();
 
+        // make sure no locality will resolve the name from its cache once
+        // this function has returned
+        if (!cached_by.empty())
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            std::vector<hpx::future<void>> invalidated;
+            invalidated.reserve(cached_by.size());
+            for (std::uint32_t const locality_id : cached_by)
+            {
+                hpx::id_type target(
+                    agas::symbol_namespace::get_service_instance(locality_id),
+                    hpx::id_type::management_type::unmanaged);
+
+                invalidated.push_back(
+                    hpx::async(invalidate_action(), HPX_MOVE(target), key));
+            }
+
+            // the target localities might have exited already, ignore errors
+            hpx::wait_all_nothrow(invalidated);
+#endif
+        }
+
         LAGAS_(info).format(
-            "symbol_namespace::unbind, key({1}), gid({2})", key, gid);
+            "symbol_namespace::unbind, key({1}), gid({2}), cached_by({3})",
+            key, gid, cached_by.size());
 
         return gid;
     }
@@ -287,40 +358,52 @@ namespace hpx::agas::server {
 
         std::map<std::string, naming::gid_type> found;
 
+        // collect the matching entries of all shards, one shard at a time
+        auto const iterate_shards = [&](auto&& matches) {
+            for (auto& shard_data : shards_)
+            {
+                shard& s = shard_data.data_;
+
+                std::vector<
+                    std::pair<std::string, std::shared_ptr<naming::gid_type>>>
+                    entries;
+                {
+                    std::lock_guard<mutex_type> l(s.mtx_);
+                    for (auto const& [name, entry] : s.gids_)
+                    {
+                        if (matches(name))
+                        {
+                            // hold on to entry while map is unlocked
+                            entries.emplace_back(name, entry.gid_);
+                        }
+                    }
+                }
+
+                for (auto& [name, current_gid] : entries)
+                {
+                    found[HPX_MOVE(name)] = naming::detail::split_gid_if_needed(
+                        hpx::launch::sync, *current_gid);
+                }
+            }
+        };
+
         if (pattern.find_first_of("*?[]") != std::string::npos)
         {
             std::string const str_rx(util::regex_from_pattern(pattern, throws));
             std::regex const rx(str_rx);
 
-            std::unique_lock<mutex_type> l(mutex_);
-            for (auto& gid : gids_)
-            {
-                if (!std::regex_match(gid.first, rx))
-                    continue;
-
-                // hold on to entry while map is unlocked
-                std::shared_ptr<naming::gid_type> current_gid(gid.second);
-                unlock_guard<std::unique_lock<mutex_type>> ul(l);
-
-                found[gid.first] = naming::detail::split_gid_if_needed(
-                    hpx::launch::sync, *current_gid);
-            }
+            iterate_shards([&](std::string const& name) {
+                return std::regex_match(name, rx);
+            });
+        }
+        else if (pattern.empty())
+        {
+            iterate_shards([](std::string const&) { return true; });
         }
         else
         {
-            std::unique_lock<mutex_type> l(mutex_);
-            for (auto& gid : gids_)
-            {
-                if (!pattern.empty() && pattern != gid.first)
-                    continue;
-
-                // hold on to entry while map is unlocked
-                std::shared_ptr<naming::gid_type> current_gid(gid.second);
-                unlock_guard<std::unique_lock<mutex_type>> ul(l);
-
-                found[gid.first] = naming::detail::split_gid_if_needed(
-                    hpx::launch::sync, *current_gid);
-            }
+            iterate_shards(
+                [&](std::string const& name) { return pattern == name; });
         }
 
         LAGAS_(info).format("symbol_namespace::iterate");
@@ -335,20 +418,23 @@ namespace hpx::agas::server {
             counter_data_.on_event_.time_, counter_data_.on_event_.enabled_);
         counter_data_.increment_on_event_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(name);
+        std::unique_lock<mutex_type> l(s.mtx_);
 
         bool handled = false;
 
         if (call_for_past_events)
         {
-            if (auto const it = gids_.find(name); it != gids_.end())
+            if (auto const it = s.gids_.find(name); it != s.gids_.end())
             {
+                add_cached_by(it->second, lco);
+
                 // split the credit as the receiving end will expect to keep the
                 // object alive
                 {
                     // hold on to entry while map is unlocked
                     std::shared_ptr<naming::gid_type> const current_gid(
-                        it->second);
+                        it->second.gid_);
 
                     unlock_guard<std::unique_lock<mutex_type>> ul(l);
                     naming::gid_type new_gid =
@@ -371,11 +457,12 @@ namespace hpx::agas::server {
 
         if (!handled)
         {
-            [[maybe_unused]] auto const it = on_event_data_.emplace(name, lco);
+            [[maybe_unused]] auto const it =
+                s.on_event_data_.emplace(name, lco);
 
             // This overload of insert always returns the iterator pointing
             // to the inserted value. It should never point to end
-            HPX_ASSERT_LOCKED(l, it != on_event_data_.end());
+            HPX_ASSERT_LOCKED(l, it != s.on_event_data_.end());
         }
 
         l.unlock();
@@ -385,6 +472,80 @@ namespace hpx::agas::server {
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void symbol_namespace::invalidate(std::string const& key)
+    {
+        hpx::id_type cached_id;
+
+        {
+            shard& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+
+            if (auto const it = s.cached_names_.find(key);
+                it != s.cached_names_.end())
+            {
+                // release the id only after the lock has been released
+                cached_id = HPX_MOVE(it->second);
+                s.cached_names_.erase(it);
+            }
+
+            // a concurrently running name resolution must not cache its
+            // result, even if the name has not been cached yet
+            cache_epoch_.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        LAGAS_(info).format("symbol_namespace::invalidate, key({1})", key);
+    }
+
+    bool symbol_namespace::get_cached_name(
+        std::string const& key, hpx::id_type& id)
+    {
+        shard& s = get_shard(key);
+        std::lock_guard<mutex_type> l(s.mtx_);
+
+        auto const it = s.cached_names_.find(key);
+        if (it == s.cached_names_.end())
+        {
+            return false;
+        }
+
+        id = it->second;
+        return true;
+    }
+
+    void symbol_namespace::cache_name(
+        std::string const& key, hpx::id_type const& id, std::uint64_t epoch)
+    {
+        if (!id)
+        {
+            return;
+        }
+
+        shard& s = get_shard(key);
+        std::lock_guard<mutex_type> l(s.mtx_);
+
+        // an invalidation might have been missed otherwise
+        if (cache_epoch_.load(std::memory_order_acquire) == epoch)
+        {
+            s.cached_names_.insert_or_assign(key, id);
+        }
+    }
+
+    void symbol_namespace::clear_name_cache()
+    {
+        for (auto& shard_data : shards_)
+        {
+            shard& s = shard_data.data_;
+
+            name_cache_type cached_names;
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                std::swap(cached_names, s.cached_names_);
+            }
+        }
+        cache_epoch_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
     // access current counter values
     std::int64_t symbol_namespace::counter_data::get_bind_count(bool reset)
     {
@@ -51,6 +51,10 @@ HPX_REGISTER_ACTION_ID(symbol_namespace::on_event_action,
     symbol_namespace_on_event_action,
     hpx::actions::symbol_namespace_on_event_action_id)
 
+HPX_REGISTER_ACTION_ID(symbol_namespace::invalidate_action,
+    symbol_namespace_invalidate_action,
+    hpx::actions::symbol_namespace_invalidate_action_id)
+
 namespace hpx::agas {
 
     naming::gid_type symbol_namespace::get_service_instance(
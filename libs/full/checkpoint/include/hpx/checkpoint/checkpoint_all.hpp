@@ -0,0 +1,279 @@
+// Copyright (c) 2024 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines the save_checkpoint_all and restore_checkpoint_all
+/// functions. These are collective operations which have to be invoked on all
+/// localities. Every locality serializes its objects concurrently and writes
+/// them as a separate shard (one checkpoint file per locality) using the I/O
+/// thread pool.
+
+/// \file hpx/checkpoint/checkpoint_all.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
+#include <hpx/collectives/all_reduce.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/runtime_distributed/get_num_localities.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Statistics returned by save_checkpoint_all and restore_checkpoint_all.
+    /// The values are accumulated over all localities.
+    struct checkpoint_io_statistics
+    {
+        /// overall number of bytes written or read
+        std::uint64_t bytes = 0;
+
+        /// time needed by the slowest locality (in seconds)
+        double seconds = 0.0;
+
+        /// achieved throughput in GB/s
+        [[nodiscard]] double throughput() const noexcept
+        {
+            return seconds != 0.0 ? static_cast<double>(bytes) / seconds / 1e9 :
+                                    0.0;
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned const)
+        {
+            // clang-format off
+            ar & bytes & seconds;
+            // clang-format on
+        }
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        struct combine_checkpoint_io_statistics
+        {
+            checkpoint_io_statistics operator()(
+                checkpoint_io_statistics const& lhs,
+                checkpoint_io_statistics const& rhs) const noexcept
+            {
+                return {lhs.bytes + rhs.bytes,
+                    (std::max)(lhs.seconds, rhs.seconds)};
+            }
+
+            template <typename Archive>
+            void serialize(Archive&, unsigned const)
+            {
+            }
+        };
+
+        // All localities invoke the collective operations for the same
+        // basename in the same order, which allows to derive the generation
+        // of the reduction operation (named after the basename) locally.
+        inline std::size_t next_checkpoint_all_generation(
+            std::string const& basename)
+        {
+            static hpx::spinlock mtx;
+            static std::map<std::string, std::size_t> generations;
+
+            std::lock_guard l(mtx);
+            return ++generations[basename];
+        }
+
+        inline std::string checkpoint_shard_name(
+            std::string const& basename, std::uint32_t locality_id)
+        {
+            return basename + "." + std::to_string(locality_id) + ".ckpt";
+        }
+
+        inline checkpoint_io_statistics reduce_checkpoint_io_statistics(
+            std::string const& basename, std::size_t generation,
+            checkpoint_io_statistics local)
+        {
+            return hpx::collectives::all_reduce(
+                ("/hpx/checkpoint_all/" + basename).c_str(), local,
+                combine_checkpoint_io_statistics{},
+                hpx::collectives::num_sites_arg(
+                    hpx::get_num_localities(hpx::launch::sync)),
+                hpx::collectives::this_site_arg(hpx::get_locality_id()),
+                hpx::collectives::generation_arg(generation))
+                .get();
+        }
+
+        // Clients are saved as a future referring to the server instance
+        // (same as for save_checkpoint), all other objects are referenced
+        // directly to avoid copying potentially large amounts of data.
+        template <typename T>
+        decltype(auto) prepare_checkpoint_all_arg(T const& t)
+        {
+            if constexpr (hpx::traits::is_client_v<T>)
+            {
+                return prepare_client(t);
+            }
+            else
+            {
+                return std::cref(t);
+            }
+        }
+
+        template <typename T>
+        T const& unwrap_checkpoint_all_arg(T const& t) noexcept
+        {
+            return t;
+        }
+
+        template <typename T>
+        T const& unwrap_checkpoint_all_arg(
+            std::reference_wrapper<T const> t) noexcept
+        {
+            return t.get();
+        }
+
+        inline void get_all(std::vector<hpx::future<void>>& futures)
+        {
+            hpx::wait_all(futures);
+            for (auto& f : futures)
+            {
+                f.get();    // rethrow exceptions, if any
+            }
+        }
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// save_checkpoint_all
+    ///
+    /// \tparam Ts           Types of the objects to store.
+    ///
+    /// \param basename      The base name of the checkpoint files. Each
+    ///                      locality writes its objects to the file
+    ///                      '<basename>.<locality-id>.ckpt'.
+    ///
+    /// \param ts            The objects to store. Clients are stored by
+    ///                      serializing the referenced component.
+    ///
+    /// Save_checkpoint_all is a collective operation that has to be invoked on
+    /// all localities. The objects of each locality are serialized
+    /// concurrently and each chunk of the resulting shard is written as soon
+    /// as it is available (the blocking I/O operations are performed on the
+    /// I/O thread pool).
+    /// The objects have to be kept alive until the returned future has become
+    /// ready.
+    ///
+    /// \returns Save_checkpoint_all returns a future to the I/O statistics
+    ///          accumulated over all localities.
+    template <typename... Ts>
+    hpx::future<checkpoint_io_statistics> save_checkpoint_all(
+        std::string const& basename, Ts const&... ts)
+    {
+        std::size_t const generation =
+            detail::next_checkpoint_all_generation(basename);
+
+        auto save = [basename, generation](auto const&... args) {
+            hpx::chrono::high_resolution_timer const timer;
+
+            checkpoint_file_writer writer(detail::checkpoint_shard_name(
+                basename, hpx::get_locality_id()));
+
+            // serialize and write all objects concurrently
+            std::vector<hpx::future<void>> serialized;
+            serialized.reserve(sizeof...(args));
+
+            std::uint64_t key = 0;
+            (serialized.push_back(hpx::async([&, k = key++]() {
+                writer.save(k, detail::unwrap_checkpoint_all_arg(args));
+            })),
+                ...);
+            detail::get_all(serialized);
+
+            // write the index and replace the shard file
+            writer.write();
+
+            checkpoint_io_statistics const stats{
+                static_cast<std::uint64_t>(writer.bytes_written()),
+                timer.elapsed()};
+
+            return detail::reduce_checkpoint_io_statistics(
+                basename, generation, stats);
+        };
+
+        return hpx::dataflow(hpx::launch::async, HPX_MOVE(save),
+            detail::prepare_checkpoint_all_arg(ts)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// restore_checkpoint_all
+    ///
+    /// \tparam Ts           Types of the objects to restore.
+    ///
+    /// \param basename      The base name of the checkpoint files as passed
+    ///                      to save_checkpoint_all.
+    ///
+    /// \param ts            The objects to restore. These must be in the same
+    ///                      order as they were passed to save_checkpoint_all
+    ///                      on this locality.
+    ///
+    /// Restore_checkpoint_all is a collective operation that has to be invoked
+    /// on all localities. Each locality maps its shard on the I/O thread pool
+    /// and deserializes the objects concurrently. The objects have to be kept
+    /// alive until the returned future has become ready.
+    ///
+    /// \returns Restore_checkpoint_all returns a future to the I/O statistics
+    ///          accumulated over all localities.
+    template <typename... Ts>
+    hpx::future<checkpoint_io_statistics> restore_checkpoint_all(
+        std::string const& basename, Ts&... ts)
+    {
+        std::size_t const generation =
+            detail::next_checkpoint_all_generation(basename);
+
+        return hpx::async([basename, generation, &ts...]() {
+            hpx::chrono::high_resolution_timer const timer;
+
+            checkpoint_file_reader const reader =
+                hpx::async(hpx::execution::experimental::io_pool_executor(),
+                    [&basename]() {
+                        return checkpoint_file_reader(
+                            detail::checkpoint_shard_name(
+                                basename, hpx::get_locality_id()));
+                    })
+                    .get();
+
+            // deserialize all objects concurrently
+            std::vector<hpx::future<void>> restored;
+            restored.reserve(sizeof...(ts));
+
+            std::uint64_t key = 0;
+            (restored.push_back(hpx::async([&, k = key++]() {
+                hpx::util::restore_checkpoint_data_func(
+                    reader.data(k), detail::restore_impl{}, ts);
+            })),
+                ...);
+            detail::get_all(restored);
+
+            checkpoint_io_statistics const stats{
+                static_cast<std::uint64_t>(reader.size()), timer.elapsed()};
+
+            return detail::reduce_checkpoint_io_statistics(
+                basename, generation, stats);
+        });
+    }
+}    // namespace hpx::util
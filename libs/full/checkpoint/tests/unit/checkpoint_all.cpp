@@ -0,0 +1,68 @@
+// Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of save_checkpoint_all and
+// restore_checkpoint_all.
+//
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint_io_statistics;
+using hpx::util::restore_checkpoint_all;
+using hpx::util::save_checkpoint_all;
+
+int main()
+{
+    std::uint32_t const locality_id = hpx::get_locality_id();
+    std::string const basename = "checkpoint_all_test";
+
+    std::vector<double> vec(100000);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+    {
+        vec[i] = static_cast<double>(i + locality_id);
+    }
+    std::string str = "locality " + std::to_string(locality_id);
+    int integer = 42 + static_cast<int>(locality_id);
+
+    // Test 1
+    //  save the objects of all localities concurrently
+    checkpoint_io_statistics const saved =
+        save_checkpoint_all(basename, vec, str, integer).get();
+
+    HPX_TEST_LTE(vec.size() * sizeof(double), saved.bytes);
+
+    // Test 2
+    //  restore the objects of all localities concurrently
+    std::vector<double> vec2;
+    std::string str2;
+    int integer2 = 0;
+
+    checkpoint_io_statistics const restored =
+        restore_checkpoint_all(basename, vec2, str2, integer2).get();
+
+    HPX_TEST(vec == vec2);
+    HPX_TEST_EQ(str, str2);
+    HPX_TEST_EQ(integer, integer2);
+    HPX_TEST_LTE(saved.bytes, restored.bytes);
+
+    std::remove(hpx::util::detail::checkpoint_shard_name(basename, locality_id)
+                    .c_str());
+
+    return hpx::util::report_errors();
+}
+#endif
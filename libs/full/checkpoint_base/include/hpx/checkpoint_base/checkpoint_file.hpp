@@ -0,0 +1,236 @@
+// Copyright (c) 2024 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/checkpoint_base/checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::util {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // On-disk layout of a chunked checkpoint file (all values are stored
+        // in native byte order):
+        //
+        //   checkpoint_file_header
+        //   path of the base checkpoint (base_path_size_ bytes, may be empty,
+        //       relative paths are relative to the directory of this file)
+        //   data chunks (each aligned to checkpoint_file_alignment)
+        //   checkpoint_file_entry[num_entries_] (sorted by key)
+        //
+        // Incremental checkpoints store only the chunks of objects that have
+        // changed since the base checkpoint, all other entries are marked as
+        // inherited and are resolved through the base checkpoint.
+        inline constexpr char checkpoint_file_magic[8] = {
+            'H', 'P', 'X', 'C', 'K', 'P', 'T', '\0'};
+        inline constexpr std::uint32_t checkpoint_file_version = 2;
+        inline constexpr std::size_t checkpoint_file_alignment = 64;
+
+        struct checkpoint_file_header
+        {
+            char magic_[8];
+            std::uint32_t version_;
+            std::uint32_t flags_;
+            std::uint64_t num_entries_;
+            std::uint64_t index_offset_;
+            std::uint64_t base_path_size_;
+        };
+
+        enum class checkpoint_entry_flags : std::uint32_t
+        {
+            none = 0,
+            inherited = 1    // data is stored in the base checkpoint
+        };
+
+        struct checkpoint_file_entry
+        {
+            std::uint64_t key_;
+            std::uint64_t offset_;
+            std::uint64_t size_;
+            std::uint32_t flags_;
+            std::uint32_t reserved_;
+        };
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// checkpoint_file_reader
+    ///
+    /// Gives access to a chunked checkpoint file written by a
+    /// checkpoint_file_writer. The file is memory mapped (where supported),
+    /// objects are deserialized only once they are requested by calling
+    /// \a restore. Entries of incremental checkpoints that were inherited from
+    /// a base checkpoint are transparently resolved through that base.
+    class HPX_EXPORT checkpoint_file_reader
+    {
+    public:
+        explicit checkpoint_file_reader(std::string path);
+        ~checkpoint_file_reader();
+
+        checkpoint_file_reader(checkpoint_file_reader const&) = delete;
+        checkpoint_file_reader(checkpoint_file_reader&& rhs) noexcept;
+        checkpoint_file_reader& operator=(
+            checkpoint_file_reader const&) = delete;
+        checkpoint_file_reader& operator=(
+            checkpoint_file_reader&& rhs) noexcept;
+
+        /// Return whether an object was stored using the given key
+        [[nodiscard]] bool contains(std::uint64_t key) const noexcept;
+
+        /// Return the keys of all objects stored in this checkpoint
+        [[nodiscard]] std::vector<std::uint64_t> keys() const;
+
+        /// Return the serialized data stored for the given key
+        [[nodiscard]] std::string_view data(std::uint64_t key) const;
+
+        /// Deserialize the objects stored for the given key into \a ts. The
+        /// sequence of objects has to correspond to the sequence of objects
+        /// passed to the corresponding checkpoint_file_writer::save.
+        template <typename... Ts>
+        void restore(std::uint64_t key, Ts&... ts) const
+        {
+            std::string_view const d = data(key);
+            restore_checkpoint_data(d, ts...);
+        }
+
+        [[nodiscard]] std::string const& path() const noexcept
+        {
+            return path_;
+        }
+
+        /// Return the size of the (mapped) checkpoint file in bytes
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// Return whether this is an incremental checkpoint
+        [[nodiscard]] bool is_incremental() const noexcept
+        {
+            return base_ != nullptr;
+        }
+
+    private:
+        detail::checkpoint_file_entry const* find(
+            std::uint64_t key) const noexcept;
+        void unmap() noexcept;
+
+        std::string path_;
+        char const* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool mapped_ = false;
+        std::vector<char> buffer_;    // used if memory mapping is unavailable
+        std::vector<detail::checkpoint_file_entry> index_;
+        std::unique_ptr<checkpoint_file_reader> base_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// checkpoint_file_writer
+    ///
+    /// Writes the serialized state of any number of objects (each identified
+    /// by a unique key) as separate chunks into a checkpoint file. Objects may
+    /// be added concurrently from several threads, each chunk is written to
+    /// the file as soon as it is added, the serialized data is not kept in
+    /// memory.
+    ///
+    /// The data is written to a temporary file ('<path>.tmp') which replaces
+    /// the checkpoint file only once \a write has successfully completed,
+    /// thus an existing checkpoint file is never left in a partially written
+    /// state.
+    ///
+    /// If a base checkpoint is given, the writer creates an incremental
+    /// checkpoint: objects whose serialized data did not change compared to
+    /// the base checkpoint are not written again but are referenced instead.
+    /// The base checkpoint file has to be kept around for as long as the
+    /// incremental checkpoint is in use.
+    class HPX_EXPORT checkpoint_file_writer
+    {
+    public:
+        explicit checkpoint_file_writer(
+            std::string path, checkpoint_file_reader const* base = nullptr);
+        ~checkpoint_file_writer();
+
+        checkpoint_file_writer(checkpoint_file_writer const&) = delete;
+        checkpoint_file_writer(checkpoint_file_writer&&) = delete;
+        checkpoint_file_writer& operator=(
+            checkpoint_file_writer const&) = delete;
+        checkpoint_file_writer& operator=(checkpoint_file_writer&&) = delete;
+
+        /// Serialize the given objects, store them using the given key, and
+        /// write them to the file.
+        ///
+        /// \returns false if the data is unchanged compared to the base
+        ///          checkpoint (and was therefore not written).
+        template <typename... Ts>
+        bool save(std::uint64_t key, Ts const&... ts)
+        {
+            std::vector<char> data;
+            data.reserve(prepare_checkpoint_data(ts...));
+            save_checkpoint_data(data, ts...);
+            return add(key, data.data(), data.size());
+        }
+
+        /// Store the given (already serialized) data using the given key and
+        /// write it to the file.
+        ///
+        /// \returns false if the data is unchanged compared to the base
+        ///          checkpoint (and was therefore not written).
+        bool add(std::uint64_t key, char const* data, std::size_t size);
+
+        /// Write the index of all added objects and replace the checkpoint
+        /// file with the written data. No objects can be added afterwards.
+        void write();
+
+        /// Return the number of objects written to the file
+        [[nodiscard]] std::size_t num_written() const noexcept;
+
+        /// Return the number of objects inherited from the base checkpoint
+        [[nodiscard]] std::size_t num_inherited() const noexcept;
+
+        /// Return the number of bytes of object data written to the file
+        [[nodiscard]] std::size_t bytes_written() const noexcept;
+
+    private:
+        struct entry
+        {
+            std::uint64_t key_;
+            std::uint64_t offset_;
+            std::uint64_t size_;
+            bool inherited_;
+        };
+
+        struct file;
+        void discard() noexcept;
+
+        std::string path_;
+        std::string tmp_path_;
+        checkpoint_file_reader const* base_;
+        std::string base_path_;    // relative to the directory of path_
+        std::unique_ptr<file> file_;
+
+        mutable hpx::spinlock mtx_;
+        std::vector<entry> entries_;
+        std::uint64_t next_offset_;
+        std::size_t bytes_written_;
+    };
+}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,616 @@
+// Copyright (c) 2024 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+
+// include unistd.h conditionally to check for POSIX version. Not all OSs have
+// the unistd header file.
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#if defined(_POSIX_VERSION)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#include <sys/mman.h>
+#define HPX_CHECKPOINT_HAVE_MMAP
+#endif
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+    namespace detail {
+
+        constexpr std::uint64_t align_checkpoint_offset(
+            std::uint64_t offset) noexcept
+        {
+            return (offset + checkpoint_file_alignment - 1) &
+                ~static_cast<std::uint64_t>(checkpoint_file_alignment - 1);
+        }
+
+        // Blocking I/O operations are offloaded to the I/O thread pool when
+        // invoked on an HPX thread. This keeps several write streams in
+        // flight without blocking any of the worker threads.
+        template <typename F>
+        auto run_blocking(F&& f)
+        {
+            if (hpx::threads::get_self_ptr() != nullptr)
+            {
+                return hpx::run_as_os_thread(HPX_FORWARD(F, f)).get();
+            }
+            return f();
+        }
+
+#if defined(_POSIX_VERSION)
+        // write the whole buffer at the given position, returns an errno
+        // value (errno itself is thread local and is not carried over from
+        // the I/O thread)
+        int pwrite_all(int fd, char const* p, std::size_t size,
+            std::uint64_t pos) noexcept
+        {
+            while (size != 0)
+            {
+                ::ssize_t const written =
+                    ::pwrite(fd, p, size, static_cast<::off_t>(pos));
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    return errno;
+                }
+                p += written;
+                pos += static_cast<std::uint64_t>(written);
+                size -= static_cast<std::size_t>(written);
+            }
+            return 0;
+        }
+#endif
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_file_reader::checkpoint_file_reader(std::string path)
+      : path_(HPX_MOVE(path))
+    {
+#if defined(HPX_CHECKPOINT_HAVE_MMAP)
+        int const fd = ::open(path_.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                "unable to open checkpoint file '{}': {}", path_,
+                std::strerror(errno));
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                "unable to stat checkpoint file '{}': {}", path_,
+                std::strerror(errno));
+        }
+
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ != 0)
+        {
+            void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED)    // NOLINT
+            {
+                ::close(fd);
+                HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                    "checkpoint_file_reader::checkpoint_file_reader",
+                    "unable to map checkpoint file '{}': {}", path_,
+                    std::strerror(errno));
+            }
+            data_ = static_cast<char const*>(p);
+            mapped_ = true;
+        }
+        ::close(fd);
+#else
+        std::ifstream ifs(path_, std::ios::binary | std::ios::ate);
+        if (!ifs)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                "unable to open checkpoint file '{}'", path_);
+        }
+
+        buffer_.resize(static_cast<std::size_t>(ifs.tellg()));
+        ifs.seekg(0);
+        ifs.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#endif
+
+        // verify header
+        detail::checkpoint_file_header header;
+        if (size_ < sizeof(header))
+        {
+            unmap();
+            HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                "checkpoint file '{}' is too small", path_);
+        }
+
+        std::memcpy(&header, data_, sizeof(header));
+        if (std::memcmp(header.magic_, detail::checkpoint_file_magic,
+                sizeof(header.magic_)) != 0 ||
+            header.version_ != detail::checkpoint_file_version)
+        {
+            unmap();
+            HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                "'{}' is not a checkpoint file of a supported version", path_);
+        }
+
+        // avoid overflows caused by corrupted headers
+        if (header.index_offset_ > size_ ||
+            header.num_entries_ > (size_ - header.index_offset_) /
+                    sizeof(detail::checkpoint_file_entry) ||
+            header.base_path_size_ > size_ - sizeof(header))
+        {
+            unmap();
+            HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                "checkpoint file '{}' is truncated", path_);
+        }
+
+        // the index is copied as it is not necessarily properly aligned
+        index_.resize(static_cast<std::size_t>(header.num_entries_));
+        std::memcpy(index_.data(), data_ + header.index_offset_,
+            index_.size() * sizeof(detail::checkpoint_file_entry));
+
+        // open base checkpoint, if this is an incremental one, a relative
+        // path is relative to the directory of this checkpoint file
+        if (header.base_path_size_ != 0)
+        {
+            filesystem::path base_path(std::string(data_ + sizeof(header),
+                static_cast<std::size_t>(header.base_path_size_)));
+            if (base_path.is_relative())
+            {
+                base_path = filesystem::path(path_).parent_path() / base_path;
+            }
+            base_ = std::make_unique<checkpoint_file_reader>(
+                base_path.string());
+        }
+    }
+
+    checkpoint_file_reader::~checkpoint_file_reader()
+    {
+        unmap();
+    }
+
+    checkpoint_file_reader::checkpoint_file_reader(
+        checkpoint_file_reader&& rhs) noexcept
+      : path_(HPX_MOVE(rhs.path_))
+      , data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+      , mapped_(std::exchange(rhs.mapped_, false))
+      , buffer_(HPX_MOVE(rhs.buffer_))
+      , index_(HPX_MOVE(rhs.index_))
+      , base_(HPX_MOVE(rhs.base_))
+    {
+    }
+
+    checkpoint_file_reader& checkpoint_file_reader::operator=(
+        checkpoint_file_reader&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            unmap();
+
+            path_ = HPX_MOVE(rhs.path_);
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+            mapped_ = std::exchange(rhs.mapped_, false);
+            buffer_ = HPX_MOVE(rhs.buffer_);
+            index_ = HPX_MOVE(rhs.index_);
+            base_ = HPX_MOVE(rhs.base_);
+        }
+        return *this;
+    }
+
+    void checkpoint_file_reader::unmap() noexcept
+    {
+#if defined(HPX_CHECKPOINT_HAVE_MMAP)
+        if (mapped_)
+        {
+            ::munmap(const_cast<char*>(data_), size_);
+            mapped_ = false;
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    detail::checkpoint_file_entry const* checkpoint_file_reader::find(
+        std::uint64_t key) const noexcept
+    {
+        auto const it = std::lower_bound(index_.begin(), index_.end(), key,
+            [](detail::checkpoint_file_entry const& e, std::uint64_t k) {
+                return e.key_ < k;
+            });
+        if (it == index_.end() || it->key_ != key)
+        {
+            return nullptr;
+        }
+        return &*it;
+    }
+
+    bool checkpoint_file_reader::contains(std::uint64_t key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    std::vector<std::uint64_t> checkpoint_file_reader::keys() const
+    {
+        std::vector<std::uint64_t> result;
+        result.reserve(index_.size());
+        for (auto const& e : index_)
+        {
+            result.push_back(e.key_);
+        }
+        return result;
+    }
+
+    std::string_view checkpoint_file_reader::data(std::uint64_t key) const
+    {
+        detail::checkpoint_file_entry const* e = find(key);
+        if (e == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "checkpoint_file_reader::data",
+                "checkpoint file '{}' does not contain an entry for key {}",
+                path_, key);
+        }
+
+        if (e->flags_ &
+            static_cast<std::uint32_t>(
+                detail::checkpoint_entry_flags::inherited))
+        {
+            HPX_ASSERT(base_);
+            return base_->data(key);
+        }
+
+        if (e->offset_ > size_ || e->size_ > size_ - e->offset_)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                "checkpoint_file_reader::data",
+                "checkpoint file '{}' is truncated", path_);
+        }
+        return {data_ + e->offset_, static_cast<std::size_t>(e->size_)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(_POSIX_VERSION)
+    struct checkpoint_file_writer::file
+    {
+        int fd_ = -1;
+    };
+#else
+    struct checkpoint_file_writer::file
+    {
+        std::mutex mtx_;
+        std::ofstream ofs_;
+    };
+#endif
+
+    checkpoint_file_writer::checkpoint_file_writer(
+        std::string path, checkpoint_file_reader const* base)
+      : path_(HPX_MOVE(path))
+      , tmp_path_(path_ + ".tmp")
+      , base_(base)
+      , file_(std::make_unique<file>())
+      , next_offset_(0)
+      , bytes_written_(0)
+    {
+        // the path of the base checkpoint is stored relative to the directory
+        // of the new checkpoint, which allows to move both files together
+        if (base_ != nullptr)
+        {
+            filesystem::path const dir =
+                filesystem::absolute(filesystem::path(path_)).parent_path();
+            filesystem::path const base_path =
+                filesystem::absolute(filesystem::path(base_->path()));
+
+            filesystem::path const relative = base_path.lexically_relative(dir);
+            base_path_ =
+                relative.empty() ? base_path.string() : relative.string();
+        }
+
+        next_offset_ = detail::align_checkpoint_offset(
+            sizeof(detail::checkpoint_file_header) + base_path_.size());
+
+#if defined(_POSIX_VERSION)
+        int const error = detail::run_blocking([this]() {
+            file_->fd_ = ::open(tmp_path_.c_str(),
+                O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+            if (file_->fd_ == -1)
+                return errno;
+
+            return detail::pwrite_all(file_->fd_, base_path_.data(),
+                base_path_.size(), sizeof(detail::checkpoint_file_header));
+        });
+        if (error != 0)
+        {
+            discard();
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_writer::checkpoint_file_writer",
+                "unable to write checkpoint file '{}': {}", tmp_path_,
+                std::strerror(error));
+        }
+#else
+        file_->ofs_.open(tmp_path_, std::ios::binary | std::ios::trunc);
+        file_->ofs_.seekp(sizeof(detail::checkpoint_file_header));
+        file_->ofs_.write(
+            base_path_.data(), static_cast<std::streamsize>(base_path_.size()));
+        if (!file_->ofs_)
+        {
+            discard();
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_writer::checkpoint_file_writer",
+                "unable to write checkpoint file '{}'", tmp_path_);
+        }
+#endif
+    }
+
+    checkpoint_file_writer::~checkpoint_file_writer()
+    {
+        // the temporary file is removed if write() was not called (or has
+        // failed)
+        discard();
+    }
+
+    void checkpoint_file_writer::discard() noexcept
+    {
+#if defined(_POSIX_VERSION)
+        if (file_ && file_->fd_ != -1)
+        {
+            ::close(file_->fd_);
+            file_->fd_ = -1;
+            ::unlink(tmp_path_.c_str());
+        }
+#else
+        if (file_ && file_->ofs_.is_open())
+        {
+            file_->ofs_.close();
+            std::remove(tmp_path_.c_str());
+        }
+#endif
+    }
+
+    bool checkpoint_file_writer::add(
+        std::uint64_t key, char const* data, std::size_t size)
+    {
+        // the data is compared with the data stored in the (memory mapped)
+        // base checkpoint, there is no need for additional checksums
+        bool const inherited = base_ != nullptr && base_->contains(key) &&
+            base_->data(key) == std::string_view(data, size);
+
+        std::uint64_t offset = 0;
+        {
+            std::lock_guard l(mtx_);
+            if (!inherited)
+            {
+                offset = detail::align_checkpoint_offset(next_offset_);
+                next_offset_ = offset + size;
+                bytes_written_ += size;
+            }
+            entries_.push_back(entry{key, offset, size, inherited});
+        }
+
+        if (inherited || size == 0)
+        {
+            return !inherited;
+        }
+
+        // the chunks don't overlap, all of them are written concurrently
+#if defined(_POSIX_VERSION)
+        int const fd = file_->fd_;
+        int const error = detail::run_blocking(
+            [&]() { return detail::pwrite_all(fd, data, size, offset); });
+        if (error != 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_writer::add",
+                "unable to write checkpoint file '{}': {}", tmp_path_,
+                std::strerror(error));
+        }
+#else
+        std::lock_guard l(file_->mtx_);
+        file_->ofs_.seekp(static_cast<std::streamoff>(offset));
+        file_->ofs_.write(data, static_cast<std::streamsize>(size));
+        if (!file_->ofs_)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_writer::add",
+                "unable to write checkpoint file '{}'", tmp_path_);
+        }
+#endif
+        return true;
+    }
+
+    std::size_t checkpoint_file_writer::num_written() const noexcept
+    {
+        std::lock_guard l(mtx_);
+        return std::count_if(entries_.begin(), entries_.end(),
+            [](entry const& e) { return !e.inherited_; });
+    }
+
+    std::size_t checkpoint_file_writer::num_inherited() const noexcept
+    {
+        std::lock_guard l(mtx_);
+        return std::count_if(entries_.begin(), entries_.end(),
+            [](entry const& e) { return e.inherited_; });
+    }
+
+    std::size_t checkpoint_file_writer::bytes_written() const noexcept
+    {
+        std::lock_guard l(mtx_);
+        return bytes_written_;
+    }
+
+    void checkpoint_file_writer::write()
+    {
+        std::unique_lock l(mtx_);
+
+        std::sort(entries_.begin(), entries_.end(),
+            [](entry const& lhs, entry const& rhs) {
+                return lhs.key_ < rhs.key_;
+            });
+
+        if (std::adjacent_find(entries_.begin(), entries_.end(),
+                [](entry const& lhs, entry const& rhs) {
+                    return lhs.key_ == rhs.key_;
+                }) != entries_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "checkpoint_file_writer::write",
+                "duplicate keys added to checkpoint file '{}'", path_);
+        }
+
+        detail::checkpoint_file_header header{};
+        std::memcpy(header.magic_, detail::checkpoint_file_magic,
+            sizeof(header.magic_));
+        header.version_ = detail::checkpoint_file_version;
+        header.num_entries_ = entries_.size();
+        header.index_offset_ = detail::align_checkpoint_offset(next_offset_);
+        header.base_path_size_ = base_path_.size();
+
+        std::vector<detail::checkpoint_file_entry> index(entries_.size());
+        for (std::size_t i = 0; i != entries_.size(); ++i)
+        {
+            entry const& e = entries_[i];
+            detail::checkpoint_file_entry& ie = index[i];
+
+            ie.key_ = e.key_;
+            ie.offset_ = e.offset_;
+            ie.size_ = e.size_;
+            if (e.inherited_)
+            {
+                ie.flags_ = static_cast<std::uint32_t>(
+                    detail::checkpoint_entry_flags::inherited);
+            }
+        }
+
+        // write() must not run concurrently with add(), don't hold on to the
+        // lock while performing I/O
+        l.unlock();
+
+        std::size_t const index_size =
+            index.size() * sizeof(detail::checkpoint_file_entry);
+
+#if defined(_POSIX_VERSION)
+        std::string const dir =
+            filesystem::absolute(filesystem::path(path_))
+                .parent_path()
+                .string();
+
+        // The header is written last and the file is flushed to disk before
+        // it replaces the checkpoint file. A crash at any point leaves either
+        // the old or the new checkpoint file behind, never a torn one.
+        int const error = detail::run_blocking([&]() {
+            int const fd = file_->fd_;
+            int result = detail::pwrite_all(fd,
+                reinterpret_cast<char const*>(index.data()), index_size,
+                header.index_offset_);
+            if (result == 0)
+            {
+                result = detail::pwrite_all(fd,
+                    reinterpret_cast<char const*>(&header), sizeof(header), 0);
+            }
+            if (result == 0 && ::fsync(fd) != 0)
+            {
+                result = errno;
+            }
+            if (result != 0)
+            {
+                return result;
+            }
+
+            file_->fd_ = -1;
+            if (::close(fd) != 0)
+            {
+                result = errno;
+                ::unlink(tmp_path_.c_str());
+                return result;
+            }
+            if (::rename(tmp_path_.c_str(), path_.c_str()) != 0)
+            {
+                result = errno;
+                ::unlink(tmp_path_.c_str());
+                return result;
+            }
+
+            // make the rename durable as well (best effort, not all file
+            // systems support syncing directories)
+            int const dirfd = ::open(dir.c_str(), O_RDONLY);
+            if (dirfd != -1)
+            {
+                ::fsync(dirfd);
+                ::close(dirfd);
+            }
+            return 0;
+        });
+        if (error != 0)
+        {
+            discard();
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_writer::write",
+                "unable to write checkpoint file '{}': {}", path_,
+                std::strerror(error));
+        }
+#else
+        std::ofstream& ofs = file_->ofs_;
+        ofs.seekp(static_cast<std::streamoff>(header.index_offset_));
+        ofs.write(reinterpret_cast<char const*>(index.data()),
+            static_cast<std::streamsize>(index_size));
+        ofs.seekp(0);
+        ofs.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        ofs.close();
+
+        // std::rename does not necessarily replace an existing file
+        bool success = !ofs.fail();
+        if (success)
+        {
+            std::remove(path_.c_str());
+            success = std::rename(tmp_path_.c_str(), path_.c_str()) == 0;
+        }
+        if (!success)
+        {
+            std::remove(tmp_path_.c_str());
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_writer::write",
+                "unable to write checkpoint file '{}'", path_);
+        }
+#endif
+    }
+}    // namespace hpx::util
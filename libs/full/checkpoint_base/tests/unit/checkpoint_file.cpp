@@ -0,0 +1,121 @@
+// Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint_base.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+void test_full_checkpoint(std::string const& path)
+{
+    {
+        hpx::util::checkpoint_file_writer writer(path);
+        for (std::uint64_t i = 0; i != 10; ++i)
+        {
+            std::vector<double> vec(100 * (i + 1), static_cast<double>(i));
+            HPX_TEST(writer.save(i, vec, std::to_string(i)));
+        }
+        HPX_TEST_EQ(writer.num_written(), std::size_t(10));
+        HPX_TEST_EQ(writer.num_inherited(), std::size_t(0));
+        writer.write();
+    }
+
+    hpx::util::checkpoint_file_reader reader(path);
+    HPX_TEST(!reader.is_incremental());
+    HPX_TEST_EQ(reader.keys().size(), std::size_t(10));
+    HPX_TEST(!reader.contains(10));
+
+    for (std::uint64_t i = 0; i != 10; ++i)
+    {
+        std::vector<double> vec;
+        std::string str;
+        reader.restore(i, vec, str);
+
+        HPX_TEST_EQ(vec.size(), std::size_t(100 * (i + 1)));
+        HPX_TEST_EQ(vec.front(), static_cast<double>(i));
+        HPX_TEST_EQ(str, std::to_string(i));
+    }
+}
+
+void test_incremental_checkpoint(
+    std::string const& base_path, std::string const& path)
+{
+    {
+        hpx::util::checkpoint_file_reader base(base_path);
+        hpx::util::checkpoint_file_writer writer(path, &base);
+        for (std::uint64_t i = 0; i != 10; ++i)
+        {
+            // modify every other object
+            double const value = (i % 2) ? -1.0 : static_cast<double>(i);
+            std::vector<double> vec(100 * (i + 1), value);
+            HPX_TEST_EQ(writer.save(i, vec, std::to_string(i)), i % 2 != 0);
+        }
+        HPX_TEST_EQ(writer.num_written(), std::size_t(5));
+        HPX_TEST_EQ(writer.num_inherited(), std::size_t(5));
+        writer.write();
+    }
+
+    hpx::util::checkpoint_file_reader reader(path);
+    HPX_TEST(reader.is_incremental());
+
+    for (std::uint64_t i = 0; i != 10; ++i)
+    {
+        std::vector<double> vec;
+        std::string str;
+        reader.restore(i, vec, str);
+
+        double const value = (i % 2) ? -1.0 : static_cast<double>(i);
+        HPX_TEST_EQ(vec.size(), std::size_t(100 * (i + 1)));
+        HPX_TEST_EQ(vec.back(), value);
+        HPX_TEST_EQ(str, std::to_string(i));
+    }
+}
+
+bool file_exists(std::string const& path)
+{
+    return std::ifstream(path).good();
+}
+
+void test_abandoned_checkpoint(std::string const& path)
+{
+    // a writer which is destroyed without calling write() leaves the existing
+    // checkpoint untouched and removes its temporary file
+    {
+        hpx::util::checkpoint_file_writer writer(path);
+        HPX_TEST(writer.save(0, std::string("abandoned")));
+        HPX_TEST(file_exists(path + ".tmp"));
+    }
+    HPX_TEST(!file_exists(path + ".tmp"));
+
+    hpx::util::checkpoint_file_reader reader(path);
+    HPX_TEST_EQ(reader.keys().size(), std::size_t(10));
+}
+
+int main()
+{
+    std::string const base_path = "checkpoint_file_test_base.ckpt";
+    std::string const path = "checkpoint_file_test_incremental.ckpt";
+
+    test_full_checkpoint(base_path);
+    test_incremental_checkpoint(base_path, path);
+    test_abandoned_checkpoint(base_path);
+
+    HPX_TEST(!file_exists(path + ".tmp"));
+    HPX_TEST(!file_exists(base_path + ".tmp"));
+
+    std::remove(path.c_str());
+    std::remove(base_path.c_str());
+
+    return hpx::util::report_errors();
+}
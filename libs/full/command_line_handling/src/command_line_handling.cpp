@@ -816,6 +816,7 @@ namespace hpx::util {
         }
 
         enable_logging_settings(vm, ini_config);
+        enable_profiling_settings(vm, ini_config);
 
         // handle command line arguments after logging defaults
         if (vm.count("hpx:ini"))
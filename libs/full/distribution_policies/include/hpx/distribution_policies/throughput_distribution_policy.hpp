@@ -0,0 +1,162 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file throughput_distribution_policy.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/traits/is_distribution_policy.hpp>
+#include <hpx/distribution_policies/default_distribution_policy.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // Split the given number of elements into partitions which are
+        // proportional to the given (positive) weights.
+        HPX_EXPORT std::vector<std::size_t> get_weighted_partition_sizes(
+            std::size_t size, std::vector<double> const& weights);
+        /// \endcond
+    }    // namespace detail
+
+    /// This class specifies the parameters of a distribution policy for
+    /// containers like hpx::partitioned_vector, which places one partition
+    /// onto each of the given localities. The number of elements in each
+    /// partition is proportional to the throughput measured for the
+    /// corresponding locality (e.g. the number of elements processed per
+    /// second), so that faster localities are assigned more elements.
+    ///
+    /// This policy can be used to create a container, or to rebalance an
+    /// existing hpx::partitioned_vector using its redistribute() function
+    /// once the throughput of the localities has been measured.
+    struct throughput_distribution_policy
+      : components::default_distribution_policy
+    {
+    public:
+        /// Default-construct a new instance of a
+        /// \a throughput_distribution_policy. This policy will represent one
+        /// partition on the locality the code is running on.
+        throughput_distribution_policy() = default;
+
+        /// Create a new \a throughput_distribution_policy representing one
+        /// partition on each of the given localities.
+        ///
+        /// \param localities   The list of localities the partitions should
+        ///                     be placed on
+        /// \param throughputs  The throughput measured for each of the
+        ///                     localities. Only the ratios of the given
+        ///                     values are used, they must not be negative and
+        ///                     at least one of them must be positive.
+        ///
+        throughput_distribution_policy operator()(
+            std::vector<id_type> const& localities,
+            std::vector<double> const& throughputs) const
+        {
+            return throughput_distribution_policy(localities, throughputs);
+        }
+
+        throughput_distribution_policy operator()(
+            std::vector<id_type>&& localities,
+            std::vector<double>&& throughputs) const
+        {
+            return throughput_distribution_policy(
+                HPX_MOVE(localities), HPX_MOVE(throughputs));
+        }
+
+        /// Returns the number of partitions represented by this policy
+        [[nodiscard]] std::size_t get_num_partitions() const noexcept
+        {
+            return localities_ ? localities_->size() :
+                                 static_cast<std::size_t>(1);
+        }
+
+        /// Returns the throughput values this policy was created with
+        [[nodiscard]] std::vector<double> const& get_throughputs()
+            const noexcept
+        {
+            return throughputs_;
+        }
+
+        /// Returns the number of elements to place into each of the
+        /// partitions for a container of the given size
+        [[nodiscard]] std::vector<std::size_t> get_partition_sizes(
+            std::size_t size) const
+        {
+            if (throughputs_.empty())
+                return std::vector<std::size_t>(1, size);
+
+            return detail::get_weighted_partition_sizes(size, throughputs_);
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & localities_ & throughputs_;
+            // clang-format on
+        }
+
+        HPX_EXPORT throughput_distribution_policy(
+            std::vector<id_type> const& localities,
+            std::vector<double> const& throughputs);
+
+        HPX_EXPORT throughput_distribution_policy(
+            std::vector<id_type>&& localities,
+            std::vector<double>&& throughputs);
+
+        // the measured throughput of each of the localities
+        std::vector<double> throughputs_;
+    };
+
+    /// A predefined instance of the \a throughput_distribution_policy. It
+    /// will represent the local locality and will place all items to create
+    /// here.
+    static throughput_distribution_policy const throughput_layout{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace traits {
+
+        template <>
+        struct is_distribution_policy<throughput_distribution_policy>
+          : std::true_type
+        {
+        };
+
+        template <>
+        struct num_container_partitions<throughput_distribution_policy>
+        {
+            static std::size_t call(
+                throughput_distribution_policy const& policy)
+            {
+                return policy.get_num_partitions();
+            }
+        };
+
+        template <>
+        struct container_partition_sizes<throughput_distribution_policy>
+        {
+            static std::vector<std::size_t> call(
+                throughput_distribution_policy const& policy, std::size_t size)
+            {
+                return policy.get_partition_sizes(size);
+            }
+        };
+    }    // namespace traits
+}    // namespace hpx
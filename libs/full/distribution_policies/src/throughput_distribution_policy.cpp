@@ -0,0 +1,122 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/distribution_policies/throughput_distribution_policy.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    namespace detail {
+
+        std::vector<std::size_t> get_weighted_partition_sizes(
+            std::size_t size, std::vector<double> const& weights)
+        {
+            HPX_ASSERT(!weights.empty());
+
+            double const total =
+                std::accumulate(weights.begin(), weights.end(), 0.0);
+            HPX_ASSERT(total > 0.0);
+
+            // assign the integral part of each share first, the remaining
+            // elements are given to the partitions with the largest
+            // fractional parts
+            std::vector<std::size_t> sizes(weights.size());
+            std::vector<std::pair<double, std::size_t>> remainders;
+            remainders.reserve(weights.size());
+
+            std::size_t assigned = 0;
+            for (std::size_t i = 0; i != weights.size(); ++i)
+            {
+                double const share =
+                    static_cast<double>(size) * (weights[i] / total);
+                double const whole = std::floor(share);
+
+                sizes[i] = (std::min)(
+                    static_cast<std::size_t>(whole), size - assigned);
+                assigned += sizes[i];
+
+                remainders.emplace_back(share - whole, i);
+            }
+
+            std::stable_sort(remainders.begin(), remainders.end(),
+                [](auto const& lhs, auto const& rhs) {
+                    return lhs.first > rhs.first;
+                });
+
+            for (std::size_t i = 0; assigned != size; ++i)
+            {
+                ++sizes[remainders[i % remainders.size()].second];
+                ++assigned;
+            }
+
+            return sizes;
+        }
+
+        namespace {
+
+            void validate_throughputs(std::size_t num_localities,
+                std::vector<double> const& throughputs)
+            {
+                if (throughputs.size() != num_localities)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "throughput_distribution_policy::"
+                        "throughput_distribution_policy",
+                        "the number of throughput values ({}) does not match "
+                        "the number of localities ({})",
+                        throughputs.size(), num_localities);
+                }
+
+                bool has_positive = false;
+                for (double const value : throughputs)
+                {
+                    if (!(value >= 0.0) || std::isinf(value))
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                            "throughput_distribution_policy::"
+                            "throughput_distribution_policy",
+                            "invalid throughput value: {}", value);
+                    }
+                    has_positive = has_positive || value > 0.0;
+                }
+
+                if (!has_positive)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "throughput_distribution_policy::"
+                        "throughput_distribution_policy",
+                        "at least one throughput value has to be positive");
+                }
+            }
+        }    // namespace
+    }    // namespace detail
+
+    throughput_distribution_policy::throughput_distribution_policy(
+        std::vector<id_type> const& localities,
+        std::vector<double> const& throughputs)
+      : components::default_distribution_policy(localities)
+      , throughputs_(throughputs)
+    {
+        detail::validate_throughputs(localities_->size(), throughputs_);
+    }
+
+    throughput_distribution_policy::throughput_distribution_policy(
+        std::vector<id_type>&& localities, std::vector<double>&& throughputs)
+      : components::default_distribution_policy(HPX_MOVE(localities))
+      , throughputs_(HPX_MOVE(throughputs))
+    {
+        detail::validate_throughputs(localities_->size(), throughputs_);
+    }
+}    // namespace hpx
@@ -61,6 +61,7 @@ namespace hpx::parcelset::policies::gasnet {
             data.time_ = timer_.elapsed_nanoseconds();
             data.bytes_ = static_cast<std::size_t>(header_.numbytes());
 #endif
+            buffer_.reserve(static_cast<std::size_t>(header_.size()));
             buffer_.data_.resize(static_cast<std::size_t>(header_.size()));
             buffer_.num_chunks_ = header_.num_chunks();
         }
@@ -77,6 +77,7 @@ namespace hpx::parcelset::policies::mpi {
             needs_ack_handshake_ = header_.get_ack_handshakes();
 
             // decode data
+            buffer_.reserve(header_.numbytes_nonzero_copy());
             buffer_.data_.resize(header_.numbytes_nonzero_copy());
             if (char* piggy_back_data = header_.piggy_back_data())
             {
@@ -196,6 +196,9 @@ namespace hpx::parcelset::policies::tcp {
                 auto const num_non_zero_copy_chunks = static_cast<std::size_t>(
                     static_cast<std::uint32_t>(buffer_.num_chunks_.second));
 
+                // take the main buffer from the parcel buffer pool
+                buffer_.reserve(static_cast<std::size_t>(inbound_size));
+
                 void (receiver::*f)(std::error_code const&, Handler);
 
                 if (num_zero_copy_chunks != 0)
@@ -0,0 +1,163 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Process-wide cache of serialization buffers used for sending and
+    // receiving parcels. Buffers are bucketed by power-of-two size classes
+    // (based on their capacity), which allows to hand out a buffer that is
+    // large enough for a given (pre-computed) message size without having to
+    // allocate memory (and without reallocating while serializing). The
+    // overall capacity of the cached buffers is limited by a byte budget
+    // (configured using hpx.parcel.buffer_pool_size).
+    class HPX_EXPORT parcel_buffer_pool
+    {
+    public:
+        using buffer_type = std::vector<char>;
+
+        // smallest and largest pooled size classes (512 bytes ... 64 MiB),
+        // buffers outside of this range are not cached
+        static constexpr std::size_t min_size_class_log2 = 9;
+        static constexpr std::size_t max_size_class_log2 = 26;
+        static constexpr std::size_t num_size_classes =
+            max_size_class_log2 - min_size_class_log2 + 1;
+
+        // maximal number of buffers kept per size class
+        static constexpr std::size_t max_cached_buffers = 32;
+
+        // default limit of the overall capacity of all cached buffers
+        static constexpr std::size_t default_max_cached_bytes =
+            std::size_t(256) * 1024 * 1024;
+
+        explicit parcel_buffer_pool(
+            std::size_t max_cached_bytes = default_max_cached_bytes) noexcept
+          : max_cached_bytes_(max_cached_bytes)
+        {
+        }
+
+        ~parcel_buffer_pool();
+
+        parcel_buffer_pool(parcel_buffer_pool const&) = delete;
+        parcel_buffer_pool(parcel_buffer_pool&&) = delete;
+        parcel_buffer_pool& operator=(parcel_buffer_pool const&) = delete;
+        parcel_buffer_pool& operator=(parcel_buffer_pool&&) = delete;
+
+        // Return an empty buffer with a capacity of at least 'size' bytes.
+        [[nodiscard]] buffer_type acquire(std::size_t size);
+
+        // Give a buffer back to the pool, its contents are discarded.
+        void release(buffer_type&& buffer) noexcept;
+
+        // Record that a buffer had to be grown while serializing.
+        void add_reallocated_bytes(std::size_t bytes) noexcept
+        {
+            reallocated_bytes_.fetch_add(
+                static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+        }
+
+        // Release all cached buffers.
+        void clear() noexcept;
+
+        // Change the limit of the overall capacity of all cached buffers,
+        // cached buffers exceeding a lowered limit are not released.
+        void set_max_cached_bytes(std::size_t max_cached_bytes) noexcept
+        {
+            max_cached_bytes_.store(
+                max_cached_bytes, std::memory_order_relaxed);
+        }
+
+        // Return the overall capacity of all cached buffers.
+        [[nodiscard]] std::size_t get_cached_bytes() const noexcept
+        {
+            return cached_bytes_.load(std::memory_order_relaxed);
+        }
+
+        // performance counter data
+        std::int64_t get_hits(bool reset) noexcept;
+        std::int64_t get_misses(bool reset) noexcept;
+        std::int64_t get_reallocated_bytes(bool reset) noexcept;
+
+        // Return the index of the smallest size class able to hold 'size'
+        // bytes (may be num_size_classes if the size is not pooled).
+        [[nodiscard]] static constexpr std::size_t size_class(
+            std::size_t size) noexcept
+        {
+            std::size_t log2 = min_size_class_log2;
+            while (log2 <= max_size_class_log2 &&
+                (static_cast<std::size_t>(1) << log2) < size)
+            {
+                ++log2;
+            }
+            return log2 - min_size_class_log2;
+        }
+
+    private:
+        // Return the index of the largest size class a buffer of the given
+        // capacity can serve (may be num_size_classes if it is not pooled).
+        [[nodiscard]] static constexpr std::size_t capacity_class(
+            std::size_t capacity) noexcept
+        {
+            if (capacity <
+                    (static_cast<std::size_t>(1) << min_size_class_log2) ||
+                capacity >
+                    (static_cast<std::size_t>(1) << (max_size_class_log2 + 1)))
+            {
+                return num_size_classes;
+            }
+
+            std::size_t log2 = min_size_class_log2;
+            while (log2 < max_size_class_log2 &&
+                (static_cast<std::size_t>(1) << (log2 + 1)) <= capacity)
+            {
+                ++log2;
+            }
+            return log2 - min_size_class_log2;
+        }
+
+        struct bucket
+        {
+            hpx::spinlock mtx_;
+            std::vector<buffer_type> buffers_;
+        };
+
+        std::array<hpx::util::cache_aligned_data<bucket>, num_size_classes>
+            buckets_;
+
+        std::atomic<std::size_t> max_cached_bytes_;
+        std::atomic<std::size_t> cached_bytes_ = 0;
+
+        std::atomic<std::int64_t> hits_ = 0;
+        std::atomic<std::int64_t> misses_ = 0;
+        std::atomic<std::int64_t> reallocated_bytes_ = 0;
+    };
+
+    // Access the buffer pool shared by all parcelports of this locality. The
+    // pool is never destroyed as parcel buffers may be released during static
+    // destruction, the cached buffers are released when the parcelhandler is
+    // stopped.
+    HPX_EXPORT parcel_buffer_pool& get_parcel_buffer_pool();
+}    // namespace hpx::parcelset::detail
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
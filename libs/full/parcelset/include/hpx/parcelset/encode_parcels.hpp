@@ -23,6 +23,7 @@
 #include <hpx/actions_base/basic_action.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/parcelset/detail/parcel_buffer_pool.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
@@ -192,9 +193,13 @@ namespace hpx::parcelset {
                     num_chunks += ps[parcels_sent].num_chunks();
                 }
 
-                buffer.data_.reserve(arg_size);
+                // the parcel sizes were computed by the preprocessing pass
+                // (see parcel_await), allocate the buffer only once
+                buffer.reserve(arg_size);
                 buffer.chunks_.reserve(num_chunks);
 
+                std::size_t const initial_capacity = buffer.data_.capacity();
+
                 // mark start of serialization
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 hpx::chrono::high_resolution_timer const timer;
@@ -248,6 +253,14 @@ namespace hpx::parcelset {
                     arg_size = archive.bytes_written();
                 }
 
+                // keep track of the bytes which did not fit into the
+                // preallocated buffer
+                if (buffer.data_.size() > initial_capacity)
+                {
+                    detail::get_parcel_buffer_pool().add_reallocated_bytes(
+                        buffer.data_.size() - initial_capacity);
+                }
+
                 // store the time required for serialization
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 buffer.data_point_.serialization_time_ =
@@ -10,11 +10,15 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
 #include <hpx/modules/serialization.hpp>
 
+#include <hpx/parcelset/detail/parcel_buffer_pool.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -28,6 +32,9 @@ namespace hpx::parcelset {
         using transmission_chunk_type = std::pair<std::uint64_t, std::uint64_t>;
         using allocator_type = typename BufferType::allocator_type;
 
+        static constexpr bool is_pooled = std::is_same_v<BufferType,
+            detail::parcel_buffer_pool::buffer_type>;
+
         explicit parcel_buffer(
             allocator_type const& allocator = allocator_type())
           : data_(allocator)
@@ -59,7 +66,66 @@ namespace hpx::parcelset {
         }
 
         parcel_buffer(parcel_buffer&& other) = default;
-        parcel_buffer& operator=(parcel_buffer&& other) = default;
+
+        parcel_buffer& operator=(parcel_buffer&& other) noexcept
+        {
+            if (this != &other)
+            {
+                // give the currently held buffer back to the pool instead of
+                // simply deallocating it
+                if constexpr (is_pooled)
+                {
+                    detail::get_parcel_buffer_pool().release(
+                        std::exchange(data_, HPX_MOVE(other.data_)));
+                }
+                else
+                {
+                    data_ = HPX_MOVE(other.data_);
+                }
+
+                chunks_ = HPX_MOVE(other.chunks_);
+                transmission_chunks_ = HPX_MOVE(other.transmission_chunks_);
+                num_chunks_ = other.num_chunks_;
+                size_ = other.size_;
+                data_size_ = other.data_size_;
+                header_size_ = other.header_size_;
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                data_point_ = HPX_MOVE(other.data_point_);
+#endif
+            }
+            return *this;
+        }
+
+        ~parcel_buffer()
+        {
+            if constexpr (is_pooled)
+            {
+                detail::get_parcel_buffer_pool().release(HPX_MOVE(data_));
+            }
+        }
+
+        // Make sure the data buffer can hold at least 'size' bytes without
+        // having to be reallocated. Plain std::vector<char> buffers are taken
+        // from the parcel buffer pool, if possible.
+        void reserve(std::size_t size)
+        {
+            if (data_.capacity() >= size)
+            {
+                return;
+            }
+
+            if constexpr (is_pooled)
+            {
+                HPX_ASSERT(data_.empty());
+
+                auto& pool = detail::get_parcel_buffer_pool();
+                pool.release(std::exchange(data_, pool.acquire(size)));
+            }
+            else
+            {
+                data_.reserve(size);
+            }
+        }
 
         void clear()
         {
@@ -0,0 +1,159 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelset/detail/parcel_buffer_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::detail {
+
+    parcel_buffer_pool::~parcel_buffer_pool()
+    {
+        clear();
+    }
+
+    parcel_buffer_pool::buffer_type parcel_buffer_pool::acquire(
+        std::size_t size)
+    {
+        std::size_t const cls = size_class(size);
+        if (cls < num_size_classes)
+        {
+            bucket& b = buckets_[cls].data_;
+
+            std::unique_lock l(b.mtx_);
+            if (!b.buffers_.empty())
+            {
+                buffer_type buffer = HPX_MOVE(b.buffers_.back());
+                b.buffers_.pop_back();
+                l.unlock();
+
+                cached_bytes_.fetch_sub(
+                    buffer.capacity(), std::memory_order_relaxed);
+
+                ++hits_;
+                HPX_ASSERT(buffer.empty() && buffer.capacity() >= size);
+                return buffer;
+            }
+            l.unlock();
+
+            // round the allocation up to the size class, this makes sure the
+            // buffer ends up in the same bucket once it is released
+            size = static_cast<std::size_t>(1) << (cls + min_size_class_log2);
+        }
+
+        ++misses_;
+
+        buffer_type buffer;
+        buffer.reserve(size);
+        return buffer;
+    }
+
+    void parcel_buffer_pool::release(buffer_type&& buffer) noexcept
+    {
+        std::size_t const cls = capacity_class(buffer.capacity());
+        if (cls >= num_size_classes)
+        {
+            return;    // not pooled, just let it go
+        }
+
+        // account for the buffer before caching it, this keeps the overall
+        // capacity within the budget even for concurrent releases
+        std::size_t const capacity = buffer.capacity();
+        if (cached_bytes_.fetch_add(capacity, std::memory_order_relaxed) +
+                capacity >
+            max_cached_bytes_.load(std::memory_order_relaxed))
+        {
+            cached_bytes_.fetch_sub(capacity, std::memory_order_relaxed);
+            return;
+        }
+
+        buffer.clear();
+
+        bucket& b = buckets_[cls].data_;
+        std::lock_guard l(b.mtx_);
+        if (b.buffers_.size() < max_cached_buffers)
+        {
+            // std::vector::push_back may throw if the bucket itself has to
+            // grow, reserve the full bucket once to avoid this
+            bool reserved = true;
+            if (b.buffers_.capacity() == 0)
+            {
+                try
+                {
+                    b.buffers_.reserve(max_cached_buffers);
+                }
+                catch (...)
+                {
+                    reserved = false;
+                }
+            }
+
+            if (reserved)
+            {
+                b.buffers_.push_back(HPX_MOVE(buffer));
+                return;
+            }
+        }
+
+        cached_bytes_.fetch_sub(capacity, std::memory_order_relaxed);
+    }
+
+    void parcel_buffer_pool::clear() noexcept
+    {
+        for (auto& aligned_bucket : buckets_)
+        {
+            bucket& b = aligned_bucket.data_;
+
+            std::vector<buffer_type> buffers;
+            {
+                std::lock_guard l(b.mtx_);
+                std::swap(buffers, b.buffers_);
+            }
+
+            for (buffer_type const& buffer : buffers)
+            {
+                cached_bytes_.fetch_sub(
+                    buffer.capacity(), std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::int64_t parcel_buffer_pool::get_hits(bool reset) noexcept
+    {
+        return util::get_and_reset_value(hits_, reset);
+    }
+
+    std::int64_t parcel_buffer_pool::get_misses(bool reset) noexcept
+    {
+        return util::get_and_reset_value(misses_, reset);
+    }
+
+    std::int64_t parcel_buffer_pool::get_reallocated_bytes(bool reset) noexcept
+    {
+        return util::get_and_reset_value(reallocated_bytes_, reset);
+    }
+
+    parcel_buffer_pool& get_parcel_buffer_pool()
+    {
+        // the pool is intentionally leaked, parcel buffers owned by other
+        // static objects may be released after it would have been destroyed
+        static parcel_buffer_pool* pool = new parcel_buffer_pool();
+        return *pool;
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
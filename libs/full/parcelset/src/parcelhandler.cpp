@@ -33,6 +33,7 @@
 
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parcelset/detail/parcel_buffer_pool.hpp>
 #include <hpx/parcelset/init_parcelports.hpp>
 #include <hpx/parcelset/message_handler_fwd.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
@@ -112,6 +113,11 @@ namespace hpx::parcelset {
         if (is_networking_enabled_ &&
             cfg.get_entry("hpx.parcel.enable", "1") != "0")
         {
+            detail::get_parcel_buffer_pool().set_max_cached_bytes(
+                util::get_entry_as<std::size_t>(cfg,
+                    "hpx.parcel.buffer_pool_size",
+                    detail::parcel_buffer_pool::default_max_cached_bytes));
+
             for (plugins::parcelport_factory_base* factory :
                 get_parcelport_factories())
             {
@@ -429,6 +435,9 @@ namespace hpx::parcelset {
 
         // release all message handlers
         handlers_.clear();
+
+        // release the memory held by the cached parcel buffers
+        detail::get_parcel_buffer_pool().clear();
     }
 
     bool parcelhandler::get_raw_remote_localities(
@@ -1423,6 +1432,11 @@ namespace hpx::parcelset {
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
+        ini_defs.emplace_back("buffer_pool_size = "
+                              "${HPX_PARCEL_BUFFER_POOL_SIZE:" +
+            std::to_string(
+                detail::parcel_buffer_pool::default_max_cached_bytes) +
+            "}");
 
         for (plugins::parcelport_factory_base* f :
             parcelhandler::get_parcelport_factories())
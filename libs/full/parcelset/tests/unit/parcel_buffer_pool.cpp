@@ -0,0 +1,161 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/detail/parcel_buffer_pool.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using hpx::parcelset::detail::parcel_buffer_pool;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_size_classes()
+{
+    HPX_TEST_EQ(parcel_buffer_pool::size_class(0), std::size_t(0));
+    HPX_TEST_EQ(parcel_buffer_pool::size_class(512), std::size_t(0));
+    HPX_TEST_EQ(parcel_buffer_pool::size_class(513), std::size_t(1));
+    HPX_TEST_EQ(parcel_buffer_pool::size_class(4096), std::size_t(3));
+    HPX_TEST_EQ(parcel_buffer_pool::size_class(std::size_t(1) << 26),
+        parcel_buffer_pool::num_size_classes - 1);
+    HPX_TEST_EQ(parcel_buffer_pool::size_class((std::size_t(1) << 26) + 1),
+        parcel_buffer_pool::num_size_classes);
+}
+
+void test_acquire_release()
+{
+    parcel_buffer_pool pool;
+
+    std::vector<char> buffer = pool.acquire(1000);
+    HPX_TEST(buffer.empty());
+    HPX_TEST_LTE(std::size_t(1000), buffer.capacity());
+    HPX_TEST_EQ(pool.get_hits(false), 0);
+    HPX_TEST_EQ(pool.get_misses(false), 1);
+
+    char const* data = buffer.data();
+    buffer.resize(1000);
+    pool.release(std::move(buffer));
+
+    // a smaller request of the same size class reuses the buffer
+    std::vector<char> reused = pool.acquire(600);
+    HPX_TEST(reused.empty());
+    HPX_TEST_EQ(reused.data(), data);
+    HPX_TEST_EQ(pool.get_hits(true), 1);
+    HPX_TEST_EQ(pool.get_hits(false), 0);
+
+    // a larger request can't be served from the pool
+    pool.release(std::move(reused));
+    std::vector<char> larger = pool.acquire(2048);
+    HPX_TEST_LTE(std::size_t(2048), larger.capacity());
+    HPX_TEST_EQ(pool.get_misses(false), 2);
+
+    // buffers outside of the pooled size range are dropped
+    std::vector<char> small;
+    small.reserve(16);
+    pool.release(std::move(small));
+    HPX_TEST_LTE(std::size_t(512), pool.acquire(16).capacity());
+    HPX_TEST_EQ(pool.get_misses(false), 3);
+}
+
+// the overall capacity of the cached buffers is limited
+void test_byte_budget()
+{
+    parcel_buffer_pool pool(4096);
+
+    std::vector<std::vector<char>> buffers;
+    for (int i = 0; i != 3; ++i)
+    {
+        buffers.push_back(pool.acquire(2048));
+    }
+
+    for (auto& buffer : buffers)
+    {
+        pool.release(std::move(buffer));
+    }
+    HPX_TEST_EQ(pool.get_cached_bytes(), std::size_t(4096));
+
+    // two of the buffers are served from the pool
+    HPX_TEST_EQ(pool.get_hits(true), 0);
+    for (int i = 0; i != 3; ++i)
+    {
+        buffers[i] = pool.acquire(2048);
+    }
+    HPX_TEST_EQ(pool.get_hits(false), 2);
+    HPX_TEST_EQ(pool.get_cached_bytes(), std::size_t(0));
+
+    for (auto& buffer : buffers)
+    {
+        pool.release(std::move(buffer));
+    }
+    pool.clear();
+    HPX_TEST_EQ(pool.get_cached_bytes(), std::size_t(0));
+
+    // buffers are not cached at all without a budget
+    pool.set_max_cached_bytes(0);
+    pool.release(pool.acquire(1000));
+    HPX_TEST_EQ(pool.get_cached_bytes(), std::size_t(0));
+}
+
+void test_parcel_buffer()
+{
+    using parcel_buffer_type = hpx::parcelset::parcel_buffer<std::vector<char>>;
+    auto& pool = hpx::parcelset::detail::get_parcel_buffer_pool();
+
+    char const* data = nullptr;
+    {
+        parcel_buffer_type buffer;
+        buffer.reserve(10000);
+        HPX_TEST_LTE(std::size_t(10000), buffer.data_.capacity());
+        data = buffer.data_.data();
+    }
+
+    // the buffer was returned to the pool once the parcel buffer went away
+    std::int64_t const hits = pool.get_hits(false);
+    {
+        parcel_buffer_type buffer;
+        buffer.reserve(9000);
+        HPX_TEST_EQ(buffer.data_.data(), data);
+    }
+    HPX_TEST_EQ(pool.get_hits(false), hits + 1);
+}
+
+// resetting a parcel buffer by assigning an empty one (as done by the
+// receivers) returns the previously held buffer to the pool
+void test_parcel_buffer_move_assign()
+{
+    using parcel_buffer_type = hpx::parcelset::parcel_buffer<std::vector<char>>;
+    auto& pool = hpx::parcelset::detail::get_parcel_buffer_pool();
+
+    parcel_buffer_type buffer;
+    buffer.reserve(20000);
+    char const* data = buffer.data_.data();
+
+    buffer = parcel_buffer_type();
+    HPX_TEST_EQ(buffer.data_.capacity(), std::size_t(0));
+
+    std::int64_t const hits = pool.get_hits(false);
+    buffer.reserve(17000);
+    HPX_TEST_EQ(buffer.data_.data(), data);
+    HPX_TEST_EQ(pool.get_hits(false), hits + 1);
+}
+
+int main()
+{
+    test_size_classes();
+    test_acquire_release();
+    test_byte_budget();
+    test_parcel_buffer();
+    test_parcel_buffer_move_assign();
+
+    return hpx::util::report_errors();
+}
+#endif
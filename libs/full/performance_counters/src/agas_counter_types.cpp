@@ -65,6 +65,13 @@ namespace hpx { namespace performance_counters {
                 &agas::addressing_service::get_cache_erase_entry_time,
                 &client));
 
+        hpx::function<std::int64_t(bool)> refcnt_decrements(hpx::bind_front(
+            &agas::addressing_service::get_refcnt_decrement_count, &client));
+        hpx::function<std::int64_t(bool)> refcnt_coalesced(hpx::bind_front(
+            &agas::addressing_service::get_refcnt_coalesced_count, &client));
+        hpx::function<std::int64_t(bool)> refcnt_messages(hpx::bind_front(
+            &agas::addressing_service::get_refcnt_message_count, &client));
+
         using placeholders::_1;
         using placeholders::_2;
         performance_counters::generic_counter_type_data const counter_types[] =
@@ -196,6 +203,37 @@ namespace hpx { namespace performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         cache_erase_entry_time, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/decrements",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of global reference count decrement "
+                    "requests issued by this locality",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_decrements, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/coalesced",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of global reference count requests "
+                    "which were combined with a pending request for the same "
+                    "global id",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_coalesced, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/messages",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of bulk reference count decrement "
+                    "messages sent by this locality",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_messages, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
             };
 
         performance_counters::install_counter_types(
@@ -9,6 +9,7 @@
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/parcelset/detail/parcel_buffer_pool.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/counters.hpp>
@@ -598,6 +599,16 @@ namespace hpx::performance_counters {
         hpx::function<std::int64_t(bool)> outgoing_routed_count(
             hpx::bind_front(&parcelhandler::get_parcel_routed_count, &ph));
 
+        auto& pool = parcelset::detail::get_parcel_buffer_pool();
+        hpx::function<std::int64_t(bool)> buffer_pool_hits(hpx::bind_front(
+            &parcelset::detail::parcel_buffer_pool::get_hits, &pool));
+        hpx::function<std::int64_t(bool)> buffer_pool_misses(hpx::bind_front(
+            &parcelset::detail::parcel_buffer_pool::get_misses, &pool));
+        hpx::function<std::int64_t(bool)> buffer_pool_reallocated(
+            hpx::bind_front(
+                &parcelset::detail::parcel_buffer_pool::get_reallocated_bytes,
+                &pool));
+
         performance_counters::generic_counter_type_data const counter_types[] =
             {{"/parcelqueue/length/receive",
                  performance_counters::counter_type::raw,
@@ -625,6 +636,38 @@ namespace hpx::performance_counters {
                     hpx::bind(
                         &performance_counters::locality_raw_counter_creator, _1,
                         outgoing_routed_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcelport/count/buffer-pool/hits",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of parcel buffers which were served "
+                    "from the parcel buffer pool",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        buffer_pool_hits, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcelport/count/buffer-pool/misses",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of parcel buffers which had to be "
+                    "newly allocated as the parcel buffer pool had no "
+                    "suitable buffer available",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        buffer_pool_misses, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcelport/data/buffer-pool/reallocated",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the accumulated capacity (in bytes) of parcel "
+                    "buffers which had to be grown while serializing outgoing "
+                    "messages",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        buffer_pool_reallocated, _2),
                     &performance_counters::locality_counter_discoverer, ""}};
 
         performance_counters::install_counter_types(
@@ -678,6 +678,29 @@ namespace hpx::performance_counters {
                     &threads::thread_pool_base::get_num_stolen_to_staged),
                 &locality_pool_thread_counter_discoverer, ""},
 #endif
+            // forced yields
+            {"/threads/count/forced-yields",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads which yielded "
+                "because their time slice expired (see hpx.time_slice) for "
+                "the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_forced_yield_count,
+                    &threads::thread_pool_base::get_forced_yield_count),
+                &locality_pool_thread_counter_discoverer, ""},
+            // throttled spawns
+            {"/threads/count/throttled-spawns",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads whose creation was "
+                "throttled because the admission limit of the thread pool was "
+                "reached (see hpx.admission.limit) for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_throttled_spawn_count,
+                    &threads::thread_pool_base::get_throttled_spawn_count),
+                &locality_pool_thread_counter_discoverer, ""},
             // scheduler utilization
             {"/scheduler/utilization/instantaneous", counter_type::raw,
                 "returns the current scheduler utilization",
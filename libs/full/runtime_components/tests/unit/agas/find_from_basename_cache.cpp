@@ -0,0 +1,110 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the locality-local cache of resolved names never returns a
+// name which was unregistered (by any locality).
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+char const* const test_basename = "/find_from_basename_cache_test/";
+
+///////////////////////////////////////////////////////////////////////////////
+// replace the component registered with the given sequence number by a new
+// component created on the locality this function is executed on
+hpx::id_type rebind(std::size_t sequence_nr)
+{
+    hpx::id_type const old_id =
+        hpx::unregister_with_basename(test_basename, sequence_nr).get();
+    HPX_TEST_NEQ(hpx::invalid_id, old_id);
+
+    hpx::id_type id = hpx::new_<test_server>(hpx::find_here()).get();
+    HPX_TEST(hpx::register_with_basename(test_basename, id, sequence_nr).get());
+
+    return id;
+}
+HPX_PLAIN_ACTION(rebind, rebind_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_find_from_basename_cache(std::size_t num_names)
+{
+    std::vector<hpx::id_type> ids;
+    ids.reserve(num_names);
+
+    // the names will be hosted by all localities
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        ids.push_back(hpx::new_<test_server>(hpx::find_here()).get());
+        HPX_TEST(
+            hpx::register_with_basename(test_basename, ids.back(), i).get());
+    }
+
+    // resolve all names twice, the second lookup is served from the cache
+    for (int pass = 0; pass != 2; ++pass)
+    {
+        for (std::size_t i = 0; i != num_names; ++i)
+        {
+            HPX_TEST_EQ(
+                hpx::find_from_basename(test_basename, i).get(), ids[i]);
+        }
+    }
+
+    // rebind all names from another locality
+    std::vector<hpx::id_type> const localities = hpx::find_remote_localities();
+    hpx::id_type const target =
+        localities.empty() ? hpx::find_here() : localities.front();
+
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        ids[i] = hpx::async(rebind_action(), target, i).get();
+        HPX_TEST_EQ(hpx::find_from_basename(test_basename, i).get(), ids[i]);
+        HPX_TEST_EQ(hpx::get_colocation_id(hpx::launch::sync, ids[i]), target);
+    }
+
+    // rebind all names from this locality
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        ids[i] = rebind(i);
+        HPX_TEST_EQ(hpx::find_from_basename(test_basename, i).get(), ids[i]);
+    }
+
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        HPX_TEST_EQ(
+            hpx::unregister_with_basename(test_basename, i).get(), ids[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_find_from_basename_cache(100);
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,224 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark emulates a bind/resolve/unbind storm as seen by the primary
+// namespace on the root locality. It compares the sharded GVA table used by
+// the primary namespace with a std::map protected by a single lock (the
+// previous implementation).
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/agas_base/server/gva_table.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::server::gva_table;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+// GVA table protected by a single lock
+struct locked_gva_table
+{
+    using mutex_type = hpx::spinlock;
+
+    bool bind(gid_type const& id, gva const& g, gid_type const& locality)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return gvas_.emplace(id, gva_table::data_type(g, locality)).second;
+    }
+
+    bool unbind(gid_type const& id, std::uint64_t count,
+        gva_table::data_type& data)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        auto const it = gvas_.find(id);
+        if (it == gvas_.end() || it->second.first.count != count)
+            return false;
+
+        data = it->second;
+        gvas_.erase(it);
+        return true;
+    }
+
+    gva_table::resolved_type resolve(gid_type const& id) const
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        auto it = gvas_.upper_bound(id);
+        if (it != gvas_.begin())
+        {
+            --it;
+            if (it->first + it->second.first.count > id)
+            {
+                return gva_table::resolved_type(
+                    it->first, it->second.first, it->second.second);
+            }
+        }
+        return gva_table::resolved_type(hpx::naming::invalid_gid, gva(),
+            hpx::naming::invalid_gid);
+    }
+
+    mutable mutex_type mtx_;
+    std::map<gid_type, gva_table::data_type> gvas_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+bool bind(gva_table& table, gid_type const& id, gva const& g,
+    gid_type const& locality)
+{
+    return table.bind(id, g, locality) == gva_table::bind_result::inserted;
+}
+
+bool bind(locked_gva_table& table, gid_type const& id, gva const& g,
+    gid_type const& locality)
+{
+    return table.bind(id, g, locality);
+}
+
+bool unbind(gva_table& table, gid_type const& id, std::uint64_t count)
+{
+    gva_table::data_type data;
+    return table.unbind(id, count, data) == gva_table::unbind_result::unbound;
+}
+
+bool unbind(locked_gva_table& table, gid_type const& id, std::uint64_t count)
+{
+    gva_table::data_type data;
+    return table.unbind(id, count, data);
+}
+
+// Every task emulates the objects created by one locality: it binds blocks
+// of gids, resolves each of them several times, and unbinds them again.
+template <typename Table>
+void stress_task(Table& table, std::uint32_t locality_id,
+    std::size_t num_objects, std::size_t block_size, std::size_t resolves)
+{
+    gid_type const locality(
+        (std::uint64_t(locality_id) + 1) << 32, std::uint64_t(0));
+    gid_type const first(locality.get_msb() + 1, 0x1000);
+
+    gva const g(locality, 1, block_size, std::uint64_t(0x1000));
+
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        HPX_TEST(bind(table, first + i * block_size, g, locality));
+    }
+
+    for (std::size_t r = 0; r != resolves; ++r)
+    {
+        for (std::size_t i = 0; i != num_objects * block_size; ++i)
+        {
+            gid_type const id = first + i;
+            gid_type const base = first + (i / block_size) * block_size;
+            HPX_TEST_EQ(hpx::get<0>(table.resolve(id)), base);
+        }
+    }
+
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        HPX_TEST(unbind(table, first + i * block_size, block_size));
+    }
+}
+
+template <typename Table>
+double run_stress(std::size_t num_tasks, std::size_t num_objects,
+    std::size_t block_size, std::size_t resolves)
+{
+    Table table;
+
+    hpx::chrono::high_resolution_timer const t;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([&table, i, num_objects, block_size,
+                                       resolves]() {
+            stress_task(table, static_cast<std::uint32_t>(i), num_objects,
+                block_size, resolves);
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    return t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>() != 0 ?
+        vm["tasks"].as<std::size_t>() :
+        hpx::get_os_thread_count();
+    std::size_t const num_objects = vm["objects"].as<std::size_t>();
+    std::size_t const block_size = vm["block-size"].as<std::size_t>();
+    std::size_t const resolves = vm["resolves"].as<std::size_t>();
+
+    // the overall number of operations executed by all tasks
+    double const num_ops = static_cast<double>(num_tasks) *
+        static_cast<double>(
+            num_objects * 2 + num_objects * block_size * resolves);
+
+    double const sharded = run_stress<gva_table>(
+        num_tasks, num_objects, block_size, resolves);
+    double const locked = run_stress<locked_gva_table>(
+        num_tasks, num_objects, block_size, resolves);
+
+    std::cout << "tasks: " << num_tasks << ", objects per task: "
+              << num_objects << ", block size: " << block_size
+              << ", resolves: " << resolves << "\n"
+              << "sharded gva table: " << sharded << " [s], "
+              << num_ops / sharded << " [ops/s]\n"
+              << "locked gva table:  " << locked << " [s], "
+              << num_ops / locked << " [ops/s]\n";
+
+    hpx::util::print_cdash_timing("AGASShardedGVATable", sharded);
+    hpx::util::print_cdash_timing("AGASLockedGVATable", locked);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks", value<std::size_t>()->default_value(0),
+         "number of concurrent tasks, each emulating a different locality "
+         "(default: number of worker threads)")
+        ("objects", value<std::size_t>()->default_value(10000),
+         "number of objects bound by each task (default: 10000)")
+        ("block-size", value<std::size_t>()->default_value(1),
+         "number of gids bound as one block (default: 1)")
+        ("resolves", value<std::size_t>()->default_value(10),
+         "number of times each gid is resolved (default: 10)");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,172 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the effect of the schedule hints for continuations
+// on a stencil-style dependency chain. Every partition of a time step is
+// computed by a dataflow depending on the neighboring partitions of the
+// previous time step. The continuations are scheduled without hint (default),
+// on the worker thread that made the last input ready (local_thread), on the
+// NUMA domain of that worker thread (local_numa), or are run directly on the
+// stack of that worker thread (work_first).
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using partition = std::vector<double>;
+using partition_future = hpx::shared_future<partition>;
+
+partition heat_part(partition_future const& left,
+    partition_future const& middle, partition_future const& right)
+{
+    partition const& l = left.get();
+    partition const& m = middle.get();
+    partition const& r = right.get();
+
+    std::size_t const size = m.size();
+    partition next(size);
+
+    next[0] = m[0] + 0.5 * (l[size - 1] - 2 * m[0] + m[1]);
+    for (std::size_t i = 1; i != size - 1; ++i)
+    {
+        next[i] = m[i] + 0.5 * (m[i - 1] - 2 * m[i] + m[i + 1]);
+    }
+    next[size - 1] =
+        m[size - 1] + 0.5 * (m[size - 2] - 2 * m[size - 1] + r[0]);
+
+    return next;
+}
+
+double measure_stencil(hpx::launch policy, std::size_t num_samples,
+    std::size_t np, std::size_t nx, std::size_t nt)
+{
+    double result = 0;
+
+    for (std::size_t k = 0; k != num_samples; ++k)
+    {
+        std::vector<partition_future> current;
+        current.reserve(np);
+        for (std::size_t i = 0; i != np; ++i)
+        {
+            current.push_back(
+                hpx::make_ready_future(partition(nx, double(i))));
+        }
+
+        hpx::chrono::high_resolution_timer t;
+        for (std::size_t s = 0; s != nt; ++s)
+        {
+            std::vector<partition_future> next;
+            next.reserve(np);
+            for (std::size_t i = 0; i != np; ++i)
+            {
+                next.push_back(hpx::dataflow(policy, &heat_part,
+                    current[(i + np - 1) % np], current[i],
+                    current[(i + 1) % np]));
+            }
+            current = std::move(next);
+        }
+        hpx::wait_all(current);
+
+        result += t.elapsed();
+    }
+
+    return result / num_samples;
+}
+
+hpx::launch make_policy(hpx::threads::thread_schedule_hint_mode mode,
+    hpx::threads::thread_execution_hint runs_as_child =
+        hpx::threads::thread_execution_hint::none)
+{
+    return hpx::launch::async_policy(hpx::threads::thread_priority::default_,
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_hint(mode, 0,
+            hpx::threads::thread_placement_hint::none, runs_as_child));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    using hpx::threads::thread_schedule_hint_mode;
+
+    std::size_t const num_samples = vm["samples"].as<std::size_t>();
+    std::size_t const np = vm["np"].as<std::size_t>();
+    std::size_t const nx = vm["nx"].as<std::size_t>();
+    std::size_t const nt = vm["nt"].as<std::size_t>();
+
+    double const elapsed_default = measure_stencil(
+        make_policy(thread_schedule_hint_mode::none), num_samples, np, nx, nt);
+    double const elapsed_local_thread =
+        measure_stencil(make_policy(thread_schedule_hint_mode::local_thread),
+            num_samples, np, nx, nt);
+    double const elapsed_local_numa =
+        measure_stencil(make_policy(thread_schedule_hint_mode::local_numa),
+            num_samples, np, nx, nt);
+    double const elapsed_work_first =
+        measure_stencil(make_policy(thread_schedule_hint_mode::local_thread,
+                            hpx::threads::thread_execution_hint::run_as_child),
+            num_samples, np, nx, nt);
+
+    if (!vm.count("no-header"))
+    {
+        std::cout << "OS_Threads,Partitions,Points,Steps,Default[s],"
+                     "LocalThread[s],LocalNuma[s],WorkFirst[s]"
+                  << std::endl;
+    }
+
+    hpx::util::format_to(std::cout, "{},{},{},{},{:.12},{:.12},{:.12},{:.12}\n",
+        hpx::get_os_thread_count(), np, nx, nt, elapsed_default,
+        elapsed_local_thread, elapsed_local_numa, elapsed_work_first)
+        << std::flush;
+
+    hpx::util::print_cdash_timing("StencilDefault", elapsed_default);
+    hpx::util::print_cdash_timing("StencilLocalThread", elapsed_local_thread);
+    hpx::util::print_cdash_timing("StencilLocalNuma", elapsed_local_numa);
+    hpx::util::print_cdash_timing("StencilWorkFirst", elapsed_work_first);
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    // Configure application-specific options.
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("samples,s", po::value<std::size_t>()->default_value(10),
+         "number of samples to average over (default: 10)")
+        ("np", po::value<std::size_t>()->default_value(64),
+         "number of partitions (default: 64)")
+        ("nx", po::value<std::size_t>()->default_value(4096),
+         "number of points per partition (default: 4096)")
+        ("nt", po::value<std::size_t>()->default_value(100),
+         "number of time steps (default: 100)")
+        ("no-header,n", "do not print out the csv header row");
+    // clang-format on
+
+    // Initialize and run HPX.
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,211 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark solves the heat equation on a periodic 1D or 2D grid stored
+// in a partitioned_vector. The grid is decomposed into segments of whole rows,
+// the boundary rows of the neighboring segments are exchanged using
+// hpx::partitioned_vector_halo. The exchange overlaps with the update of the
+// interior rows of each segment.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_halo.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+
+using halo_type = hpx::partitioned_vector_halo<double>;
+
+double const k = 0.1;    // heat transfer coefficient
+
+///////////////////////////////////////////////////////////////////////////////
+// Update the rows [first, last) of the i-th local segment. Rows outside of
+// the segment are taken from the ghost regions.
+void update_rows(halo_type const& current, halo_type& next, std::size_t i,
+    std::size_t nx, std::size_t first, std::size_t last)
+{
+    std::vector<double> const& u = current.data(i);
+    std::vector<double>& result = next.data(i);
+
+    std::size_t const rows = u.size() / nx;
+
+    for (std::size_t r = first; r != last; ++r)
+    {
+        double const* up =
+            r != 0 ? &u[(r - 1) * nx] : current.left(i).data();
+        double const* down =
+            r + 1 != rows ? &u[(r + 1) * nx] : current.right(i).data();
+        double const* row = &u[r * nx];
+        double* out = &result[r * nx];
+
+        if (nx == 1)
+        {
+            out[0] = row[0] + k * (up[0] + down[0] - 2 * row[0]);
+            continue;
+        }
+
+        for (std::size_t c = 0; c != nx; ++c)
+        {
+            double const west = row[c != 0 ? c - 1 : nx - 1];
+            double const east = row[c + 1 != nx ? c + 1 : 0];
+
+            out[c] = row[c] +
+                k * (up[c] + down[c] + west + east - 4 * row[c]);
+        }
+    }
+}
+
+hpx::future<void> update_segment(
+    halo_type& current, halo_type& next, std::size_t i, std::size_t nx)
+{
+    std::size_t const rows = current.data(i).size() / nx;
+
+    // exchange the boundary rows while the interior rows are updated
+    hpx::future<void> ghosts = current.refresh(i);
+    hpx::future<void> interior = hpx::async([&current, &next, i, nx, rows]() {
+        if (rows > 2)
+            update_rows(current, next, i, nx, 1, rows - 1);
+    });
+
+    return hpx::dataflow(
+        [&current, &next, i, nx, rows](
+            hpx::future<void>&& g, hpx::future<void>&& f) {
+            g.get();    // propagate exceptions
+            f.get();
+
+            update_rows(current, next, i, nx, 0, 1);
+            if (rows > 1)
+                update_rows(current, next, i, nx, rows - 1, rows);
+        },
+        HPX_MOVE(ghosts), HPX_MOVE(interior));
+}
+
+double sum(halo_type const& halo)
+{
+    double result = 0.0;
+    for (std::size_t i = 0; i != halo.size(); ++i)
+    {
+        for (double const v : halo.data(i))
+            result += v;
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const nx = vm["nx"].as<std::size_t>();
+    std::size_t const ny = vm["ny"].as<std::size_t>();
+    std::size_t const num_segments = vm["segments"].as<std::size_t>();
+    std::size_t const steps = vm["steps"].as<std::size_t>();
+
+    if (nx == 0 || num_segments == 0 || ny % num_segments != 0)
+    {
+        std::cerr << "the number of rows (ny) must be a multiple of the "
+                     "number of segments\n";
+        return hpx::finalize();
+    }
+
+    std::size_t const size = nx * ny;
+
+    hpx::partitioned_vector<double> u[2] = {
+        hpx::partitioned_vector<double>(
+            size, hpx::container_layout(num_segments)),
+        hpx::partitioned_vector<double>(
+            size, hpx::container_layout(num_segments))};
+
+    // exchange one row with each of the neighboring segments
+    halo_type halo[2] = {halo_type(u[0], nx, true), halo_type(u[1], nx, true)};
+
+    // initial condition
+    for (std::size_t i = 0; i != halo[0].size(); ++i)
+    {
+        std::vector<double>& data = halo[0].data(i);
+
+        std::size_t const first = halo[0].get_partition(i) * data.size();
+        for (std::size_t j = 0; j != data.size(); ++j)
+        {
+            data[j] = static_cast<double>((first + j) % 17);
+        }
+    }
+
+    double const initial_sum = sum(halo[0]);
+
+    hpx::chrono::high_resolution_timer const t;
+
+    for (std::size_t s = 0; s != steps; ++s)
+    {
+        halo_type& current = halo[s % 2];
+        halo_type& next = halo[(s + 1) % 2];
+
+        std::vector<hpx::future<void>> segments;
+        segments.reserve(current.size());
+        for (std::size_t i = 0; i != current.size(); ++i)
+        {
+            segments.push_back(update_segment(current, next, i, nx));
+        }
+        hpx::wait_all(segments);
+    }
+
+    double const elapsed = t.elapsed();
+
+    // the periodic heat equation conserves the overall amount of heat
+    double const final_sum = sum(halo[steps % 2]);
+    HPX_TEST_LTE(std::abs(final_sum - initial_sum),
+        1e-6 * (std::abs(initial_sum) + 1.0));
+
+    std::cout << (ny != 1 && nx != 1 ? "2D" : "1D") << " stencil, grid: " << nx
+              << "x" << ny << ", segments: " << num_segments
+              << ", steps: " << steps << "\n"
+              << "elapsed: " << elapsed << " [s], "
+              << static_cast<double>(size) * static_cast<double>(steps) /
+            elapsed / 1e6
+              << " [MLUP/s]\n";
+
+    hpx::util::print_cdash_timing("PartitionedVectorStencil", elapsed);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("nx", value<std::size_t>()->default_value(1000),
+         "number of grid points in each row, use 1 for a 1D grid "
+         "(default: 1000)")
+        ("ny", value<std::size_t>()->default_value(1000),
+         "number of rows (default: 1000)")
+        ("segments", value<std::size_t>()->default_value(10),
+         "number of segments (default: 10)")
+        ("steps", value<std::size_t>()->default_value(100),
+         "number of time steps (default: 100)");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
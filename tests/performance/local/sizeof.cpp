@@ -1,18 +1,29 @@
 //  Copyright (c) 2011 Bryce Adelstein-Lelbach
+//  Copyright (c) 2024 The STE||AR-Group
 //
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+// This benchmark prints the size of some of the core data structures (the
+// size of the thread objects directly influences the number of cache lines
+// touched while scheduling a thread) and measures the throughput of spawning
+// and running empty threads.
+
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/iostream.hpp>
+#include <hpx/latch.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
 #include <hpx/preprocessor/stringize.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 using hpx::program_options::options_description;
 using hpx::program_options::value;
 using hpx::program_options::variables_map;
@@ -22,7 +33,24 @@ using hpx::find_here;
 using hpx::cout;
 
 ///////////////////////////////////////////////////////////////////////////////
-int hpx_main(variables_map&)
+// spawn the given number of empty threads and return the time it took to run
+// all of them
+double measure_thread_throughput(std::uint64_t num_tasks)
+{
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_tasks + 1));
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::uint64_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::post([&l] { l.count_down(1); });
+    }
+    l.arrive_and_wait();
+
+    return t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
 {
     {
 #define HPX_SIZEOF(type)                                                       \
@@ -31,11 +59,26 @@ int hpx_main(variables_map&)
 
         cout << HPX_SIZEOF(hpx::naming::gid_type) << HPX_SIZEOF(hpx::id_type)
              << HPX_SIZEOF(hpx::naming::address)
-             << HPX_SIZEOF(hpx::threads::thread_data) << std::flush;
+             << HPX_SIZEOF(hpx::threads::thread_data)
+             << HPX_SIZEOF(hpx::threads::thread_data_stackful)
+             << HPX_SIZEOF(hpx::threads::thread_data_stackless)
+             << HPX_SIZEOF(hpx::threads::thread_description) << std::flush;
 
 #undef HPX_SIZEOF
     }
 
+    std::uint64_t const num_tasks = vm["tasks"].as<std::uint64_t>();
+    if (num_tasks != 0)
+    {
+        double const elapsed = measure_thread_throughput(num_tasks);
+
+        cout << hpx::util::format("{1:-40} {2:.1f}\n", "threads/s",
+                    static_cast<double>(num_tasks) / elapsed)
+             << std::flush;
+
+        hpx::util::print_cdash_timing("ThreadThroughput", elapsed);
+    }
+
     hpx::finalize();
     return 0;
 }
@@ -43,7 +86,18 @@ int hpx_main(variables_map&)
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()("tasks",
+        value<std::uint64_t>()->default_value(500000),
+        "number of empty threads to spawn for measuring the thread "
+        "throughput, 0 disables the measurement (default: 500000)");
+
     // Initialize and run HPX.
-    return hpx::init(argc, argv);
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
 }
 #endif
@@ -0,0 +1,145 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of creating, running, and destroying
+// short HPX threads which touch part of their stack. The threads are created
+// in batches, all threads of a batch are alive at the same time. Batches
+// larger than the stack cache (hpx.stacks.cache_size) make threads terminate
+// while the cache is full, those keep their stack until their thread object
+// is recycled. Compare runs with e.g. --hpx:ini=hpx.stacks.cache_size=0
+// (stacks stay with the thread objects) and with the default settings.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/runtime.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#define HPX_STACK_CACHE_COUNTERS
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t touch_stack(std::uint64_t value)
+{
+    volatile std::uint64_t data[512];
+    for (std::size_t i = 0; i != 512; ++i)
+    {
+        data[i] = value + i;
+    }
+    return data[value % 512];
+}
+
+// returns the time (in seconds) needed to run all threads
+double measure(std::size_t num_threads, std::size_t batch_size)
+{
+    std::vector<hpx::future<std::uint64_t>> futures;
+    futures.reserve(batch_size);
+
+    hpx::chrono::high_resolution_timer const timer;
+    for (std::size_t i = 0; i < num_threads; i += batch_size)
+    {
+        for (std::size_t j = 0; j != batch_size; ++j)
+        {
+            futures.push_back(
+                hpx::async(&touch_stack, static_cast<std::uint64_t>(j + 1)));
+        }
+
+        std::uint64_t sum = 0;
+        for (auto& f : futures)
+        {
+            sum += f.get();
+        }
+        HPX_TEST_NEQ(sum, std::uint64_t(0));
+
+        futures.clear();
+    }
+    return timer.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_threads = vm["threads"].as<std::size_t>();
+    std::size_t const batch_size = vm["batch-size"].as<std::size_t>();
+
+    if (batch_size == 0)
+    {
+        throw std::invalid_argument("batch-size must not be zero");
+    }
+
+#if defined(HPX_STACK_CACHE_COUNTERS)
+    namespace posix = hpx::threads::coroutines::detail::posix;
+    posix::get_stack_cache_release_count(true);
+    posix::get_stack_cache_reuse_count(true);
+#endif
+
+    double const elapsed = measure(num_threads, batch_size);
+
+    std::int64_t released = 0;
+    std::int64_t reused = 0;
+#if defined(HPX_STACK_CACHE_COUNTERS)
+    released = posix::get_stack_cache_release_count(false);
+    reused = posix::get_stack_cache_reuse_count(false);
+#endif
+
+    if (!vm.count("no-header"))
+    {
+        std::cout << "OS_Threads,Stack Cache Size,Threads,Batch Size,"
+                     "Total Time[s],Time per Thread[s],Stacks Released,"
+                     "Stacks Reused"
+                  << std::endl;
+    }
+
+    double const per_thread = elapsed / static_cast<double>(num_threads);
+    hpx::util::format_to(std::cout, "{},{},{},{},{:.12},{:.12},{},{}\n",
+        hpx::get_os_thread_count(),
+        hpx::get_config_entry("hpx.stacks.cache_size", "0"), num_threads,
+        batch_size, elapsed, per_thread, released, reused)
+        << std::flush;
+
+    hpx::util::print_cdash_timing("StackCacheTimePerThread", per_thread);
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    // Configure application-specific options.
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("threads", po::value<std::size_t>()->default_value(1000000),
+         "number of threads to create (default: 1000000)")
+        ("batch-size", po::value<std::size_t>()->default_value(64),
+         "number of threads alive at the same time (default: 64)")
+        ("no-header,n", "do not print out the csv header row");
+    // clang-format on
+
+    // Initialize and run HPX.
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif
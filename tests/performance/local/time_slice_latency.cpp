@@ -0,0 +1,152 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the latency of short tasks which are queued on the
+// same worker thread as a long running compute task. The compute task calls
+// hpx::this_thread::yield_if_slice_expired() after each step of its
+// computation. Without time slicing (hpx.time_slice=0, the default) the short
+// tasks can start running only after the compute task has finished. With time
+// slicing enabled (e.g. --hpx:ini=hpx.time_slice=100) the compute task
+// yields once its time slice has expired, allowing the short tasks to run
+// early. Run the benchmark with --hpx:threads=1 to make all tasks share a
+// single worker thread.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t compute(std::size_t steps, std::size_t step_size)
+{
+    std::uint64_t value = 0;
+    for (std::size_t s = 0; s != steps; ++s)
+    {
+        for (std::size_t i = 0; i != step_size; ++i)
+        {
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+        hpx::this_thread::yield_if_slice_expired();
+    }
+    return value;
+}
+
+// returns the average and the maximal latency (in seconds) of the short tasks
+std::pair<double, double> measure_latency(std::size_t num_samples,
+    std::size_t num_tasks, std::size_t steps, std::size_t step_size)
+{
+    double average = 0;
+    double maximum = 0;
+
+    for (std::size_t k = 0; k != num_samples; ++k)
+    {
+        hpx::future<std::uint64_t> f = hpx::async(&compute, steps, step_size);
+
+        std::vector<hpx::future<double>> tasks;
+        tasks.reserve(num_tasks);
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+            tasks.push_back(hpx::async([start] {
+                return static_cast<double>(
+                           hpx::chrono::high_resolution_clock::now() - start) *
+                    1e-9;
+            }));
+        }
+
+        for (auto& task : tasks)
+        {
+            double const latency = task.get();
+            average += latency;
+            maximum = (std::max)(maximum, latency);
+        }
+
+        HPX_TEST_NEQ(f.get(), static_cast<std::uint64_t>(0));
+    }
+
+    return {average / static_cast<double>(num_samples * num_tasks), maximum};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_samples = vm["samples"].as<std::size_t>();
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>();
+    std::size_t const steps = vm["steps"].as<std::size_t>();
+    std::size_t const step_size = vm["step-size"].as<std::size_t>();
+
+    auto const [average, maximum] =
+        measure_latency(num_samples, num_tasks, steps, step_size);
+
+    std::int64_t const forced_yields =
+        hpx::this_thread::get_pool()->get_forced_yield_count(
+            static_cast<std::size_t>(-1), false);
+
+    if (!vm.count("no-header"))
+    {
+        std::cout << "OS_Threads,Time Slice[us],Tasks,Steps,Step Size,"
+                     "Average Latency[s],Max Latency[s],Forced Yields"
+                  << std::endl;
+    }
+
+    hpx::util::format_to(std::cout, "{},{},{},{},{},{:.12},{:.12},{}\n",
+        hpx::get_os_thread_count(),
+        hpx::get_config_entry("hpx.time_slice", "0"), num_tasks, steps,
+        step_size, average, maximum, forced_yields)
+        << std::flush;
+
+    hpx::util::print_cdash_timing("TimeSliceAverageLatency", average);
+    hpx::util::print_cdash_timing("TimeSliceMaxLatency", maximum);
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    // Configure application-specific options.
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("samples,s", po::value<std::size_t>()->default_value(10),
+         "number of samples to average over (default: 10)")
+        ("tasks", po::value<std::size_t>()->default_value(100),
+         "number of short tasks queued behind the compute task "
+         "(default: 100)")
+        ("steps", po::value<std::size_t>()->default_value(1000),
+         "number of steps performed by the compute task (default: 1000)")
+        ("step-size", po::value<std::size_t>()->default_value(10000),
+         "number of iterations per step of the compute task "
+         "(default: 10000)")
+        ("no-header,n", "do not print out the csv header row");
+    // clang-format on
+
+    // Initialize and run HPX.
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,186 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overheads of timed suspensions of threads in
+// timer-heavy workloads: arming timeouts that are canceled long before they
+// expire (condition_variable::wait_for), many concurrent sleep_for calls
+// expiring at the same time, and timed thread state changes as used by
+// make_ready_future_after.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/condition_variable.hpp>
+#include <hpx/format.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// every thread arms a timeout which is canceled when the thread is notified
+double measure_wait_for_canceled(std::size_t num_samples, std::size_t num_tasks)
+{
+    double result = 0;
+
+    for (std::size_t k = 0; k != num_samples; ++k)
+    {
+        hpx::mutex mtx;
+        hpx::condition_variable cond;
+        std::atomic<std::size_t> waiting(0);
+
+        std::vector<hpx::future<void>> tasks;
+        tasks.reserve(num_tasks);
+
+        hpx::chrono::high_resolution_timer t;
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            tasks.push_back(hpx::async([&]() {
+                std::unique_lock<hpx::mutex> l(mtx);
+                ++waiting;
+                cond.wait_for(l, std::chrono::hours(1));
+            }));
+        }
+
+        hpx::util::yield_while(
+            [&]() { return waiting.load() != num_tasks; });
+        {
+            std::lock_guard<hpx::mutex> l(mtx);
+            cond.notify_all();
+        }
+        hpx::wait_all(tasks);
+
+        result += t.elapsed();
+    }
+
+    return result / num_samples;
+}
+
+// all threads sleep for the same duration, the time spent on top of that
+// duration is the overhead of arming and expiring the timers
+double measure_sleep_for(
+    std::size_t num_samples, std::size_t num_tasks, std::uint64_t delay)
+{
+    double result = 0;
+
+    for (std::size_t k = 0; k != num_samples; ++k)
+    {
+        std::vector<hpx::future<void>> tasks;
+        tasks.reserve(num_tasks);
+
+        hpx::chrono::high_resolution_timer t;
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            tasks.push_back(hpx::async([delay]() {
+                hpx::this_thread::sleep_for(std::chrono::microseconds(delay));
+            }));
+        }
+        hpx::wait_all(tasks);
+
+        result += t.elapsed() - static_cast<double>(delay) * 1e-6;
+    }
+
+    return result / num_samples;
+}
+
+// timed thread state changes which are not bound to a suspended thread
+double measure_ready_future_after(
+    std::size_t num_samples, std::size_t num_tasks, std::uint64_t delay)
+{
+    double result = 0;
+
+    for (std::size_t k = 0; k != num_samples; ++k)
+    {
+        std::vector<hpx::future<void>> tasks;
+        tasks.reserve(num_tasks);
+
+        hpx::chrono::high_resolution_timer t;
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            tasks.push_back(
+                hpx::make_ready_future_after(std::chrono::microseconds(delay)));
+        }
+        hpx::wait_all(tasks);
+
+        result += t.elapsed() - static_cast<double>(delay) * 1e-6;
+    }
+
+    return result / num_samples;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_samples = vm["samples"].as<std::size_t>();
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>();
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+
+    double const elapsed_canceled =
+        measure_wait_for_canceled(num_samples, num_tasks);
+    double const elapsed_sleep =
+        measure_sleep_for(num_samples, num_tasks, delay);
+    double const elapsed_after =
+        measure_ready_future_after(num_samples, num_tasks, delay);
+
+    if (!vm.count("no-header"))
+    {
+        std::cout << "Tasks,Delay[us],WaitForCanceled[s],SleepFor[s],"
+                     "ReadyFutureAfter[s] (per task)"
+                  << std::endl;
+    }
+
+    hpx::util::format_to(std::cout, "{},{},{:.12},{:.12},{:.12}\n", num_tasks,
+        delay, elapsed_canceled / num_tasks, elapsed_sleep / num_tasks,
+        elapsed_after / num_tasks)
+        << std::flush;
+
+    hpx::util::print_cdash_timing(
+        "WaitForCanceled", elapsed_canceled / num_tasks);
+    hpx::util::print_cdash_timing("SleepFor", elapsed_sleep / num_tasks);
+    hpx::util::print_cdash_timing(
+        "ReadyFutureAfter", elapsed_after / num_tasks);
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    // Configure application-specific options.
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("samples,s", po::value<std::size_t>()->default_value(10),
+         "number of samples to average over (default: 10)")
+        ("tasks,t", po::value<std::size_t>()->default_value(100000),
+         "number of concurrently suspended threads (default: 100000)")
+        ("delay,d", po::value<std::uint64_t>()->default_value(1000),
+         "duration of the timed suspensions in microseconds (default: 1000)")
+        ("no-header,n", "do not print out the csv header row");
+    // clang-format on
+
+    // Initialize and run HPX.
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif